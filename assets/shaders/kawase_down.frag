@@ -0,0 +1,16 @@
+uniform sampler2D 	source;
+uniform vec2 		halfPixel;
+uniform float 		offset;
+
+// Dual filter downsample: the center and four diagonal taps between texels.
+void main()
+{
+	vec2 textureCoordinates = gl_TexCoord[0].xy;
+	vec2 delta = halfPixel * offset;
+	vec4 color = texture2D(source, textureCoordinates) * 4.0;
+	color     += texture2D(source, textureCoordinates - delta);
+	color     += texture2D(source, textureCoordinates + delta);
+	color     += texture2D(source, textureCoordinates + vec2(delta.x, -delta.y));
+	color     += texture2D(source, textureCoordinates - vec2(delta.x, -delta.y));
+	gl_FragColor = color / 8.0;
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+uniform sampler2D 	source;
+uniform vec2 		halfPixel;
+uniform float 		offset;
+
+// Dual filter upsample: a ring of eight taps, diagonals weighted twice.
+void main()
+{
+	vec2 textureCoordinates = gl_TexCoord[0].xy;
+	vec2 delta = halfPixel * offset;
+	vec4 color = texture2D(source, textureCoordinates + vec2(-delta.x * 2.0, 0.0));
+	color     += texture2D(source, textureCoordinates + vec2(-delta.x, delta.y)) * 2.0;
+	color     += texture2D(source, textureCoordinates + vec2(0.0, delta.y * 2.0));
+	color     += texture2D(source, textureCoordinates + vec2(delta.x, delta.y)) * 2.0;
+	color     += texture2D(source, textureCoordinates + vec2(delta.x * 2.0, 0.0));
+	color     += texture2D(source, textureCoordinates + vec2(delta.x, -delta.y)) * 2.0;
+	color     += texture2D(source, textureCoordinates + vec2(0.0, -delta.y * 2.0));
+	color     += texture2D(source, textureCoordinates + vec2(-delta.x, -delta.y)) * 2.0;
+	gl_FragColor = color / 12.0;
+}
\ No newline at end of file
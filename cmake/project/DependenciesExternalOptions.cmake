@@ -333,3 +333,33 @@ target_link_libraries("${${PROJECT_NAME}_MAIN_BIN_TARGET}"
 		"glm::glm"
 )
 message(STATUS "Import and link glm - done")
+
+
+#---- Import and link zlib. ----
+message(STATUS "Import and link zlib")
+# Only its header is bundled in `include/zlib`, the library comes from the
+# system.
+find_package(ZLIB REQUIRED)
+
+# Link zlib to the main binary build target.
+message(STATUS "Link zlib library to the target \"${${PROJECT_NAME}_MAIN_BIN_TARGET}\"")
+target_link_libraries("${${PROJECT_NAME}_MAIN_BIN_TARGET}"
+	PRIVATE
+		"ZLIB::ZLIB"
+)
+message(STATUS "Import and link zlib - done")
+
+
+#---- Import and link FreeType. ----
+message(STATUS "Import and link FreeType")
+# Already a dependency of SFML, it bakes the glyphs of bitmap fonts without
+# OpenGL context.
+find_package(Freetype REQUIRED)
+
+# Link FreeType to the main binary build target.
+message(STATUS "Link FreeType library to the target \"${${PROJECT_NAME}_MAIN_BIN_TARGET}\"")
+target_link_libraries("${${PROJECT_NAME}_MAIN_BIN_TARGET}"
+	PRIVATE
+		"Freetype::Freetype"
+)
+message(STATUS "Import and link FreeType - done")
@@ -10,6 +10,7 @@
 
 #include "application.h"
 
+#include "../gui/software_render_target.h"
 #include "../monitor/window/state_machine_window.h"
 #include "../state_machine/game_over_state.h"
 #include "../state_machine/game_state.h"
@@ -21,6 +22,8 @@
 #include "configuration.h"
 #include "log.h"
 #include "monitor/window/window.h"
+#include "world.h"
+#include "worker_pool.h"
 
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Graphics/Texture.hpp>
@@ -28,6 +31,11 @@
 #include <SFML/System/Vector2.hpp>
 #include <SFML/Window/WindowStyle.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <string>
+
 namespace FastSimDesign {
 ////////////////////////////////////////////////////////////
 /// Statics
@@ -35,10 +43,9 @@ namespace FastSimDesign {
 sf::Time const Application::TIME_PER_FRAME = sf::seconds(1.f / 60.f);
 constexpr int const Application::MAX_UPDATES = 5;
 
-void Application::launch(Application app)
+void Application::launch(Application app, Configuration config)
 {
   LOG_INFO("Starting FastSimDesign...");
-  Configuration config{};
   app.configure(config);
   app.init(config);
   app.preRun();
@@ -50,12 +57,74 @@ void Application::launch(Application app)
   LOG_INFO("FastSimDesign stopped successfully!");
 }
 
+bool Application::launchHeadless(
+    HeadlessSettings const& settings, Configuration config)
+{
+  LOG_INFO("Starting FastSimDesign headless...");
+  EntityCatalog entity_catalog{};
+  entity_catalog.load(
+      "../assets/entitytypes.ini",
+      "../assets/entitytypes.bin");
+  EntityCatalog::setCurrent(&entity_catalog);
+
+  FontHolder fonts{true};
+  fonts.load(Fonts::ID::MAIN, "../assets/fonts/arial.ttf");
+  SoundPlayer sounds{};
+  SimMonitor::Monitor monitor{};
+  WorkerPool workers{};
+  SoftwareRenderTarget target{
+      sf::Vector2u{config.width, config.height}, &workers};
+
+  bool const has_golden_frames = !settings.golden_directory.empty();
+  if (has_golden_frames)
+    std::filesystem::create_directories(settings.golden_directory);
+
+  std::size_t frame = 0;
+  std::size_t mismatch_count = 0;
+  {
+    World world{config, monitor, fonts, sounds};
+    LOG_INFO("FastSimDesign started successfully!");
+    for (; frame < settings.frame_count && world.hasAlivePlayer() &&
+           !world.hasPlayerReachedEnd();
+         ++frame)
+    {
+      world.update(TIME_PER_FRAME);
+      world.draw(target);
+
+      if (!has_golden_frames ||
+          frame % std::max<std::size_t>(settings.golden_interval, 1) != 0)
+        continue;
+
+      std::filesystem::path const path = settings.golden_directory /
+                                         ("frame_" + std::to_string(frame) +
+                                          ".png");
+      FrameDifference const difference = compareToGoldenFrame(
+          target.copyToImage(), path, settings.golden_mode, settings.tolerance);
+      if (!difference.is_recorded && !difference.matches())
+      {
+        ++mismatch_count;
+        LOG_ERROR(
+            "Frame {} differs from {} on {} pixels, by up to {}",
+            frame,
+            path.string(),
+            difference.different_pixel_count,
+            difference.max_channel_difference);
+      }
+    }
+  }
+
+  EntityCatalog::setCurrent(nullptr);
+  LOG_INFO("FastSimDesign stopped successfully after {} frames!", frame);
+  return mismatch_count == 0;
+}
+
 ////////////////////////////////////////////////////////////
 /// Methods
 ////////////////////////////////////////////////////////////
 Application::Application()
   : m_window{sf::VideoMode{1280, 720}, "Fast-Sim-Design", sf::Style::Default}
   , m_state_stack{State::Context{
+        &m_configuration,
         &m_monitor,
         &m_window,
         &m_textures,
@@ -73,9 +142,13 @@ Application::Application()
       "../assets/sprites/npcs/title_screen.png");
   m_textures.load(Textures::ID::BUTTONS, "../assets/sprites/npcs/buttons.png");
 
-  m_statistics_text.setFont(m_fonts.get(Fonts::ID::MAIN));
+  m_entity_catalog.load(
+      "../assets/entitytypes.ini",
+      "../assets/entitytypes.bin");
+  EntityCatalog::setCurrent(&m_entity_catalog);
+
+  m_statistics_text.setFont(m_fonts.getBitmapFont(Fonts::ID::MAIN, 10));
   m_statistics_text.setPosition(5.f, 5.f);
-  m_statistics_text.setCharacterSize(10);
 
   registerStates();
   m_state_stack.pushState(States::ID::TITLE);
@@ -92,6 +165,7 @@ void Application::configure(Configuration&) const
 void Application::init(Configuration const& config)
 {
   LOG_INFO("*** (2/3) Initializing app ***");
+  m_configuration = config;
   initWindow(config);
   initMonitor(config);
   LOG_INFO("App initialized.");
@@ -13,19 +13,38 @@
 #ifndef FAST_SIM_DESIGN_APPLICATION_H
 #define FAST_SIM_DESIGN_APPLICATION_H
 
+#include "../entity/entity_catalog.h"
 #include "../entity/player.h"
+#include "../gui/bitmap_text.h"
+#include "../gui/frame_comparison.h"
 #include "../monitor/monitor.h"
 #include "../state_machine/state_stack.h"
+#include "configuration.h"
+#include "font_holder.h"
 #include "music_player.h"
 #include "resource_identifiers.h"
 #include "sound_player.h"
+#include "texture_holder.h"
 
 #include <SFML/Graphics/RenderWindow.hpp>
-#include <SFML/Graphics/Text.hpp>
 #include <SFML/System/Clock.hpp>
 #include <SFML/System/Time.hpp>
 
+#include <cstddef>
+#include <filesystem>
+
 namespace FastSimDesign {
+/// Settings of a headless simulation, read from the command line.
+struct HeadlessSettings
+{
+  std::size_t frame_count{0}; // Maximum number of frames to simulate.
+  // Directory of the golden frames, empty to neither record nor compare.
+  std::filesystem::path golden_directory{};
+  GoldenFrameMode golden_mode{GoldenFrameMode::COMPARE};
+  std::size_t golden_interval{60}; // Frames between two golden frames.
+  unsigned tolerance{0}; // Per channel, for the comparison.
+};
+
 ////////////////////////////////////////////////////////////
 /// @brief Application class from which Fast-Sim-Design simulations starts.
 ///
@@ -63,13 +82,25 @@ namespace FastSimDesign {
 /// https://github.com/SpaiR/imgui-java/blob/main/imgui-app/src/main/java/imgui/app/Window.java
 /// \endlink.
 ////////////////////////////////////////////////////////////
-struct Configuration;
 class Application final
 {
 public:
   /// Entry point of application. Use it to start the simulation.
   /// @param app The instance of the Application class to launch.
-  static void launch(Application app);
+  /// @param config The configuration read from the command line, completed
+  /// by {@link #configure(Configuration)}.
+  static void launch(Application app, Configuration config = Configuration{});
+  /// Entry point of headless simulations, without window nor OpenGL context.
+  /// The world is simulated until the player is dead or has reached the
+  /// end, and drawn on a software render target, its frames being recorded
+  /// when the configuration captures them. Every golden_interval frames,
+  /// the frame is recorded as a golden frame or compared to it.
+  /// @param settings The frame count and golden frames of the simulation.
+  /// @param config The configuration read from the command line, e.g. the
+  /// capture format.
+  /// @return False if a frame did not match its golden frame.
+  static bool launchHeadless(
+      HeadlessSettings const& settings, Configuration config = Configuration{});
   static sf::Time const TIME_PER_FRAME;
   static int const MAX_UPDATES; // Protect from death spiral.
 
@@ -145,9 +176,11 @@ private:
   void registerStates();
 
 private:
+  Configuration m_configuration{};
   sf::RenderWindow m_window{};
   TextureHolder m_textures{};
   FontHolder m_fonts{};
+  EntityCatalog m_entity_catalog{};
   Player m_player{};
   SimMonitor::Monitor m_monitor{};
 
@@ -156,7 +189,7 @@ private:
 
   StateStack m_state_stack;
 
-  sf::Text m_statistics_text{};
+  BitmapText m_statistics_text{};
   sf::Clock m_statistics_sim_time{};
   sf::Time m_statistics_update_time{};
   std::size_t m_statistics_num_frames{0};
@@ -19,6 +19,26 @@
 namespace FastSimDesign {
 struct Configuration
 {
+  // Bloom applied to the world. CLASSIC is the former gaussian bloom, the
+  // others are dual filter presets from the cheapest to the widest.
+  enum class BloomQuality : uint16_t
+  {
+    CLASSIC,
+    LOW,
+    MEDIUM,
+    HIGH,
+    BLOOM_QUALITY_COUNT,
+  };
+  // Format of the world frames recorded to the capture directory, NONE to
+  // record nothing.
+  enum class CaptureFormat : uint16_t
+  {
+    NONE,
+    PNG,
+    RAW_ZLIB,
+    CAPTURE_FORMAT_COUNT,
+  };
+
   explicit Configuration() = default;
   Configuration(Configuration const&) = default;
   Configuration(Configuration&&) = default;
@@ -31,6 +51,10 @@ struct Configuration
   uint32_t height{720};
   bool fullscreen{false};
   bool use_custom_style{false};
+  BloomQuality bloom_quality{BloomQuality::MEDIUM};
+  CaptureFormat capture_format{CaptureFormat::NONE};
+  std::string capture_directory{"../captures"};
+  float minimap_refresh_rate{10.f}; // Refreshes of the minimap per second.
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
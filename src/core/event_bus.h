@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_EVENT_BUS_H
+#define FAST_SIM_DESIGN_EVENT_BUS_H
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace FastSimDesign {
+/// Typed and double-buffered event bus. Producers append POD events to the
+/// back buffer of their channel, consumers read the front buffer in batch.
+/// `swapBuffers()` is called once per tick at a well-defined phase so every
+/// event is visible exactly once to every consumer.
+class EventBus final
+{
+public:
+  explicit EventBus() = default;
+  EventBus(EventBus const&) = delete;
+  EventBus(EventBus&&) = default;
+  EventBus& operator=(EventBus const&) = delete;
+  EventBus& operator=(EventBus&&) = default;
+  virtual ~EventBus() = default;
+
+  template<typename Event>
+  void publish(Event event)
+  {
+    channel<Event>().m_back.push_back(std::move(event));
+  }
+
+  template<typename Event>
+  std::span<Event const> read() const noexcept
+  {
+    auto found = m_channels.find(typeid(Event));
+    if (found == m_channels.end())
+      return {};
+    return static_cast<Channel<Event> const&>(*found->second).m_front;
+  }
+
+  void swapBuffers() noexcept
+  {
+    for (auto& [type, channel] : m_channels)
+      channel->swapBuffers();
+  }
+
+  void clear() noexcept
+  {
+    for (auto& [type, channel] : m_channels)
+      channel->clear();
+  }
+
+private:
+  struct ChannelBase
+  {
+    virtual ~ChannelBase() = default;
+    virtual void swapBuffers() noexcept = 0;
+    virtual void clear() noexcept = 0;
+  };
+
+  template<typename Event>
+  struct Channel final : public ChannelBase
+  {
+    static_assert(
+        std::is_trivially_copyable_v<Event>,
+        "Events must be plain data.");
+
+    virtual void swapBuffers() noexcept override
+    {
+      // Keep the capacity of both buffers to avoid allocations in steady state.
+      m_front.swap(m_back);
+      m_back.clear();
+    }
+
+    virtual void clear() noexcept override
+    {
+      m_front.clear();
+      m_back.clear();
+    }
+
+    std::vector<Event> m_front{};
+    std::vector<Event> m_back{};
+  };
+
+  template<typename Event>
+  Channel<Event>& channel()
+  {
+    auto found = m_channels.find(typeid(Event));
+    if (found == m_channels.end())
+      found = m_channels
+                  .emplace(typeid(Event), std::make_unique<Channel<Event>>())
+                  .first;
+    return static_cast<Channel<Event>&>(*found->second);
+  }
+
+private:
+  std::unordered_map<std::type_index, std::unique_ptr<ChannelBase>>
+      m_channels{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "font_holder.h"
+
+#include <cassert>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+FontHolder::FontHolder(bool is_headless) noexcept
+  : m_is_headless{is_headless}
+{
+}
+
+void FontHolder::load(Fonts::ID id, std::string const& filePath)
+{
+  m_fonts.load(id, filePath);
+  m_file_paths[id] = filePath;
+}
+
+sf::Font& FontHolder::get(Fonts::ID id) noexcept
+{
+  return m_fonts.get(id);
+}
+
+sf::Font const& FontHolder::get(Fonts::ID id) const
+{
+  return m_fonts.get(id);
+}
+
+BitmapFont const& FontHolder::getBitmapFont(
+    Fonts::ID id, unsigned character_size) const
+{
+  std::unique_ptr<BitmapFont>& bitmap_font =
+      m_bitmap_fonts[BitmapFontKey{id, character_size}];
+  if (!bitmap_font)
+  {
+    // Baked from the file, as the glyphs of sf::Font live in a texture.
+    auto found = m_file_paths.find(id);
+    assert(found != m_file_paths.end());
+    bitmap_font = std::make_unique<BitmapFont>(
+        found->second, character_size, m_is_headless);
+  }
+  return *bitmap_font;
+}
+
+bool FontHolder::isHeadless() const noexcept
+{
+  return m_is_headless;
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,62 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_FONT_HOLDER_H
+#define FAST_SIM_DESIGN_FONT_HOLDER_H
+
+#include "../gui/bitmap_font.h"
+#include "resource_identifiers.h"
+
+#include <SFML/Graphics/Font.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace FastSimDesign {
+/// Fonts, along with the bitmap fonts baked from them. Bitmap fonts are
+/// freed with their fonts rather than at exit, while the window and its
+/// context are still alive.
+///
+/// Headless, the bitmap fonts have no texture, for the software render
+/// target; the fonts themselves can be loaded but not drawn.
+class FontHolder final
+{
+public:
+  explicit FontHolder(bool is_headless = false) noexcept;
+  FontHolder(FontHolder const&) = delete;
+  FontHolder(FontHolder&&) = default;
+  FontHolder& operator=(FontHolder const&) = delete;
+  FontHolder& operator=(FontHolder&&) = default;
+  virtual ~FontHolder() = default;
+
+  void load(Fonts::ID id, std::string const& filePath);
+  sf::Font& get(Fonts::ID id) noexcept;
+  sf::Font const& get(Fonts::ID id) const;
+  // Bitmap font of the font `id` at `character_size`, baked on first use.
+  BitmapFont const& getBitmapFont(Fonts::ID id, unsigned character_size) const;
+  bool isHeadless() const noexcept;
+
+private:
+  using BitmapFontKey = std::pair<Fonts::ID, unsigned>;
+
+private:
+  ResourceHolder<sf::Font, Fonts::ID> m_fonts{};
+  std::map<Fonts::ID, std::string> m_file_paths{};
+  bool m_is_headless{false};
+  // Declared after the fonts to be destroyed before them.
+  mutable std::map<BitmapFontKey, std::unique_ptr<BitmapFont>>
+      m_bitmap_fonts{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,121 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_HANDLE_H
+#define FAST_SIM_DESIGN_HANDLE_H
+
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace FastSimDesign {
+/// 64-bit generational handle: a slot index in a `HandleTable` and the
+/// generation of the slot when the handle was issued. A handle to a released
+/// object never resolves again, even if its slot has been reused.
+struct Handle
+{
+  static constexpr std::uint32_t Invalid_Index =
+      std::numeric_limits<std::uint32_t>::max();
+
+  std::uint32_t index{Invalid_Index};
+  std::uint32_t generation{0};
+
+  constexpr bool isValid() const noexcept { return index != Invalid_Index; }
+  constexpr bool operator==(Handle const& other) const noexcept = default;
+};
+
+/// Slot map from handles to objects with O(1) insertion, release and
+/// resolution. Objects are not owned, the table only maps to their current
+/// address, which can be changed with `relocate()`.
+template<typename T>
+class HandleTable final
+{
+public:
+  explicit HandleTable() = default;
+  HandleTable(HandleTable const&) = default;
+  HandleTable(HandleTable&&) = default;
+  HandleTable& operator=(HandleTable const&) = default;
+  HandleTable& operator=(HandleTable&&) = default;
+  virtual ~HandleTable() = default;
+
+  Handle insert(T& object)
+  {
+    std::uint32_t index = m_first_free;
+    if (index != Handle::Invalid_Index)
+    {
+      m_first_free = m_slots[index].next_free;
+    }
+    else
+    {
+      index = static_cast<std::uint32_t>(m_slots.size());
+      m_slots.emplace_back();
+    }
+
+    Slot& slot = m_slots[index];
+    slot.object = &object;
+    slot.next_free = Handle::Invalid_Index;
+    ++m_size;
+    return Handle{index, slot.generation};
+  }
+
+  void release(Handle handle) noexcept
+  {
+    if (!contains(handle))
+      return;
+
+    // Bump the generation so that all copies of the handle become stale.
+    Slot& slot = m_slots[handle.index];
+    slot.object = nullptr;
+    ++slot.generation;
+    slot.next_free = m_first_free;
+    m_first_free = handle.index;
+    --m_size;
+  }
+
+  void relocate(Handle handle, T& object) noexcept
+  {
+    assert(contains(handle));
+    m_slots[handle.index].object = &object;
+  }
+
+  T* resolve(Handle handle) const noexcept
+  {
+    if (!contains(handle))
+      return nullptr;
+    return m_slots[handle.index].object;
+  }
+
+  bool contains(Handle handle) const noexcept
+  {
+    return handle.index < m_slots.size() &&
+           m_slots[handle.index].generation == handle.generation &&
+           m_slots[handle.index].object != nullptr;
+  }
+
+  std::size_t size() const noexcept { return m_size; }
+
+private:
+  struct Slot
+  {
+    T* object{nullptr};
+    std::uint32_t generation{0};
+    std::uint32_t next_free{Handle::Invalid_Index};
+  };
+
+private:
+  std::vector<Slot> m_slots{};
+  std::uint32_t m_first_free{Handle::Invalid_Index};
+  std::size_t m_size{0};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,157 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "mapped_file.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+MappedFile::MappedFile(MappedFile&& other) noexcept
+  : m_data{std::exchange(other.m_data, nullptr)}
+  , m_size{std::exchange(other.m_size, 0)}
+#ifdef _WIN32
+  , m_file{std::exchange(other.m_file, nullptr)}
+  , m_mapping{std::exchange(other.m_mapping, nullptr)}
+#endif
+{
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+  if (this != &other)
+  {
+    close();
+    m_data = std::exchange(other.m_data, nullptr);
+    m_size = std::exchange(other.m_size, 0);
+#ifdef _WIN32
+    m_file = std::exchange(other.m_file, nullptr);
+    m_mapping = std::exchange(other.m_mapping, nullptr);
+#endif
+  }
+  return *this;
+}
+
+MappedFile::~MappedFile()
+{
+  close();
+}
+
+bool MappedFile::open(std::filesystem::path const& path) noexcept
+{
+  close();
+
+#ifdef _WIN32
+  HANDLE file = ::CreateFileW(
+      path.c_str(),
+      GENERIC_READ,
+      FILE_SHARE_READ,
+      nullptr,
+      OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+    return false;
+
+  LARGE_INTEGER size{};
+  if (!::GetFileSizeEx(file, &size) || size.QuadPart == 0)
+  {
+    ::CloseHandle(file);
+    return false;
+  }
+
+  HANDLE mapping =
+      ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping)
+  {
+    ::CloseHandle(file);
+    return false;
+  }
+
+  void const* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!data)
+  {
+    ::CloseHandle(mapping);
+    ::CloseHandle(file);
+    return false;
+  }
+
+  m_file = file;
+  m_mapping = mapping;
+  m_data = data;
+  m_size = static_cast<std::size_t>(size.QuadPart);
+#else
+  int file = ::open(path.c_str(), O_RDONLY);
+  if (file == -1)
+    return false;
+
+  struct stat status{};
+  if (::fstat(file, &status) == -1 || status.st_size == 0)
+  {
+    ::close(file);
+    return false;
+  }
+
+  std::size_t size = static_cast<std::size_t>(status.st_size);
+  void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+
+  // The mapping keeps its own reference to the file.
+  ::close(file);
+  if (data == MAP_FAILED)
+    return false;
+
+  m_data = data;
+  m_size = size;
+#endif
+  return true;
+}
+
+void MappedFile::close() noexcept
+{
+  if (!m_data)
+    return;
+
+#ifdef _WIN32
+  ::UnmapViewOfFile(m_data);
+  ::CloseHandle(m_mapping);
+  ::CloseHandle(m_file);
+  m_file = nullptr;
+  m_mapping = nullptr;
+#else
+  ::munmap(const_cast<void*>(m_data), m_size);
+#endif
+  m_data = nullptr;
+  m_size = 0;
+}
+
+bool MappedFile::isOpen() const noexcept
+{
+  return m_data != nullptr;
+}
+
+std::span<std::byte const> MappedFile::getBytes() const noexcept
+{
+  return {static_cast<std::byte const*>(m_data), m_size};
+}
+} // namespace FastSimDesign
\ No newline at end of file
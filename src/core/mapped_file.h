@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_MAPPED_FILE_H
+#define FAST_SIM_DESIGN_MAPPED_FILE_H
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+
+namespace FastSimDesign {
+/// Read-only memory mapping of a whole file. Pages are loaded by the OS on
+/// first access, so opening a large file costs nothing until it is read.
+class MappedFile final
+{
+public:
+  explicit MappedFile() = default;
+  MappedFile(MappedFile const&) = delete;
+  MappedFile(MappedFile&& other) noexcept;
+  MappedFile& operator=(MappedFile const&) = delete;
+  MappedFile& operator=(MappedFile&& other) noexcept;
+  virtual ~MappedFile();
+
+  // Return false if the file does not exist, is empty or can not be mapped.
+  bool open(std::filesystem::path const& path) noexcept;
+  void close() noexcept;
+
+  bool isOpen() const noexcept;
+  std::span<std::byte const> getBytes() const noexcept;
+
+private:
+  void const* m_data{nullptr};
+  std::size_t m_size{0};
+#ifdef _WIN32
+  void* m_file{nullptr};
+  void* m_mapping{nullptr};
+#endif
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
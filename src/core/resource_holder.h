@@ -37,7 +37,7 @@ public:
       throw std::runtime_error(
           "ResourceHolder::load - Failed to load " + filePath);
 
-    insertResource(id, std::move(resource));
+    insert(id, std::move(resource));
   }
 
   template<typename Parameter>
@@ -49,7 +49,14 @@ public:
       throw std::runtime_error(
           "ResourceHolder::load - Failed to load " + filePath);
 
-    insertResource(id, std::move(resource));
+    insert(id, std::move(resource));
+  }
+
+  // Hold a resource made otherwise than from a file.
+  void insert(Identifier id, std::unique_ptr<Resource> resource)
+  {
+    auto inserted = m_resource_map.emplace(id, std::move(resource));
+    assert(inserted.second);
   }
 
   Resource& get(Identifier id) noexcept
@@ -66,13 +73,6 @@ public:
     return *found->second;
   }
 
-private:
-  void insertResource(Identifier id, std::unique_ptr<Resource> resource)
-  {
-    auto inserted = m_resource_map.emplace(id, std::move(resource));
-    assert(inserted.second);
-  }
-
 private:
   std::map<Identifier, std::unique_ptr<Resource>> m_resource_map{};
 };
@@ -23,6 +23,9 @@ class SoundBuffer;
 } // namespace sf
 
 namespace FastSimDesign {
+class FontHolder;
+class TextureHolder;
+
 namespace Textures {
 enum class ID : uint16_t
 {
@@ -33,6 +36,15 @@ enum class ID : uint16_t
   EXPLOSION,
   PARTICLE,
   FINISH_LINE,
+  MINION_HIT,
+  MINION_WALK,
+  MUSCLE_HIT,
+  MUSCLE_WALK,
+  NURSE_IDLE,
+  NURSE_WALK,
+  RANGER_IDLE,
+  RANGER_WALK,
+  TEXTURE_COUNT
 };
 }
 
@@ -43,6 +55,8 @@ enum class ID : uint16_t
   DOWN_SAMPLE_PASS,
   GAUSSIAN_BLUR_PASS,
   ADD_PASS,
+  KAWASE_DOWN_PASS,
+  KAWASE_UP_PASS,
 };
 }
 
@@ -74,8 +88,6 @@ enum class ID : uint16_t
 };
 }
 
-using TextureHolder = ResourceHolder<sf::Texture, Textures::ID>;
-using FontHolder = ResourceHolder<sf::Font, Fonts::ID>;
 using ShaderHolder = ResourceHolder<sf::Shader, Shaders::ID>;
 using SoundBufferHolder = ResourceHolder<sf::SoundBuffer, SoundEffect::ID>;
 } // namespace FastSimDesign
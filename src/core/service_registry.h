@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_SERVICE_REGISTRY_H
+#define FAST_SIM_DESIGN_SERVICE_REGISTRY_H
+
+#include "../utils/generic_utility.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <typeindex>
+#include <typeinfo>
+#include <type_traits>
+#include <unordered_map>
+
+namespace FastSimDesign {
+/// Registry of world-level singletons (particle systems, sound node...) that
+/// scene nodes can resolve in O(1) instead of broadcasting a command through
+/// the whole scene graph. A service is keyed by its type and an optional
+/// subtype, e.g. a `Particle::Type`.
+class ServiceRegistry final
+{
+public:
+  explicit ServiceRegistry() = default;
+  ServiceRegistry(ServiceRegistry const&) = default;
+  ServiceRegistry(ServiceRegistry&&) = default;
+  ServiceRegistry& operator=(ServiceRegistry const&) = default;
+  ServiceRegistry& operator=(ServiceRegistry&&) = default;
+  virtual ~ServiceRegistry() = default;
+
+  template<typename Service>
+  void provide(Service& service, std::uint32_t subtype = 0) noexcept
+  {
+    auto inserted = m_services.insert_or_assign(
+        Key{typeid(Service), subtype}, static_cast<void*>(&service));
+    assert(inserted.first->second == &service);
+  }
+
+  template<typename Service, typename Enum>
+  requires std::is_enum_v<Enum>
+  void provide(Service& service, Enum subtype) noexcept
+  {
+    provide<Service>(
+        service, static_cast<std::uint32_t>(toUnderlyingType(subtype)));
+  }
+
+  template<typename Service>
+  void revoke(Service const& service, std::uint32_t subtype = 0) noexcept
+  {
+    // Only revoke the entry if it still points to this service, another one
+    // may have replaced it in the meantime.
+    auto found = m_services.find(Key{typeid(Service), subtype});
+    if (found != m_services.end() && found->second == &service)
+      m_services.erase(found);
+  }
+
+  template<typename Service, typename Enum>
+  requires std::is_enum_v<Enum>
+  void revoke(Service const& service, Enum subtype) noexcept
+  {
+    revoke<Service>(
+        service, static_cast<std::uint32_t>(toUnderlyingType(subtype)));
+  }
+
+  template<typename Service>
+  Service* find(std::uint32_t subtype = 0) const noexcept
+  {
+    auto found = m_services.find(Key{typeid(Service), subtype});
+    if (found == m_services.end())
+      return nullptr;
+    return static_cast<Service*>(found->second);
+  }
+
+  template<typename Service, typename Enum>
+  requires std::is_enum_v<Enum>
+  Service* find(Enum subtype) const noexcept
+  {
+    return find<Service>(
+        static_cast<std::uint32_t>(toUnderlyingType(subtype)));
+  }
+
+  std::size_t size() const noexcept { return m_services.size(); }
+
+private:
+  struct Key
+  {
+    std::type_index type;
+    std::uint32_t subtype;
+
+    bool operator==(Key const& other) const noexcept = default;
+  };
+
+  struct KeyHash
+  {
+    std::size_t operator()(Key const& key) const noexcept
+    {
+      return key.type.hash_code() ^
+             (std::hash<std::uint32_t>{}(key.subtype) << 1);
+    }
+  };
+
+private:
+  std::unordered_map<Key, void*, KeyHash> m_services{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,85 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "texture_holder.h"
+
+#include "resource_exception.h"
+
+#include <memory>
+#include <utility>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+TextureHolder::TextureHolder(bool is_headless) noexcept
+  : m_is_headless{is_headless}
+{
+}
+
+void TextureHolder::load(Textures::ID id, std::string const& filePath)
+{
+  load(m_images, m_textures, id, filePath);
+}
+
+sf::Texture& TextureHolder::get(Textures::ID id) noexcept
+{
+  return m_textures.get(id);
+}
+
+sf::Texture const& TextureHolder::get(Textures::ID id) const
+{
+  return m_textures.get(id);
+}
+
+sf::Image const& TextureHolder::getImage(Textures::ID id) const
+{
+  return m_images.get(id);
+}
+
+void TextureHolder::load(std::string const& filePath)
+{
+  if (m_file_paths.contains(filePath))
+    return;
+
+  load(m_file_images, m_file_textures, filePath, filePath);
+  m_file_paths.insert(filePath);
+}
+
+sf::Texture const& TextureHolder::get(std::string const& filePath) const
+{
+  return m_file_textures.get(filePath);
+}
+
+sf::Image const& TextureHolder::getImage(std::string const& filePath) const
+{
+  return m_file_images.get(filePath);
+}
+
+bool TextureHolder::isHeadless() const noexcept
+{
+  return m_is_headless;
+}
+
+template<typename Identifier>
+void TextureHolder::load(
+    ResourceHolder<sf::Image, Identifier>& images,
+    ResourceHolder<sf::Texture, Identifier>& textures,
+    Identifier const& id,
+    std::string const& filePath) const
+{
+  images.load(id, filePath);
+
+  auto texture = std::make_unique<sf::Texture>();
+  if (!m_is_headless && !texture->loadFromImage(images.get(id)))
+    throw ResourceException{"Failed to create the texture of " + filePath};
+  textures.insert(id, std::move(texture));
+}
+} // namespace FastSimDesign
\ No newline at end of file
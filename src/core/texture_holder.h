@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_TEXTURE_HOLDER_H
+#define FAST_SIM_DESIGN_TEXTURE_HOLDER_H
+
+#include "resource_identifiers.h"
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <set>
+#include <string>
+
+namespace FastSimDesign {
+/// Textures, along with the images they are loaded from. The images stay in
+/// memory, for the software render target and to build atlases without
+/// reading textures back.
+///
+/// Textures without identifier, such as those of tilesets, are held by the
+/// path of their file, loaded once however many times they are asked for.
+///
+/// Headless, the textures are left empty so that no OpenGL context is
+/// needed: only the images are drawn, by the software render target.
+class TextureHolder final
+{
+public:
+  explicit TextureHolder(bool is_headless = false) noexcept;
+  TextureHolder(TextureHolder const&) = delete;
+  TextureHolder(TextureHolder&&) = default;
+  TextureHolder& operator=(TextureHolder const&) = delete;
+  TextureHolder& operator=(TextureHolder&&) = default;
+  virtual ~TextureHolder() = default;
+
+  void load(Textures::ID id, std::string const& filePath);
+  sf::Texture& get(Textures::ID id) noexcept;
+  sf::Texture const& get(Textures::ID id) const;
+  sf::Image const& getImage(Textures::ID id) const;
+
+  // Do nothing if the file is already loaded.
+  void load(std::string const& filePath);
+  sf::Texture const& get(std::string const& filePath) const;
+  sf::Image const& getImage(std::string const& filePath) const;
+
+  bool isHeadless() const noexcept;
+
+private:
+  template<typename Identifier>
+  void load(
+      ResourceHolder<sf::Image, Identifier>& images,
+      ResourceHolder<sf::Texture, Identifier>& textures,
+      Identifier const& id,
+      std::string const& filePath) const;
+
+private:
+  ResourceHolder<sf::Image, Textures::ID> m_images{};
+  ResourceHolder<sf::Texture, Textures::ID> m_textures{};
+  ResourceHolder<sf::Image, std::string> m_file_images{};
+  ResourceHolder<sf::Texture, std::string> m_file_textures{};
+  std::set<std::string> m_file_paths{};
+  bool m_is_headless{false};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "worker_pool.h"
+
+#include "log.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+WorkerPool::WorkerPool()
+  : WorkerPool{std::max(std::thread::hardware_concurrency(), 1u) - 1u}
+{
+}
+
+WorkerPool::WorkerPool(std::size_t thread_count)
+{
+  LOG_DEBUG("Start worker pool with {} threads.", thread_count);
+  m_threads.reserve(thread_count);
+  for (std::size_t i = 0; i < thread_count; ++i)
+    m_threads.emplace_back(&WorkerPool::runWorker, this);
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_stopping = true;
+  }
+  m_job_available.notify_all();
+  for (std::thread& thread : m_threads)
+    thread.join();
+  assert(m_jobs.empty() && "Tasks are still queued.");
+}
+
+void WorkerPool::submit(TaskGroup& group, Task task)
+{
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    ++group.m_pending;
+    m_jobs.push_back(Job{std::move(task), &group});
+  }
+  m_job_available.notify_one();
+}
+
+void WorkerPool::wait(TaskGroup& group) noexcept
+{
+  std::unique_lock<std::mutex> lock{m_mutex};
+  while (group.m_pending > 0)
+  {
+    // Help with the queued tasks of this group instead of sleeping.
+    auto found = std::find_if(m_jobs.begin(), m_jobs.end(), [&](Job& job) {
+      return job.group == &group;
+    });
+    if (found == m_jobs.end())
+    {
+      m_job_done.wait(lock);
+      continue;
+    }
+
+    Job job = std::move(*found);
+    m_jobs.erase(found);
+    lock.unlock();
+    runJob(job);
+    lock.lock();
+  }
+}
+
+std::size_t WorkerPool::getRangeSize(
+    std::size_t count, std::size_t min_range_size) const noexcept
+{
+  std::size_t const max_ranges = m_threads.size() + 1;
+  return std::max(
+      (count + max_ranges - 1) / max_ranges,
+      std::max<std::size_t>(min_range_size, 1));
+}
+
+std::size_t WorkerPool::getThreadCount() const noexcept
+{
+  return m_threads.size();
+}
+
+void WorkerPool::runWorker() noexcept
+{
+  std::unique_lock<std::mutex> lock{m_mutex};
+  while (true)
+  {
+    m_job_available.wait(
+        lock, [this]() { return m_stopping || !m_jobs.empty(); });
+    if (m_jobs.empty())
+      return;
+
+    Job job = std::move(m_jobs.front());
+    m_jobs.pop_front();
+    lock.unlock();
+    runJob(job);
+    lock.lock();
+  }
+}
+
+void WorkerPool::runJob(Job& job) noexcept
+{
+  job.task();
+
+  bool group_done = false;
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    group_done = --job.group->m_pending == 0;
+  }
+  if (group_done)
+    m_job_done.notify_all();
+}
+
+} // namespace FastSimDesign
\ No newline at end of file
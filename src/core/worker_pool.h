@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_WORKER_POOL_H
+#define FAST_SIM_DESIGN_WORKER_POOL_H
+
+#include <SFML/System/NonCopyable.hpp>
+
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FastSimDesign {
+/// Set of tasks submitted to a worker pool that can be waited for together.
+class TaskGroup final : private sf::NonCopyable
+{
+public:
+  explicit TaskGroup() = default;
+  virtual ~TaskGroup() = default;
+
+private:
+  friend class WorkerPool;
+  std::size_t m_pending{0}; // Guarded by the pool mutex.
+};
+
+/// Fixed set of threads running short data-parallel tasks, e.g. chunks of a
+/// particle system. The thread waiting for a group runs queued tasks too, so
+/// a pool without worker (single core machine) still makes progress.
+class WorkerPool final : private sf::NonCopyable
+{
+public:
+  using Task = std::function<void()>;
+
+public:
+  // Default to one worker per hardware thread besides the main one.
+  explicit WorkerPool();
+  explicit WorkerPool(std::size_t thread_count);
+  virtual ~WorkerPool();
+
+  void submit(TaskGroup& group, Task task);
+  void wait(TaskGroup& group) noexcept;
+
+  // Split [0, count) in ranges of `range_size` elements and submit
+  // `task(first, size)` for each one.
+  template<typename Function>
+  void submitRanges(
+      TaskGroup& group,
+      std::size_t count,
+      std::size_t range_size,
+      Function const& task);
+
+  // Size of the ranges splitting `count` elements in at most one range per
+  // thread, of at least `min_range_size` elements.
+  std::size_t getRangeSize(
+      std::size_t count, std::size_t min_range_size) const noexcept;
+  std::size_t getThreadCount() const noexcept;
+
+private:
+  struct Job
+  {
+    Task task;
+    TaskGroup* group;
+  };
+
+private:
+  void runWorker() noexcept;
+  void runJob(Job& job) noexcept;
+
+private:
+  std::vector<std::thread> m_threads{};
+  std::deque<Job> m_jobs{};
+  std::mutex m_mutex{};
+  std::condition_variable m_job_available{};
+  std::condition_variable m_job_done{};
+  bool m_stopping{false};
+};
+
+template<typename Function>
+void WorkerPool::submitRanges(
+    TaskGroup& group,
+    std::size_t count,
+    std::size_t range_size,
+    Function const& task)
+{
+  assert(range_size > 0);
+  for (std::size_t first = 0; first < count; first += range_size)
+  {
+    std::size_t const size =
+        first + range_size < count ? range_size : count - first;
+    submit(group, [task, first, size]() { task(first, size); });
+  }
+}
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -10,30 +10,61 @@
 
 #include "world.h"
 
+#include "../ecs/kinematics.h"
 #include "../entity/aircraft.h"
 #include "../entity/category.h"
+#include "../entity/entity_catalog.h"
+#include "../entity/gameplay_event.h"
+#include "../entity/health_bar_node.h"
 #include "../entity/particle_node.h"
+#include "../entity/particle_renderer.h"
 #include "../entity/pickup.h"
 #include "../entity/sound_node.h"
+#include "../gui/animation_clip.h"
+#include "../gui/bloom_effect.h"
+#include "../gui/cached_layer_node.h"
+#include "../gui/dual_kawase_bloom.h"
+#include "../gui/post_effect.h"
+#include "../gui/software_render_target.h"
 #include "../gui/sprite_node.h"
+#include "../gui/text_renderer.h"
+#include "../gui/tile_layer_node.h"
+#include "../gui/tile_map_cache.h"
 #include "../monitor/frame.h"
 #include "../monitor/monitor.h"
+#include "../monitor/window/camera_window.h"
+#include "../monitor/window/minimap_window.h"
 #include "../monitor/window/scene_graph_window.h"
+#include "../monitor/window/telemetry_window.h"
 #include "../utils/generic_utility.h"
+#include "../utils/math_util.h"
 #include "command.h"
-#include "gui/post_effect.h"
+#include "configuration.h"
+#include "font_holder.h"
+#include "resource_exception.h"
 #include "resource_identifiers.h"
 
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <cassert>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <span>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace FastSimDesign {
+namespace {
+std::string const Background_Map_Path{"../assets/maps/world.tmx"};
+std::string const Background_Cache_Path{"../assets/maps/world.bin"};
+} // namespace
+
 ////////////////////////////////////////////////////////////
 /// SpawnPoint::Methods
 ////////////////////////////////////////////////////////////
@@ -48,34 +79,106 @@ World::SpawnPoint::SpawnPoint(Aircraft::Type type_, float x_, float y_) noexcept
 /// World::Methods
 ////////////////////////////////////////////////////////////
 World::World(
+    Configuration const& configuration,
     SimMonitor::Monitor& monitor,
     sf::RenderWindow& windows,
     FontHolder& fonts,
     SoundPlayer& sounds)
+  : World{configuration, monitor, &windows, windows.getSize(), fonts, sounds}
+{
+}
+
+World::World(
+    Configuration const& configuration,
+    SimMonitor::Monitor& monitor,
+    FontHolder& fonts,
+    SoundPlayer& sounds)
+  : World{
+        configuration,
+        monitor,
+        nullptr,
+        sf::Vector2u{configuration.width, configuration.height},
+        fonts,
+        sounds}
+{
+  assert(fonts.isHeadless() && "Headless world with windowed fonts.");
+}
+
+World::World(
+    Configuration const& configuration,
+    SimMonitor::Monitor& monitor,
+    sf::RenderWindow* window,
+    sf::Vector2u frame_size,
+    FontHolder& fonts,
+    SoundPlayer& sounds)
   : SimMonitor::Monitorable{}
-  , m_window{windows}
-  , m_world_view{m_window.getDefaultView()}
+  , m_window{window}
+  , m_world_view{
+        sf::FloatRect{sf::Vector2f{0.f, 0.f}, sf::Vector2f{frame_size}}}
+  , m_textures{window == nullptr}
   , m_fonts{fonts}
   , m_sounds(sounds)
   , m_monitor{monitor}
+  , m_entity_pool{m_textures, m_fonts}
   , m_world_bounds{0.f, 0.f, m_world_view.getSize().x, 5000.f}
   , m_spawn_position{
         m_world_view.getSize().x / 2.f,
         m_world_bounds.height - m_world_view.getSize().y / 2.f}
 {
-  m_scene_texture.create(m_window.getSize().x, m_window.getSize().y);
+  // Headless, frames go through no post effect.
+  if (m_window)
+  {
+    m_scene_texture.create(frame_size.x, frame_size.y);
+
+    // The classic bloom is kept selectable to compare with the dual filter.
+    if (configuration.bloom_quality == Configuration::BloomQuality::CLASSIC)
+      m_post_effects.addEffect(std::make_unique<BloomEffet>());
+    else
+    {
+      m_post_effects.addEffect(std::make_unique<DualKawaseBloom>(
+          DualKawaseBloom::getPreset(configuration.bloom_quality)));
+    }
+  }
+
+  if (configuration.capture_format != Configuration::CaptureFormat::NONE)
+  {
+    FrameCaptureSettings settings{};
+    settings.directory = configuration.capture_directory;
+    settings.format =
+        configuration.capture_format == Configuration::CaptureFormat::PNG
+            ? FrameCaptureSettings::Format::PNG
+            : FrameCaptureSettings::Format::RAW_ZLIB;
+    m_frame_capture = std::make_unique<FrameCapture>(std::move(settings));
+  }
 
   loadTextures();
+  buildSystems();
   buildScene();
+  if (m_window)
+  {
+    m_minimap = std::make_unique<Minimap>(
+        m_world_bounds, configuration.minimap_refresh_rate);
+  }
 
   // Prepare the view.
   m_world_view.setCenter(m_spawn_position);
+  m_camera.setArea(m_world_bounds, m_world_view.getSize());
 
   // Set model to monitor view.
   m_monitor
       .getWindow<SimMonitor::SceneGraphWindow>(
           SimMonitor::Window::ID::SCENE_GRAPH)
       .setDataModel(&m_scene_graph);
+  m_monitor
+      .getWindow<SimMonitor::CameraWindow>(SimMonitor::Window::ID::CAMERA)
+      .setDataModel(this);
+  m_monitor
+      .getWindow<SimMonitor::TelemetryWindow>(
+          SimMonitor::Window::ID::TELEMETRY)
+      .setDataModel(this);
+  m_monitor
+      .getWindow<SimMonitor::MinimapWindow>(SimMonitor::Window::ID::MINIMAP)
+      .setDataModel(this);
 }
 
 World::~World()
@@ -84,6 +187,16 @@ World::~World()
       .getWindow<SimMonitor::SceneGraphWindow>(
           SimMonitor::Window::ID::SCENE_GRAPH)
       .unsetDataModel();
+  m_monitor
+      .getWindow<SimMonitor::CameraWindow>(SimMonitor::Window::ID::CAMERA)
+      .unsetDataModel();
+  m_monitor
+      .getWindow<SimMonitor::TelemetryWindow>(
+          SimMonitor::Window::ID::TELEMETRY)
+      .unsetDataModel();
+  m_monitor
+      .getWindow<SimMonitor::MinimapWindow>(SimMonitor::Window::ID::MINIMAP)
+      .unsetDataModel();
 }
 
 void World::loadTextures()
@@ -91,7 +204,6 @@ void World::loadTextures()
   m_textures.load(
       Textures::ID::ENTITIES,
       "../assets/sprites/npcs/entities.png");
-  m_textures.load(Textures::ID::JUNGLE, "../assets/sprites/npcs/jungle.png");
   m_textures.load(
       Textures::ID::EXPLOSION,
       "../assets/sprites/npcs/explosion.png");
@@ -103,6 +215,15 @@ void World::loadTextures()
 
 void World::buildScene()
 {
+  // Every node attached from now on registers and resolves its services here.
+  m_services.provide<HandleTable<SceneNode>>(m_nodes);
+  m_services.provide<ECS::Registry>(m_entities);
+  m_services.provide<EventBus>(m_events);
+  m_services.provide<EntityPool>(m_entity_pool);
+  m_services.provide<NodeRecycler>(m_entity_pool);
+  m_services.provide<WorkerPool>(m_workers);
+  m_scene_graph.bindServices(m_services);
+
   // Intilialize the different layers.
   for (std::size_t i = 0;
        i < static_cast<std::size_t>(World::Layer::LAYER_COUNT);
@@ -112,48 +233,112 @@ void World::buildScene()
                                   ? Category::Type::SCENE_AIR_LAYER
                                   : Category::Type::NONE;
 
+    // The background is static, it is drawn from a cached texture while the
+    // view scrolls within its margin.
+    if (i == toUnderlyingType(World::Layer::BACKGROUND))
+    {
+      auto cached_layer = std::make_unique<CachedLayerNode>(category);
+      cached_layer->setCacheEnabled(true);
+      m_scene_layers[i] = &cached_layer->getContent();
+      m_scene_graph.attachChild(std::move(cached_layer));
+      continue;
+    }
+
     SceneNode::Ptr layer = std::make_unique<SceneNode>(category);
     m_scene_layers[i] = layer.get();
 
     m_scene_graph.attachChild(std::move(layer));
   }
 
-  // Prepare the tiled background.
-  sf::Texture& jungle_texture = m_textures.get(Textures::ID::JUNGLE);
-  jungle_texture.setRepeated(true);
-
-  float view_height = m_world_view.getSize().y;
-  sf::IntRect texture_rect{m_world_bounds};
-  texture_rect.height += static_cast<int>(view_height);
+  // Load the background map, with the textures of its tilesets. Its tiles
+  // may be read in place from the mapped cache, kept until the layer nodes
+  // have built their quads.
+  TileMapCache background_cache{};
+  background_cache.load(
+      Background_Map_Path, Background_Cache_Path, &m_workers);
+  TileMap background = background_cache.getMap();
+  for (Tileset& tileset : background.tilesets)
+  {
+    std::string const image = tileset.image.lexically_normal().string();
+    m_textures.load(image);
+    tileset.texture = &m_textures.get(image);
+    tileset.pixels = &m_textures.getImage(image);
+  }
 
-  // Add the background sprite to the scene.
-  std::unique_ptr<SpriteNode> background_sprite =
-      std::make_unique<SpriteNode>(jungle_texture, texture_rect);
-  background_sprite->setPosition(
-      m_world_bounds.left,
-      m_world_bounds.top - view_height);
-  m_scene_layers[static_cast<size_t>(World::Layer::BACKGROUND)]->attachChild(
-      std::move(background_sprite));
+  // Add the visible tile layers of the map to the scene, repeated to cover
+  // the battlefield and the view above its end.
+  float const view_height = m_world_view.getSize().y;
+  sf::Vector2f const map_size{
+      static_cast<float>(background.size.x * background.tile_size.x),
+      static_cast<float>(background.size.y * background.tile_size.y)};
+  if (map_size.x <= 0.f || map_size.y <= 0.f)
+    throw ResourceException{"Empty background map " + Background_Map_Path};
+
+  float const bottom = m_world_bounds.top + m_world_bounds.height;
+  float const right = m_world_bounds.left + m_world_bounds.width;
+  for (float y = m_world_bounds.top - view_height; y < bottom; y += map_size.y)
+  {
+    for (float x = m_world_bounds.left; x < right; x += map_size.x)
+    {
+      for (TileLayer const& layer : background.layers)
+      {
+        if (!layer.visible)
+          continue;
+
+        std::unique_ptr<TileLayerNode> layer_node =
+            std::make_unique<TileLayerNode>(
+                layer, background, m_textures.isHeadless());
+        layer_node->setPosition(x, y);
+        m_scene_layers[static_cast<size_t>(World::Layer::BACKGROUND)]
+            ->attachChild(std::move(layer_node));
+      }
+    }
+  }
 
   // Add the finish line to the scene.
-  sf::Texture& finish_texture = m_textures.get(Textures::ID::FINISH_LINE);
   std::unique_ptr<SpriteNode> finish_sprite =
-      std::make_unique<SpriteNode>(finish_texture);
+      std::make_unique<SpriteNode>(m_textures, Textures::ID::FINISH_LINE);
   finish_sprite->setPosition(0.f, -76.f);
   m_scene_layers[static_cast<size_t>(World::Layer::BACKGROUND)]->attachChild(
       std::move(finish_sprite));
 
-  // Add smoke particle node to the scene.
-  std::unique_ptr<ParticleNode> smoke_node =
-      std::make_unique<ParticleNode>(Particle::Type::SMOKE, m_textures);
+  // Add the renderer of all particle systems, before them so that they find
+  // it when attached.
+  std::unique_ptr<ParticleRenderer> particle_renderer =
+      std::make_unique<ParticleRenderer>(m_textures);
   m_scene_layers[static_cast<std::size_t>(World::Layer::LOWER_AIR)]
-      ->attachChild(std::move(smoke_node));
+      ->attachChild(std::move(particle_renderer));
 
-  // Add propellant particle node to the scene.
-  std::unique_ptr<ParticleNode> propellant_node =
-      std::make_unique<ParticleNode>(Particle::Type::PROPELLANT, m_textures);
-  m_scene_layers[static_cast<std::size_t>(World::Layer::LOWER_AIR)]
-      ->attachChild(std::move(propellant_node));
+  // Add one particle system per particle type of the catalog.
+  std::size_t const particle_count =
+      EntityCatalog::getCurrent().getParticles().size();
+  for (std::size_t i = 0; i < particle_count; ++i)
+  {
+    std::unique_ptr<ParticleNode> particle_node =
+        std::make_unique<ParticleNode>(static_cast<Particle::Type>(i));
+    m_scene_layers[static_cast<std::size_t>(World::Layer::LOWER_AIR)]
+        ->attachChild(std::move(particle_node));
+  }
+
+  // Add the renderer of the entities too small on screen for their sprite,
+  // above them. Entities append their marker while the air layers are drawn.
+  std::unique_ptr<LodRenderer> lod_renderer = std::make_unique<LodRenderer>();
+  m_lod_renderer = lod_renderer.get();
+  m_scene_layers[static_cast<std::size_t>(World::Layer::HUD)]->attachChild(
+      std::move(lod_renderer));
+
+  // Add the health bars of all aircraft, above them.
+  std::unique_ptr<HealthBarNode> health_bars =
+      std::make_unique<HealthBarNode>();
+  m_scene_layers[static_cast<std::size_t>(World::Layer::HUD)]->attachChild(
+      std::move(health_bars));
+
+  // Add the renderer of all texts, above the health bars. Text nodes append
+  // to it while the layers below are drawn.
+  std::unique_ptr<TextRenderer> text_renderer =
+      std::make_unique<TextRenderer>();
+  m_scene_layers[static_cast<std::size_t>(World::Layer::HUD)]->attachChild(
+      std::move(text_renderer));
 
   // Add sound effect node.
   std::unique_ptr<SoundNode> sound_node = std::make_unique<SoundNode>(m_sounds);
@@ -162,26 +347,97 @@ void World::buildScene()
   // Add player's aircraft
   std::unique_ptr<Aircraft> leader =
       std::make_unique<Aircraft>(Aircraft::Type::EAGLE, m_textures, m_fonts);
-  m_player_aircraft = leader.get();
-  m_player_aircraft->setPosition(m_spawn_position);
+  leader->setSimPosition(m_spawn_position);
+  Aircraft& player = *leader;
   m_scene_layers[static_cast<std::size_t>(World::Layer::UPPER_AIR)]
       ->attachChild(std::move(leader));
+  m_player_aircraft = player.getHandle();
 
   // Add enemy aircraft.
   addEnemies();
+  reservePools();
+}
+
+void World::buildSystems()
+{
+  // Integrate velocities of all moving entities, one vectorized pass per
+  // chunk. Wrecks have no velocity, so they are not part of the query.
+  m_scheduler.addSystem(
+      ECS::Scheduler::Phase::UPDATE,
+      ECS::Scheduler::System{
+          "Movement",
+          [this](ECS::Registry& registry, sf::Time const& dt) {
+            float const seconds = dt.asSeconds();
+            registry.query<ECS::Position, ECS::Velocity>()
+                .eachChunk<ECS::Position, ECS::Velocity>(
+                    [seconds](
+                        std::size_t count,
+                        ECS::Position* positions,
+                        ECS::Velocity* velocities) {
+                      ECS::Kinematics::integrate(
+                          positions, velocities, count, seconds);
+                    });
+            m_needs_transform_sync = true;
+          }});
+
+  // Advance all playing animations, one pass per chunk mapping elapsed times
+  // to frames.
+  m_scheduler.addSystem(
+      ECS::Scheduler::Phase::UPDATE,
+      ECS::Scheduler::System{
+          "Animation",
+          [](ECS::Registry& registry, sf::Time const& dt) {
+            float const seconds = dt.asSeconds();
+            registry.query<ECS::AnimationState>()
+                .eachChunk<ECS::AnimationState>(
+                    [seconds](
+                        std::size_t count, ECS::AnimationState* states) {
+                      AnimationClip::advance(states, count, seconds);
+                    });
+          }});
+
+  // Copy simulated positions of moving entities into the scene graph. Other
+  // entities are synced as soon as their position is set.
+  m_scheduler.addSystem(
+      ECS::Scheduler::Phase::PRE_RENDER,
+      ECS::Scheduler::System{
+          "TransformSync",
+          [this](ECS::Registry& registry, sf::Time const&) {
+            registry.query<ECS::Position, ECS::Velocity, ECS::SceneLink>()
+                .each<ECS::Position, ECS::Velocity, ECS::SceneLink>(
+                    [this](
+                        ECS::EntityId,
+                        ECS::Position const& position,
+                        ECS::Velocity const&,
+                        ECS::SceneLink const& link) {
+                      if (SceneNode* node = m_nodes.resolve(link.node))
+                        node->setPosition(position.x, position.y);
+                    });
+          }});
+
+  // Rebuild the health bars of all aircraft in one pass, along with the
+  // transforms.
+  m_scheduler.addSystem(
+      ECS::Scheduler::Phase::PRE_RENDER,
+      ECS::Scheduler::System{
+          "HealthBars",
+          [this](ECS::Registry& registry, sf::Time const&) {
+            if (HealthBarNode* health_bars = m_services.find<HealthBarNode>())
+              health_bars->rebuild(registry);
+          }});
 }
 
 void World::addEnemies() noexcept
 {
-  // Add enemies to the spawn point container.
-  addEnemy(Aircraft::Type::RAPTOR, 0.f, 500.f);
-  addEnemy(Aircraft::Type::RAPTOR, 0.f, 1000.f);
-  addEnemy(Aircraft::Type::RAPTOR, 100.f, 1100.f);
-  addEnemy(Aircraft::Type::RAPTOR, -100.f, 1100.f);
-  addEnemy(Aircraft::Type::AVENGER, -70.f, 1400.f);
-  addEnemy(Aircraft::Type::AVENGER, -70.f, 1600.f);
-  addEnemy(Aircraft::Type::AVENGER, 70.f, 1400.f);
-  addEnemy(Aircraft::Type::AVENGER, 70.f, 1600.f);
+  // Add enemies to the spawn point container, from the spawns of each
+  // aircraft type of the catalog.
+  EntityCatalog const& catalog = EntityCatalog::getCurrent();
+  std::span<AircraftData const> const aircrafts = catalog.getAircrafts();
+  for (std::size_t i = 0; i < aircrafts.size(); ++i)
+  {
+    for (SpawnOffset const& spawn : catalog.getSpawns(aircrafts[i]))
+      addEnemy(static_cast<Aircraft::Type>(i), spawn.x, spawn.y);
+  }
 
   // Sort all enemies according to their y value, such that lower enemies are
   // checked first for spawning.
@@ -193,6 +449,24 @@ void World::addEnemies() noexcept
       });
 }
 
+void World::reservePools()
+{
+  // Clone every enemy and a first batch of bullets while loading, spawning a
+  // wave then only resets pooled instances.
+  std::vector<std::size_t> enemy_counts(
+      EntityCatalog::getCurrent().getAircrafts().size());
+  for (SpawnPoint const& spawn : m_enemy_spawn_points)
+    ++enemy_counts[toUnderlyingType(spawn.type)];
+
+  for (std::size_t i = 0; i < enemy_counts.size(); ++i)
+  {
+    if (enemy_counts[i] > 0)
+      m_entity_pool.reserve(static_cast<Aircraft::Type>(i), enemy_counts[i]);
+  }
+  m_entity_pool.reserve(Projectile::Type::ALLIED_BULLET, 32);
+  m_entity_pool.reserve(Projectile::Type::ENEMY_BULLET, 32);
+}
+
 void World::addEnemy(Aircraft::Type type, float rel_x, float rel_y) noexcept
 {
   SpawnPoint spawn{
@@ -204,9 +478,21 @@ void World::addEnemy(Aircraft::Type type, float rel_x, float rel_y) noexcept
 
 void World::update(sf::Time const& dt)
 {
+  // Bring scene nodes up to date with the last movement step.
+  syncTransforms();
+
+  // Zoom chosen from the monitor.
+  if (std::optional<float> zoom =
+          m_monitor
+              .getWindow<SimMonitor::CameraWindow>(
+                  SimMonitor::Window::ID::CAMERA)
+              .takeZoomRequest())
+    m_camera.setZoom(*zoom);
+
   // Scroll the world, reset player velocity.
   m_world_view.move(0.f, m_scroll_speed * dt.asSeconds());
-  m_player_aircraft->setVelocity(0.f, 0.f);
+  if (Aircraft* player = getPlayerAircraft())
+    player->setVelocity(0.f, 0.f);
 
   // Setup commands to destroy entities, and guide missiles.
   destroyEntitiesOusideView();
@@ -218,39 +504,98 @@ void World::update(sf::Time const& dt)
     m_scene_graph.onCommand(m_command_queue.pop(), dt);
   adaptPlayerVelocity();
 
-  // Collision detection and response (may destroy entities).
+  // Collision detection, then publish the events of this phase and the
+  // previous tick so that responses (may destroy entities) and consumers
+  // process them in batch.
   handleCollisions();
+  m_events.swapBuffers();
+  applyCollisionResponses();
+  updateStatistics();
 
   // Remove all destroyed entities, create new ones.
   m_scene_graph.removeWrecks();
   spawnEnemies();
 
-  // Regular update step, adapt position (correct if outside view)
+  // Regular update step, then systems, adapt position (correct if outside
+  // view)
+  updateParticleViews();
   m_scene_graph.update(dt, m_command_queue);
+  m_scheduler.run(ECS::Scheduler::Phase::UPDATE, m_entities, dt);
+  m_scheduler.run(ECS::Scheduler::Phase::POST_UPDATE, m_entities, dt);
   adaptPlayerPosition();
 
   updateSounds();
+  updateMinimap(dt);
 }
 
 void World::draw()
 {
+  assert(m_window && "Headless world drawn on a window.");
+  syncTransforms();
+  finishParticleUpdates();
+
   if (PostEffect::isSupported())
   {
     m_scene_texture.clear();
-    m_scene_texture.setView(m_world_view);
+    m_scene_texture.setView(m_camera.getView(m_world_view));
+    prepareParticleDraw(LodRenderer::getPixelScale(m_scene_texture));
     m_scene_texture.draw(m_scene_graph);
     m_scene_texture.display();
-    m_bloom_effect.apply(m_scene_texture, m_window);
+    if (m_frame_capture)
+      m_frame_capture->capture(m_scene_texture.getTexture());
+    m_post_effects.apply(m_scene_texture, *m_window);
   }
   else
   {
-    m_window.setView(m_world_view);
-    m_window.draw(m_scene_graph);
+    m_window->setView(m_camera.getView(m_world_view));
+    prepareParticleDraw(LodRenderer::getPixelScale(*m_window));
+    m_window->draw(m_scene_graph);
+    if (m_frame_capture)
+      m_frame_capture->capture(*m_window);
   }
 }
 
-void World::monitorState(SimMonitor::Monitor&, SimMonitor::Frame::World&) const
+void World::draw(SoftwareRenderTarget& target)
+{
+  syncTransforms();
+  finishParticleUpdates();
+
+  target.clear();
+  target.setView(m_camera.getView(m_world_view));
+  prepareParticleDraw(LodRenderer::getPixelScale(target));
+  target.draw(m_scene_graph);
+  target.display();
+  if (m_frame_capture)
+    m_frame_capture->capture(target.copyToImage());
+}
+
+void World::zoomCamera(float wheel_delta) noexcept
 {
+  m_camera.zoomBy(wheel_delta);
+}
+
+void World::monitorState(
+    SimMonitor::Monitor&, SimMonitor::Frame::World& frame_object) const
+{
+  frame_object.entity_count = m_entities.getEntityCount();
+  frame_object.archetype_count = m_entities.getArchetypeCount();
+  frame_object.camera_zoom = m_camera.getZoom();
+  frame_object.camera_max_zoom = m_camera.getMaxZoom();
+  if (m_lod_renderer)
+  {
+    LodRenderer::Statistics const lod = m_lod_renderer->getStatistics();
+    frame_object.lod_quad_count = lod.quad_count;
+    frame_object.lod_point_count = lod.point_count;
+  }
+  frame_object.collision_count = m_statistics.collision_count;
+  frame_object.destroyed_count = m_statistics.destroyed_count;
+  frame_object.collected_pickup_count = m_statistics.collected_pickup_count;
+}
+
+void World::monitorState(
+    SimMonitor::Monitor&, SimMonitor::Frame::Minimap& frame_object) const
+{
+  frame_object.texture = m_minimap ? &m_minimap->getTexture() : nullptr;
 }
 
 CommandQueue& World::getCommandQueue() noexcept
@@ -260,16 +605,22 @@ CommandQueue& World::getCommandQueue() noexcept
 
 bool World::hasAlivePlayer() const noexcept
 {
-  return !m_player_aircraft->isMarkedForRemoval();
+  Aircraft const* player = getPlayerAircraft();
+  return player && !player->isMarkedForRemoval();
 }
 
 bool World::hasPlayerReachedEnd() const
 {
-  return !m_world_bounds.contains(m_player_aircraft->getPosition());
+  Aircraft const* player = getPlayerAircraft();
+  return player && !m_world_bounds.contains(player->getSimPosition());
 }
 
 void World::adaptPlayerPosition()
 {
+  Aircraft* player = getPlayerAircraft();
+  if (!player)
+    return;
+
   // Keep player's position inside the screen bounds, at least borderDistance
   // units from the border.
   sf::FloatRect view_bounds{
@@ -277,7 +628,7 @@ void World::adaptPlayerPosition()
       m_world_view.getSize()};
   float const border_distance = 40.f;
 
-  sf::Vector2f position = m_player_aircraft->getPosition();
+  sf::Vector2f position = player->getSimPosition();
   position.x = std::max(position.x, view_bounds.left + border_distance);
   position.x = std::min(
       position.x,
@@ -286,28 +637,61 @@ void World::adaptPlayerPosition()
   position.y = std::min(
       position.y,
       view_bounds.top + view_bounds.height - border_distance);
-  m_player_aircraft->setPosition(position);
+  player->setSimPosition(position);
 }
 
 void World::adaptPlayerVelocity() noexcept
 {
-  sf::Vector2f velocity = m_player_aircraft->getVelocity();
+  Aircraft* player = getPlayerAircraft();
+  if (!player)
+    return;
+
+  sf::Vector2f velocity = player->getVelocity();
 
   // If moving diagonally, reduce velocity (to have always same velocity).
   if (velocity.x != 0.f && velocity.y != 0.f)
-    m_player_aircraft->setVelocity(velocity / std::sqrt(2.f));
+    player->setVelocity(velocity / std::sqrt(2.f));
 
   // Add scrolling velocity.
-  m_player_aircraft->accelerate(0.f, m_scroll_speed);
+  player->accelerate(0.f, m_scroll_speed);
 }
 
-void World::handleCollisions() noexcept
+void World::handleCollisions()
 {
   std::set<SceneNode::Pair> collision_pairs;
   m_scene_graph.checkSceneCollision(m_scene_graph, collision_pairs);
 
   for (SceneNode::Pair pair : collision_pairs)
   {
+    m_events.publish(GameplayEvent::Collided{
+        pair.first->getHandle(),
+        pair.second->getHandle()});
+
+    // Published before the swap, so that consumers see the pickup collected
+    // in the tick of the collision.
+    if (matchesCategories(
+            pair,
+            BitFlags<Category::Type>{Category::Type::PLAYER_AIRCRAFT},
+            BitFlags<Category::Type>{Category::Type::PICKUP}))
+    {
+      m_events.publish(GameplayEvent::PickupCollected{
+          static_cast<Pickup&>(*pair.second).getType(),
+          pair.first->getWorldPosition()});
+    }
+  }
+}
+
+void World::applyCollisionResponses() noexcept
+{
+  for (GameplayEvent::Collided const& collided :
+       m_events.read<GameplayEvent::Collided>())
+  {
+    SceneNode::Pair pair{
+        m_nodes.resolve(collided.a),
+        m_nodes.resolve(collided.b)};
+    if (!pair.first || !pair.second)
+      continue;
+
     if (matchesCategories(
             pair,
             BitFlags<Category::Type>{Category::Type::PLAYER_AIRCRAFT},
@@ -331,7 +715,6 @@ void World::handleCollisions() noexcept
       // Apply pickup effect to player, destroy projectile.
       pickup.apply(player);
       pickup.destroy();
-      player.playLocalSound(m_command_queue, SoundEffect::ID::COLLECT_PICKUP);
     }
     else if (
         matchesCategories(
@@ -353,10 +736,86 @@ void World::handleCollisions() noexcept
   }
 }
 
+void World::updateStatistics() noexcept
+{
+  m_statistics.collision_count +=
+      m_events.read<GameplayEvent::Collided>().size();
+  m_statistics.destroyed_count +=
+      m_events.read<GameplayEvent::Destroyed>().size();
+  m_statistics.collected_pickup_count +=
+      m_events.read<GameplayEvent::PickupCollected>().size();
+}
+
+void World::updateParticleViews() noexcept
+{
+  // Particle systems cull and scale their emission against the view they
+  // are drawn with.
+  sf::FloatRect const view_bounds = m_camera.getViewBounds(m_world_view);
+  std::size_t const particle_count =
+      EntityCatalog::getCurrent().getParticles().size();
+  for (std::size_t i = 0; i < particle_count; ++i)
+  {
+    if (ParticleNode* particle_system =
+            m_services.find<ParticleNode>(static_cast<std::uint32_t>(i)))
+      particle_system->setViewBounds(view_bounds);
+  }
+}
+
+void World::finishParticleUpdates()
+{
+  // Particle systems update on the worker pool since the scene graph update.
+  std::size_t const particle_count =
+      EntityCatalog::getCurrent().getParticles().size();
+  for (std::size_t i = 0; i < particle_count; ++i)
+  {
+    if (ParticleNode* particle_system =
+            m_services.find<ParticleNode>(static_cast<std::uint32_t>(i)))
+      particle_system->finishUpdate();
+  }
+}
+
+void World::prepareParticleDraw(float pixel_scale)
+{
+  // The renderer picks the particle types drawn at this zoom and packs their
+  // quads outside of the const draw pass.
+  if (ParticleRenderer* particle_renderer = m_services.find<ParticleRenderer>())
+    particle_renderer->prepareDraw(pixel_scale);
+}
+
+void World::updateMinimap(sf::Time const& dt)
+{
+  // The minimap is only refreshed while it is watched from the monitor.
+  if (!m_minimap || !m_monitor
+                         .getWindow<SimMonitor::MinimapWindow>(
+                             SimMonitor::Window::ID::MINIMAP)
+                         .isVisible())
+    return;
+
+  m_minimap->update(
+      dt,
+      *m_scene_layers[static_cast<std::size_t>(World::Layer::BACKGROUND)],
+      m_entities,
+      m_camera.getViewBounds(m_world_view));
+}
+
 void World::updateSounds() noexcept
 {
+  // Play sounds of the events published during the previous tick.
+  for (GameplayEvent::Destroyed const& destroyed :
+       m_events.read<GameplayEvent::Destroyed>())
+  {
+    SoundEffect::ID sound_effect = (Math::randomInt(2) == 0)
+                                       ? SoundEffect::ID::EXPLOSION_1
+                                       : SoundEffect::ID::EXPLOSION_2;
+    m_sounds.play(sound_effect, destroyed.position);
+  }
+  for (GameplayEvent::PickupCollected const& collected :
+       m_events.read<GameplayEvent::PickupCollected>())
+    m_sounds.play(SoundEffect::ID::COLLECT_PICKUP, collected.position);
+
   // Set Listener's position to player position.
-  m_sounds.setListenerPosition(m_player_aircraft->getWorldPosition());
+  if (Aircraft const* player = getPlayerAircraft())
+    m_sounds.setListenerPosition(player->getSimPosition());
 
   // Remove unused sounds.
   m_sounds.removeStoppedSounds();
@@ -394,9 +853,8 @@ void World::spawnEnemies() noexcept
   {
     SpawnPoint spawn = m_enemy_spawn_points.back();
 
-    std::unique_ptr<Aircraft> enemy =
-        std::make_unique<Aircraft>(spawn.type, m_textures, m_fonts);
-    enemy->setPosition(spawn.x, spawn.y);
+    std::unique_ptr<Aircraft> enemy = m_entity_pool.acquire(
+        spawn.type, sf::Vector2f{spawn.x, spawn.y});
     enemy->setRotation(180.f);
     m_scene_layers[static_cast<std::size_t>(World::Layer::UPPER_AIR)]
         ->attachChild(std::move(enemy));
@@ -431,7 +889,7 @@ void World::guideMissiles() noexcept
   enemy_collector.action =
       derivedAction<Aircraft>([this](Aircraft& enemy, sf::Time) {
         if (!enemy.isDestroyed())
-          m_active_enemies.push_back(&enemy);
+          m_active_enemies.push_back(enemy.getHandle());
       });
 
   // Setup command that guides all missiles to the enemy which is currently
@@ -450,8 +908,12 @@ void World::guideMissiles() noexcept
         Aircraft const* closest_enemy = nullptr;
 
         // Find closest enemy.
-        for (auto const& enemy : m_active_enemies)
+        for (Handle const& handle : m_active_enemies)
         {
+          Aircraft const* enemy = resolveAircraft(handle);
+          if (!enemy)
+            continue;
+
           float enemy_distance = distance(missile, *enemy);
           if (enemy_distance < min_distance)
           {
@@ -470,6 +932,29 @@ void World::guideMissiles() noexcept
   m_active_enemies.clear();
 }
 
+void World::syncTransforms()
+{
+  // Scene nodes are only needed up to date for commands, collisions and
+  // rendering.
+  if (!m_needs_transform_sync)
+    return;
+
+  m_scheduler.run(ECS::Scheduler::Phase::PRE_RENDER, m_entities, sf::Time{});
+  m_needs_transform_sync = false;
+}
+
+Aircraft* World::getPlayerAircraft() const noexcept
+{
+  return resolveAircraft(m_player_aircraft);
+}
+
+Aircraft* World::resolveAircraft(Handle handle) const noexcept
+{
+  SceneNode* node = m_nodes.resolve(handle);
+  assert(node == nullptr || dynamic_cast<Aircraft*>(node) != nullptr);
+  return static_cast<Aircraft*>(node);
+}
+
 sf::FloatRect World::getViewBounds() const noexcept
 {
   return sf::FloatRect(
@@ -13,13 +13,25 @@
 #ifndef FAST_SIM_DESIGN_WORLD_H
 #define FAST_SIM_DESIGN_WORLD_H
 
+#include "../ecs/registry.h"
+#include "../ecs/scheduler.h"
 #include "../entity/aircraft.h"
-#include "../gui/bloom_effect.h"
+#include "../entity/entity_pool.h"
+#include "../gui/camera.h"
+#include "../gui/frame_capture.h"
+#include "../gui/lod_renderer.h"
+#include "../gui/minimap.h"
+#include "../gui/post_process_chain.h"
 #include "../gui/scene_node.h"
 #include "../monitor/monitorable.h"
 #include "command_queue.h"
+#include "event_bus.h"
+#include "handle.h"
 #include "resource_identifiers.h"
+#include "service_registry.h"
 #include "sound_player.h"
+#include "texture_holder.h"
+#include "worker_pool.h"
 
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/RenderTexture.hpp>
@@ -27,13 +39,16 @@
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace sf {
 class RenderWindow;
 }
 namespace FastSimDesign {
+struct Configuration;
 class Aircraft;
+class SoftwareRenderTarget;
 class World final
   : private sf::NonCopyable
   , public SimMonitor::Monitorable
@@ -44,6 +59,7 @@ public:
     BACKGROUND,
     LOWER_AIR,
     UPPER_AIR,
+    HUD,
     LAYER_COUNT,
   };
   struct SpawnPoint
@@ -65,69 +81,126 @@ public:
 
 public:
   explicit World(
+      Configuration const& configuration,
       SimMonitor::Monitor& monitor,
       sf::RenderWindow& windows,
       FontHolder& fonts,
       SoundPlayer& sounds);
+  // Headless, without window nor OpenGL context, the frames being of the
+  // size of the configuration and drawn only on a software render target.
+  // The fonts must be headless too.
+  explicit World(
+      Configuration const& configuration,
+      SimMonitor::Monitor& monitor,
+      FontHolder& fonts,
+      SoundPlayer& sounds);
   virtual ~World();
 
   void update(sf::Time const& dt);
+  // Draw on the window, not when headless.
   void draw();
+  void draw(SoftwareRenderTarget& target);
+  // Zoom the camera by notches of the mouse wheel, in for positive ones.
+  void zoomCamera(float wheel_delta) noexcept;
   CommandQueue& getCommandQueue() noexcept;
 
   virtual void monitorState(
       SimMonitor::Monitor& monitor,
       SimMonitor::Frame::World& frame_object) const override final;
+  virtual void monitorState(
+      SimMonitor::Monitor& monitor,
+      SimMonitor::Frame::Minimap& frame_object) const override final;
 
   bool hasAlivePlayer() const noexcept;
   bool hasPlayerReachedEnd() const;
 
 protected:
 private:
+  explicit World(
+      Configuration const& configuration,
+      SimMonitor::Monitor& monitor,
+      sf::RenderWindow* window,
+      sf::Vector2u frame_size,
+      FontHolder& fonts,
+      SoundPlayer& sounds);
+
   void loadTextures();
   void buildScene();
+  void buildSystems();
+  void syncTransforms();
   void adaptPlayerPosition();
   void adaptPlayerVelocity() noexcept;
-  void handleCollisions() noexcept;
+  void handleCollisions();
+  void applyCollisionResponses() noexcept;
+  void updateStatistics() noexcept;
   void updateSounds() noexcept;
+  void updateParticleViews() noexcept;
+  void finishParticleUpdates();
+  void prepareParticleDraw(float pixel_scale);
+  void updateMinimap(sf::Time const& dt);
   bool matchesCategories(
       SceneNode::Pair& colliders,
       BitFlags<Category::Type> type_1,
       BitFlags<Category::Type> type_2) const noexcept;
 
   void addEnemies() noexcept;
+  void reservePools();
   void addEnemy(Aircraft::Type type, float rel_x, float rel_y) noexcept;
   void spawnEnemies() noexcept;
   void destroyEntitiesOusideView() noexcept;
   void guideMissiles() noexcept;
+  Aircraft* getPlayerAircraft() const noexcept;
+  // Null if the aircraft has been destroyed or recycled since.
+  Aircraft* resolveAircraft(Handle handle) const noexcept;
   sf::FloatRect getViewBounds() const noexcept;
   sf::FloatRect getBattlefieldBounds() const noexcept;
 
 public:
 protected:
 private:
-  sf::RenderWindow& m_window;
-  sf::RenderTexture m_scene_texture{};
-  sf::View m_world_view{};
-  TextureHolder m_textures{};
+  struct Statistics
+  {
+    std::size_t collision_count{0};
+    std::size_t destroyed_count{0};
+    std::size_t collected_pickup_count{0};
+  };
+
+private:
+  sf::RenderWindow* m_window{nullptr}; // Null when headless.
+  sf::RenderTexture m_scene_texture{}; // Not created when headless.
+  sf::View m_world_view{}; // Followed by the simulation.
+  Camera m_camera{}; // Zooms the world view for drawing only.
+  TextureHolder m_textures;
   FontHolder& m_fonts;
   SoundPlayer& m_sounds;
   SimMonitor::Monitor& m_monitor;
 
+  ServiceRegistry m_services{};
+  WorkerPool m_workers{};
+  HandleTable<SceneNode> m_nodes{};
+  ECS::Registry m_entities{};
+  ECS::Scheduler m_scheduler{};
+  bool m_needs_transform_sync{false};
+  EventBus m_events{};
+  Statistics m_statistics{};
+  EntityPool m_entity_pool;
   SceneNode m_scene_graph{};
   std::array<SceneNode*, static_cast<std::size_t>(Layer::LAYER_COUNT)>
       m_scene_layers{};
   CommandQueue m_command_queue{};
+  LodRenderer const* m_lod_renderer{nullptr};
 
   sf::FloatRect m_world_bounds{};
   sf::Vector2f m_spawn_position{};
   float m_scroll_speed{-50.f};
-  Aircraft* m_player_aircraft{nullptr};
+  Handle m_player_aircraft{};
 
   std::vector<SpawnPoint> m_enemy_spawn_points{};
-  std::vector<Aircraft*> m_active_enemies{};
+  std::vector<Handle> m_active_enemies{};
 
-  BloomEffet m_bloom_effect{};
+  PostProcessChain m_post_effects{};
+  std::unique_ptr<FrameCapture> m_frame_capture{}; // Null when not recording.
+  std::unique_ptr<Minimap> m_minimap{}; // Null when headless.
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "archetype.h"
+
+#include <cstring>
+#include <new>
+
+namespace FastSimDesign {
+namespace ECS {
+namespace {
+constexpr std::size_t alignOffset(std::size_t offset, std::size_t alignment)
+{
+  return (offset + alignment - 1) / alignment * alignment;
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Archetype::ChunkDeleter::Methods
+////////////////////////////////////////////////////////////
+void Archetype::ChunkDeleter::operator()(std::byte* data) const noexcept
+{
+  ::operator delete(data, std::align_val_t{Column_Alignment});
+}
+
+////////////////////////////////////////////////////////////
+/// Archetype::Methods
+////////////////////////////////////////////////////////////
+Archetype::Archetype(ComponentMask mask)
+  : m_mask{mask}
+{
+  for (ComponentId id = 0; id < Max_Components; ++id)
+  {
+    if (m_mask & toMask(id))
+      m_components.push_back(id);
+  }
+  computeLayout();
+}
+
+ComponentMask Archetype::getMask() const noexcept
+{
+  return m_mask;
+}
+
+bool Archetype::hasComponent(ComponentId id) const noexcept
+{
+  return (m_mask & toMask(id)) != 0;
+}
+
+std::span<ComponentId const> Archetype::getComponents() const noexcept
+{
+  return m_components;
+}
+
+std::size_t Archetype::getChunkCapacity() const noexcept
+{
+  return m_chunk_capacity;
+}
+
+std::size_t Archetype::getChunkCount() const noexcept
+{
+  return m_chunks.size();
+}
+
+std::size_t Archetype::getSize() const noexcept
+{
+  return m_size;
+}
+
+Archetype::Location Archetype::allocate(EntityId entity)
+{
+  if (m_chunks.empty() || m_chunks.back().count == m_chunk_capacity)
+  {
+    Chunk chunk;
+    chunk.data.reset(static_cast<std::byte*>(::operator new(
+        Chunk_Size, std::align_val_t{Column_Alignment})));
+    m_chunks.push_back(std::move(chunk));
+  }
+
+  std::size_t chunk_index = m_chunks.size() - 1;
+  Chunk& chunk = m_chunks.back();
+  Location location{
+      static_cast<std::uint32_t>(chunk_index),
+      static_cast<std::uint32_t>(chunk.count)};
+
+  getEntityColumn(chunk_index)[chunk.count] = entity;
+  ++chunk.count;
+  ++m_size;
+  return location;
+}
+
+EntityId Archetype::remove(Location location) noexcept
+{
+  assert(location.chunk < m_chunks.size());
+  assert(location.row < m_chunks[location.chunk].count);
+
+  // Keep chunks dense by filling the hole with the very last row.
+  Location last{
+      static_cast<std::uint32_t>(m_chunks.size() - 1),
+      static_cast<std::uint32_t>(m_chunks.back().count - 1)};
+
+  EntityId moved{};
+  if (location.chunk != last.chunk || location.row != last.row)
+  {
+    copyRow(last, *this, location);
+    moved = getEntityColumn(last.chunk)[last.row];
+    getEntityColumn(location.chunk)[location.row] = moved;
+  }
+
+  --m_chunks.back().count;
+  if (m_chunks.back().count == 0)
+    m_chunks.pop_back();
+  --m_size;
+  return moved;
+}
+
+void Archetype::copyRow(
+    Location from, Archetype& destination, Location to) const noexcept
+{
+  std::byte const* source = m_chunks[from.chunk].data.get();
+  std::byte* target = destination.m_chunks[to.chunk].data.get();
+
+  for (ComponentId id : m_components)
+  {
+    std::int32_t target_offset = destination.m_column_offsets[id];
+    if (target_offset == No_Column)
+      continue;
+
+    std::size_t size = getComponentInfo(id).size;
+    std::memcpy(
+        target + target_offset + to.row * size,
+        source + m_column_offsets[id] + from.row * size,
+        size);
+  }
+}
+
+std::size_t Archetype::getCount(std::size_t chunk) const noexcept
+{
+  assert(chunk < m_chunks.size());
+  return m_chunks[chunk].count;
+}
+
+std::span<EntityId const> Archetype::getEntities(
+    std::size_t chunk) const noexcept
+{
+  return std::span<EntityId const>{
+      getEntityColumn(chunk),
+      m_chunks[chunk].count};
+}
+
+void* Archetype::getComponent(Location location, ComponentId id) noexcept
+{
+  std::byte* column = static_cast<std::byte*>(getColumn(location.chunk, id));
+  if (!column)
+    return nullptr;
+  return column + location.row * getComponentInfo(id).size;
+}
+
+void* Archetype::getColumn(std::size_t chunk, ComponentId id) noexcept
+{
+  assert(chunk < m_chunks.size());
+  if (m_column_offsets[id] == No_Column)
+    return nullptr;
+  return m_chunks[chunk].data.get() + m_column_offsets[id];
+}
+
+Archetype* Archetype::getAddEdge(ComponentId id) const noexcept
+{
+  auto found = m_add_edges.find(id);
+  return found != m_add_edges.end() ? found->second : nullptr;
+}
+
+Archetype* Archetype::getRemoveEdge(ComponentId id) const noexcept
+{
+  auto found = m_remove_edges.find(id);
+  return found != m_remove_edges.end() ? found->second : nullptr;
+}
+
+void Archetype::setAddEdge(ComponentId id, Archetype& archetype)
+{
+  m_add_edges[id] = &archetype;
+}
+
+void Archetype::setRemoveEdge(ComponentId id, Archetype& archetype)
+{
+  m_remove_edges[id] = &archetype;
+}
+
+void Archetype::computeLayout()
+{
+  std::size_t row_size = sizeof(EntityId);
+  for (ComponentId id : m_components)
+    row_size += getComponentInfo(id).size;
+
+  // Shrink the capacity until every column fits with its alignment padding.
+  auto layout_size = [this](std::size_t capacity) {
+    std::size_t offset = capacity * sizeof(EntityId);
+    for (ComponentId id : m_components)
+    {
+      offset = alignOffset(offset, Column_Alignment);
+      offset += capacity * getComponentInfo(id).size;
+    }
+    return offset;
+  };
+
+  m_chunk_capacity = Chunk_Size / row_size;
+  while (m_chunk_capacity > 1 && layout_size(m_chunk_capacity) > Chunk_Size)
+    --m_chunk_capacity;
+  assert(layout_size(m_chunk_capacity) <= Chunk_Size);
+
+  m_column_offsets.fill(No_Column);
+  std::size_t offset = m_chunk_capacity * sizeof(EntityId);
+  for (ComponentId id : m_components)
+  {
+    assert(getComponentInfo(id).alignment <= Column_Alignment);
+    offset = alignOffset(offset, Column_Alignment);
+    m_column_offsets[id] = static_cast<std::int32_t>(offset);
+    offset += m_chunk_capacity * getComponentInfo(id).size;
+  }
+}
+
+EntityId* Archetype::getEntityColumn(std::size_t chunk) const noexcept
+{
+  assert(chunk < m_chunks.size());
+  // The entity column is always at the beginning of the chunk.
+  return reinterpret_cast<EntityId*>(m_chunks[chunk].data.get());
+}
+} // namespace ECS
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ECS_ARCHETYPE_H
+#define FAST_SIM_DESIGN_ECS_ARCHETYPE_H
+
+#include "component.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace FastSimDesign {
+namespace ECS {
+/// Storage of all entities sharing the same set of components. Entities are
+/// packed in fixed-size chunks, and each chunk stores one contiguous column
+/// per component (structure of arrays), aligned on a cache line.
+class Archetype final
+{
+public:
+  static constexpr std::size_t Chunk_Size = 16 * 1024;
+  static constexpr std::size_t Column_Alignment = 64;
+
+  struct Location
+  {
+    std::uint32_t chunk{0};
+    std::uint32_t row{0};
+  };
+
+public:
+  explicit Archetype(ComponentMask mask);
+  Archetype(Archetype const&) = delete;
+  Archetype(Archetype&&) = default;
+  Archetype& operator=(Archetype const&) = delete;
+  Archetype& operator=(Archetype&&) = default;
+  virtual ~Archetype() = default;
+
+  ComponentMask getMask() const noexcept;
+  bool hasComponent(ComponentId id) const noexcept;
+  std::span<ComponentId const> getComponents() const noexcept;
+  std::size_t getChunkCapacity() const noexcept;
+  std::size_t getChunkCount() const noexcept;
+  std::size_t getSize() const noexcept;
+
+  // Reserve a row for the entity, its components are left uninitialized.
+  Location allocate(EntityId entity);
+  // Remove the row by moving the last row of the archetype into it. Return the
+  // entity that has been moved, or an invalid id if no row has moved.
+  EntityId remove(Location location) noexcept;
+  // Copy the components shared with the destination row.
+  void copyRow(
+      Location from, Archetype& destination, Location to) const noexcept;
+
+  std::size_t getCount(std::size_t chunk) const noexcept;
+  std::span<EntityId const> getEntities(std::size_t chunk) const noexcept;
+  void* getComponent(Location location, ComponentId id) noexcept;
+  void* getColumn(std::size_t chunk, ComponentId id) noexcept;
+
+  template<typename T>
+  T* getColumn(std::size_t chunk) noexcept
+  {
+    return static_cast<T*>(getColumn(chunk, componentId<T>()));
+  }
+
+  // Graph edges to the archetypes with one more or one less component.
+  Archetype* getAddEdge(ComponentId id) const noexcept;
+  Archetype* getRemoveEdge(ComponentId id) const noexcept;
+  void setAddEdge(ComponentId id, Archetype& archetype);
+  void setRemoveEdge(ComponentId id, Archetype& archetype);
+
+private:
+  struct ChunkDeleter
+  {
+    void operator()(std::byte* data) const noexcept;
+  };
+
+  struct Chunk
+  {
+    std::unique_ptr<std::byte[], ChunkDeleter> data{};
+    std::size_t count{0};
+  };
+
+private:
+  void computeLayout();
+  EntityId* getEntityColumn(std::size_t chunk) const noexcept;
+
+private:
+  static constexpr std::int32_t No_Column = -1;
+
+  ComponentMask m_mask{0};
+  std::vector<ComponentId> m_components{};
+  std::array<std::int32_t, Max_Components> m_column_offsets{};
+  std::size_t m_chunk_capacity{0};
+  std::vector<Chunk> m_chunks{};
+  std::size_t m_size{0};
+
+  std::unordered_map<ComponentId, Archetype*> m_add_edges{};
+  std::unordered_map<ComponentId, Archetype*> m_remove_edges{};
+};
+} // namespace ECS
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "component.h"
+
+#include <array>
+#include <cassert>
+#include <mutex>
+
+namespace FastSimDesign {
+namespace ECS {
+namespace {
+struct ComponentTable
+{
+  std::mutex mutex{};
+  std::array<ComponentInfo, Max_Components> infos{};
+  std::size_t count{0};
+};
+
+ComponentTable& getComponentTable()
+{
+  static ComponentTable table;
+  return table;
+}
+} // namespace
+
+ComponentId registerComponent(std::size_t size, std::size_t alignment)
+{
+  ComponentTable& table = getComponentTable();
+  std::lock_guard<std::mutex> lock{table.mutex};
+
+  assert(table.count < Max_Components);
+  table.infos[table.count] = ComponentInfo{size, alignment};
+  return static_cast<ComponentId>(table.count++);
+}
+
+ComponentInfo const& getComponentInfo(ComponentId id) noexcept
+{
+  // Infos are never moved nor removed once registered.
+  ComponentTable& table = getComponentTable();
+  assert(id < Max_Components);
+  return table.infos[id];
+}
+} // namespace ECS
+} // namespace FastSimDesign
\ No newline at end of file
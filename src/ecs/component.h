@@ -0,0 +1,64 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ECS_COMPONENT_H
+#define FAST_SIM_DESIGN_ECS_COMPONENT_H
+
+#include "../core/handle.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace FastSimDesign {
+namespace ECS {
+using EntityId = Handle;
+using ComponentId = std::uint16_t;
+
+// One bit per component type, an archetype is identified by its mask.
+using ComponentMask = std::uint64_t;
+inline constexpr std::size_t Max_Components = 64;
+
+struct ComponentInfo
+{
+  std::size_t size{0};
+  std::size_t alignment{0};
+};
+
+ComponentId registerComponent(std::size_t size, std::size_t alignment);
+ComponentInfo const& getComponentInfo(ComponentId id) noexcept;
+
+// Components are plain data so that rows can be moved between chunks with a
+// memcpy.
+template<typename T>
+inline ComponentId componentId()
+{
+  static_assert(
+      std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+      "Components must be plain data.");
+  static ComponentId const id = registerComponent(sizeof(T), alignof(T));
+  return id;
+}
+
+inline constexpr ComponentMask toMask(ComponentId id) noexcept
+{
+  return ComponentMask{1} << id;
+}
+
+template<typename... Components>
+inline ComponentMask componentMask()
+{
+  return (ComponentMask{0} | ... | toMask(componentId<Components>()));
+}
+} // namespace ECS
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
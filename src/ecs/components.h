@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ECS_COMPONENTS_H
+#define FAST_SIM_DESIGN_ECS_COMPONENTS_H
+
+#include "../core/handle.h"
+
+#include <cstdint>
+#include <tuple>
+
+namespace FastSimDesign {
+namespace ECS {
+////////////////////////////////////////////////////////////
+/// Components
+////////////////////////////////////////////////////////////
+struct Position
+{
+  float x;
+  float y;
+};
+
+struct Velocity
+{
+  float x;
+  float y;
+};
+
+struct Hitpoints
+{
+  int value;
+};
+
+// Scene node rendering the entity, the scene graph keeps hierarchical
+// transforms and drawing.
+struct SceneLink
+{
+  Handle node;
+};
+
+struct AircraftInfo
+{
+  std::uint16_t type;
+};
+
+struct ProjectileInfo
+{
+  std::uint16_t type;
+};
+
+struct PickupInfo
+{
+  std::uint16_t type;
+};
+
+struct EmitterInfo
+{
+  std::uint16_t particle_type;
+};
+
+// Playing animation, advanced with all the others by the animation system.
+struct AnimationState
+{
+  std::uint16_t clip;
+  std::uint16_t frame;
+  float elapsed; // In seconds.
+};
+
+////////////////////////////////////////////////////////////
+/// Bundles
+////////////////////////////////////////////////////////////
+using AircraftBundle =
+    std::tuple<Position, Velocity, Hitpoints, SceneLink, AircraftInfo>;
+using ProjectileBundle =
+    std::tuple<Position, Velocity, Hitpoints, SceneLink, ProjectileInfo>;
+using PickupBundle =
+    std::tuple<Position, Velocity, Hitpoints, SceneLink, PickupInfo>;
+using EmitterBundle = std::tuple<SceneLink, EmitterInfo>;
+} // namespace ECS
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "kinematics.h"
+
+namespace FastSimDesign {
+namespace ECS {
+namespace Kinematics {
+void integrateScalar(
+    float* positions,
+    float const* velocities,
+    std::size_t count,
+    float dt) noexcept
+{
+  for (std::size_t i = 0; i < count; ++i)
+    positions[i] += velocities[i] * dt;
+}
+
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+FAST_SIM_DESIGN_TARGET_AVX2 void integrateAvx2(
+    float* positions,
+    float const* velocities,
+    std::size_t count,
+    float dt) noexcept
+{
+  __m256 const delta = _mm256_set1_ps(dt);
+
+  // Four entities (x, y) per register.
+  std::size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256 position = _mm256_loadu_ps(positions + i);
+    __m256 velocity = _mm256_loadu_ps(velocities + i);
+    position = _mm256_add_ps(position, _mm256_mul_ps(velocity, delta));
+    _mm256_storeu_ps(positions + i, position);
+  }
+  integrateScalar(positions + i, velocities + i, count - i, dt);
+}
+#endif
+
+void integrate(
+    Position* positions,
+    Velocity const* velocities,
+    std::size_t count,
+    float dt) noexcept
+{
+  float* position_stream = reinterpret_cast<float*>(positions);
+  float const* velocity_stream = reinterpret_cast<float const*>(velocities);
+  std::size_t const stream_size = count * 2;
+
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+  if (Simd::isAvx2Supported())
+  {
+    integrateAvx2(position_stream, velocity_stream, stream_size, dt);
+    return;
+  }
+#endif
+  integrateScalar(position_stream, velocity_stream, stream_size, dt);
+}
+} // namespace Kinematics
+} // namespace ECS
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ECS_KINEMATICS_H
+#define FAST_SIM_DESIGN_ECS_KINEMATICS_H
+
+#include "../utils/simd_util.h"
+#include "components.h"
+
+#include <cstddef>
+
+namespace FastSimDesign {
+namespace ECS {
+namespace Kinematics {
+static_assert(
+    sizeof(Position) == 2 * sizeof(float) &&
+        sizeof(Velocity) == 2 * sizeof(float),
+    "Position and Velocity columns must be plain float streams.");
+
+// Integrate `positions += velocities * dt` over `count` entities. Columns are
+// contiguous (x, y) float streams, processed with AVX2 when the CPU supports
+// it, with a scalar fallback and tail.
+void integrate(
+    Position* positions,
+    Velocity const* velocities,
+    std::size_t count,
+    float dt) noexcept;
+
+// Paths of integrate() over `count` floats of (x, y) streams, exposed so that
+// they can be checked against each other.
+void integrateScalar(
+    float* positions,
+    float const* velocities,
+    std::size_t count,
+    float dt) noexcept;
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+FAST_SIM_DESIGN_TARGET_AVX2 void integrateAvx2(
+    float* positions,
+    float const* velocities,
+    std::size_t count,
+    float dt) noexcept;
+#endif
+} // namespace Kinematics
+} // namespace ECS
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "query.h"
+
+namespace FastSimDesign {
+namespace ECS {
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+Query::Query(ComponentMask include, ComponentMask exclude) noexcept
+  : m_include{include}
+  , m_exclude{exclude}
+{
+}
+
+ComponentMask Query::getIncludeMask() const noexcept
+{
+  return m_include;
+}
+
+ComponentMask Query::getExcludeMask() const noexcept
+{
+  return m_exclude;
+}
+
+bool Query::matches(ComponentMask mask) const noexcept
+{
+  return (mask & m_include) == m_include && (mask & m_exclude) == 0;
+}
+
+void Query::addArchetype(Archetype& archetype)
+{
+  m_archetypes.push_back(&archetype);
+}
+
+std::span<Archetype* const> Query::getArchetypes() const noexcept
+{
+  return m_archetypes;
+}
+
+std::size_t Query::count() const noexcept
+{
+  std::size_t total = 0;
+  for (Archetype const* archetype : m_archetypes)
+    total += archetype->getSize();
+  return total;
+}
+} // namespace ECS
+} // namespace FastSimDesign
\ No newline at end of file
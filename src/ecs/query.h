@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ECS_QUERY_H
+#define FAST_SIM_DESIGN_ECS_QUERY_H
+
+#include "archetype.h"
+#include "component.h"
+
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace FastSimDesign {
+namespace ECS {
+/// Cached query over the archetypes that have all the included components and
+/// none of the excluded ones. The registry appends every new matching
+/// archetype, so iterating never has to test the archetypes again.
+class Query final
+{
+public:
+  explicit Query(ComponentMask include, ComponentMask exclude) noexcept;
+  Query(Query const&) = delete;
+  Query(Query&&) = default;
+  Query& operator=(Query const&) = delete;
+  Query& operator=(Query&&) = default;
+  virtual ~Query() = default;
+
+  ComponentMask getIncludeMask() const noexcept;
+  ComponentMask getExcludeMask() const noexcept;
+  bool matches(ComponentMask mask) const noexcept;
+  void addArchetype(Archetype& archetype);
+  std::span<Archetype* const> getArchetypes() const noexcept;
+  std::size_t count() const noexcept;
+
+  // Call `function(EntityId, Components&...)` for every matching entity.
+  // Structural changes (add, remove, destroy) are not allowed meanwhile.
+  template<typename... Components, typename Function>
+  void each(Function&& function)
+  {
+    for (Archetype* archetype : m_archetypes)
+    {
+      for (std::size_t chunk = 0; chunk < archetype->getChunkCount(); ++chunk)
+      {
+        std::span<EntityId const> entities = archetype->getEntities(chunk);
+        std::tuple<Components*...> columns{
+            archetype->getColumn<Components>(chunk)...};
+
+        for (std::size_t row = 0; row < entities.size(); ++row)
+          function(entities[row], std::get<Components*>(columns)[row]...);
+      }
+    }
+  }
+
+  // Call `function(std::size_t count, Components*...)` with the columns of
+  // every matching chunk, for batch processing.
+  template<typename... Components, typename Function>
+  void eachChunk(Function&& function)
+  {
+    for (Archetype* archetype : m_archetypes)
+    {
+      for (std::size_t chunk = 0; chunk < archetype->getChunkCount(); ++chunk)
+        function(
+            archetype->getCount(chunk),
+            archetype->getColumn<Components>(chunk)...);
+    }
+  }
+
+private:
+  ComponentMask m_include{0};
+  ComponentMask m_exclude{0};
+  std::vector<Archetype*> m_archetypes{};
+};
+} // namespace ECS
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "registry.h"
+
+namespace FastSimDesign {
+namespace ECS {
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+Registry::Registry()
+{
+  m_empty_archetype = &findOrCreateArchetype(0);
+}
+
+EntityId Registry::create()
+{
+  EntityId entity = allocateEntity();
+  Record& record = m_records[entity.index];
+  record.archetype = m_empty_archetype;
+  record.location = m_empty_archetype->allocate(entity);
+  return entity;
+}
+
+void Registry::destroy(EntityId entity) noexcept
+{
+  if (!isAlive(entity))
+    return;
+
+  Record& record = m_records[entity.index];
+  EntityId moved = record.archetype->remove(record.location);
+  if (moved.isValid())
+    m_records[moved.index].location = record.location;
+
+  // Bump the generation so that all copies of the id become stale.
+  record.archetype = nullptr;
+  ++record.generation;
+  record.next_free = m_first_free;
+  m_first_free = entity.index;
+  --m_entity_count;
+}
+
+bool Registry::isAlive(EntityId entity) const noexcept
+{
+  return entity.index < m_records.size() &&
+         m_records[entity.index].generation == entity.generation &&
+         m_records[entity.index].archetype != nullptr;
+}
+
+std::size_t Registry::getEntityCount() const noexcept
+{
+  return m_entity_count;
+}
+
+std::size_t Registry::getArchetypeCount() const noexcept
+{
+  return m_archetypes.size();
+}
+
+EntityId Registry::allocateEntity()
+{
+  std::uint32_t index = m_first_free;
+  if (index != Handle::Invalid_Index)
+  {
+    m_first_free = m_records[index].next_free;
+  }
+  else
+  {
+    index = static_cast<std::uint32_t>(m_records.size());
+    m_records.emplace_back();
+  }
+
+  Record& record = m_records[index];
+  record.next_free = Handle::Invalid_Index;
+  ++m_entity_count;
+  return EntityId{index, record.generation};
+}
+
+Archetype& Registry::findOrCreateArchetype(ComponentMask mask)
+{
+  auto found = m_archetypes.find(mask);
+  if (found != m_archetypes.end())
+    return *found->second;
+
+  std::unique_ptr<Archetype> archetype = std::make_unique<Archetype>(mask);
+  Archetype& result = *archetype;
+  m_archetypes.emplace(mask, std::move(archetype));
+
+  // Register the new archetype into the cached queries it matches.
+  for (std::unique_ptr<Query> const& query : m_queries)
+  {
+    if (query->matches(mask))
+      query->addArchetype(result);
+  }
+  return result;
+}
+
+Archetype& Registry::getAddTarget(Archetype& archetype, ComponentId id)
+{
+  if (Archetype* edge = archetype.getAddEdge(id))
+    return *edge;
+
+  Archetype& target = findOrCreateArchetype(archetype.getMask() | toMask(id));
+  archetype.setAddEdge(id, target);
+  target.setRemoveEdge(id, archetype);
+  return target;
+}
+
+Archetype& Registry::getRemoveTarget(Archetype& archetype, ComponentId id)
+{
+  if (Archetype* edge = archetype.getRemoveEdge(id))
+    return *edge;
+
+  Archetype& target = findOrCreateArchetype(archetype.getMask() & ~toMask(id));
+  archetype.setRemoveEdge(id, target);
+  target.setAddEdge(id, archetype);
+  return target;
+}
+
+void Registry::moveEntity(
+    EntityId entity, Record& record, Archetype& destination)
+{
+  Archetype::Location location = destination.allocate(entity);
+  record.archetype->copyRow(record.location, destination, location);
+
+  EntityId moved = record.archetype->remove(record.location);
+  if (moved.isValid())
+    m_records[moved.index].location = record.location;
+
+  record.archetype = &destination;
+  record.location = location;
+}
+
+Query& Registry::findOrCreateQuery(
+    ComponentMask include, ComponentMask exclude)
+{
+  for (std::unique_ptr<Query> const& query : m_queries)
+  {
+    if (query->getIncludeMask() == include &&
+        query->getExcludeMask() == exclude)
+      return *query;
+  }
+
+  std::unique_ptr<Query> query = std::make_unique<Query>(include, exclude);
+  for (auto const& [mask, archetype] : m_archetypes)
+  {
+    if (query->matches(mask))
+      query->addArchetype(*archetype);
+  }
+  m_queries.push_back(std::move(query));
+  return *m_queries.back();
+}
+} // namespace ECS
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ECS_REGISTRY_H
+#define FAST_SIM_DESIGN_ECS_REGISTRY_H
+
+#include "archetype.h"
+#include "component.h"
+#include "query.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace FastSimDesign {
+namespace ECS {
+/// Archetype-based entity registry. Each entity lives in exactly one
+/// archetype, and adding or removing a component moves its row to the
+/// archetype of the new component set.
+class Registry final
+{
+public:
+  explicit Registry();
+  Registry(Registry const&) = delete;
+  Registry(Registry&&) = default;
+  Registry& operator=(Registry const&) = delete;
+  Registry& operator=(Registry&&) = default;
+  virtual ~Registry() = default;
+
+  EntityId create();
+  void destroy(EntityId entity) noexcept;
+  bool isAlive(EntityId entity) const noexcept;
+
+  // Create an entity directly in the archetype of its components, without
+  // intermediate moves.
+  template<typename... Components>
+  EntityId spawn(Components const&... components)
+  {
+    ComponentMask mask = componentMask<Components...>();
+    EntityId entity = allocateEntity();
+    Record& record = m_records[entity.index];
+    record.archetype = &findOrCreateArchetype(mask);
+    record.location = record.archetype->allocate(entity);
+    (writeComponent(record, components), ...);
+    return entity;
+  }
+
+  template<typename... Components>
+  EntityId spawn(std::tuple<Components...> const& bundle)
+  {
+    return std::apply(
+        [this](Components const&... components) {
+          return spawn(components...);
+        },
+        bundle);
+  }
+
+  template<typename T>
+  void add(EntityId entity, T const& component)
+  {
+    assert(isAlive(entity));
+    Record& record = m_records[entity.index];
+    ComponentId id = componentId<T>();
+    if (!record.archetype->hasComponent(id))
+      moveEntity(entity, record, getAddTarget(*record.archetype, id));
+    writeComponent(record, component);
+  }
+
+  template<typename T>
+  void remove(EntityId entity)
+  {
+    assert(isAlive(entity));
+    Record& record = m_records[entity.index];
+    ComponentId id = componentId<T>();
+    if (record.archetype->hasComponent(id))
+      moveEntity(entity, record, getRemoveTarget(*record.archetype, id));
+  }
+
+  template<typename T>
+  bool has(EntityId entity) const noexcept
+  {
+    return isAlive(entity) &&
+           m_records[entity.index].archetype->hasComponent(componentId<T>());
+  }
+
+  template<typename T>
+  T* get(EntityId entity) noexcept
+  {
+    if (!isAlive(entity))
+      return nullptr;
+    Record& record = m_records[entity.index];
+    return static_cast<T*>(
+        record.archetype->getComponent(record.location, componentId<T>()));
+  }
+
+  template<typename T>
+  T const* get(EntityId entity) const noexcept
+  {
+    return const_cast<Registry*>(this)->get<T>(entity);
+  }
+
+  // Return the cached query, it is created on first use.
+  template<typename... Include>
+  Query& query(ComponentMask exclude = 0)
+  {
+    return findOrCreateQuery(componentMask<Include...>(), exclude);
+  }
+
+  std::size_t getEntityCount() const noexcept;
+  std::size_t getArchetypeCount() const noexcept;
+
+private:
+  struct Record
+  {
+    std::uint32_t generation{0};
+    std::uint32_t next_free{Handle::Invalid_Index};
+    Archetype* archetype{nullptr};
+    Archetype::Location location{};
+  };
+
+private:
+  EntityId allocateEntity();
+  Archetype& findOrCreateArchetype(ComponentMask mask);
+  Archetype& getAddTarget(Archetype& archetype, ComponentId id);
+  Archetype& getRemoveTarget(Archetype& archetype, ComponentId id);
+  void moveEntity(EntityId entity, Record& record, Archetype& destination);
+  Query& findOrCreateQuery(ComponentMask include, ComponentMask exclude);
+
+  template<typename T>
+  void writeComponent(Record& record, T const& component) noexcept
+  {
+    void* destination =
+        record.archetype->getComponent(record.location, componentId<T>());
+    assert(destination);
+    ::new (destination) T(component);
+  }
+
+private:
+  std::vector<Record> m_records{};
+  std::uint32_t m_first_free{Handle::Invalid_Index};
+  std::size_t m_entity_count{0};
+
+  Archetype* m_empty_archetype{nullptr};
+  std::unordered_map<ComponentMask, std::unique_ptr<Archetype>> m_archetypes{};
+  std::vector<std::unique_ptr<Query>> m_queries{};
+};
+} // namespace ECS
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,42 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "scheduler.h"
+
+#include "../utils/generic_utility.h"
+
+#include <cassert>
+#include <utility>
+
+namespace FastSimDesign {
+namespace ECS {
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+void Scheduler::addSystem(Phase phase, System system)
+{
+  assert(phase != Phase::PHASE_COUNT);
+  assert(system.run);
+  m_systems[toUnderlyingType(phase)].push_back(std::move(system));
+}
+
+void Scheduler::run(Phase phase, Registry& registry, sf::Time const& dt)
+{
+  for (System& system : m_systems[toUnderlyingType(phase)])
+    system.run(registry, dt);
+}
+
+std::vector<Scheduler::System> const& Scheduler::getSystems(
+    Phase phase) const noexcept
+{
+  return m_systems[toUnderlyingType(phase)];
+}
+} // namespace ECS
+} // namespace FastSimDesign
\ No newline at end of file
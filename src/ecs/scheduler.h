@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ECS_SCHEDULER_H
+#define FAST_SIM_DESIGN_ECS_SCHEDULER_H
+
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace FastSimDesign {
+namespace ECS {
+class Registry;
+/// Runs the systems registered for a phase, in their registration order. The
+/// owner of the scheduler decides when each phase happens in the tick.
+class Scheduler final
+{
+public:
+  enum class Phase : uint16_t
+  {
+    PRE_UPDATE,
+    UPDATE,
+    POST_UPDATE,
+    PRE_RENDER,
+    PHASE_COUNT
+  };
+
+  struct System
+  {
+    std::string name;
+    std::function<void(Registry&, sf::Time const&)> run;
+  };
+
+public:
+  explicit Scheduler() = default;
+  Scheduler(Scheduler const&) = default;
+  Scheduler(Scheduler&&) = default;
+  Scheduler& operator=(Scheduler const&) = default;
+  Scheduler& operator=(Scheduler&&) = default;
+  virtual ~Scheduler() = default;
+
+  void addSystem(Phase phase, System system);
+  void run(Phase phase, Registry& registry, sf::Time const& dt);
+  std::vector<System> const& getSystems(Phase phase) const noexcept;
+
+private:
+  std::array<
+      std::vector<System>,
+      static_cast<std::size_t>(Phase::PHASE_COUNT)>
+      m_systems{};
+};
+} // namespace ECS
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
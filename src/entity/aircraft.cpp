@@ -9,14 +9,20 @@
 ////////////////////////////////////////////////////////////
 
 #include "../core/command_queue.h"
+#include "../core/event_bus.h"
+#include "../core/service_registry.h"
+#include "../core/texture_holder.h"
 #include "../gui/scene_node.h"
+#include "../gui/software_render_target.h"
 #include "../gui/text_node.h"
 #include "../utils/generic_utility.h"
 #include "../utils/math_util.h"
 #include "../utils/sfml_util.h"
 #include "category.h"
 #include "core/resource_identifiers.h"
-#include "entity_data.h"
+#include "entity_catalog.h"
+#include "entity_pool.h"
+#include "gameplay_event.h"
 #include "pickup.h"
 #include "projectile.h"
 #include "sound_node.h"
@@ -30,65 +36,142 @@
 #include <memory>
 
 namespace FastSimDesign {
-namespace {
-std::unordered_map<Aircraft::Type, AircraftData> Data_Table =
-    initializeAircraftData();
-}
-
 ////////////////////////////////////////////////////////////
 /// Methods
 ////////////////////////////////////////////////////////////
 Aircraft::Aircraft(
     Aircraft::Type type, TextureHolder const& textures, FontHolder const& fonts)
-  : Parent{Data_Table[type].hit_point}
+  : Parent{getData(type).hit_point}
   , m_type{type}
-  , m_sprite{textures.get(Data_Table[type].texture), Data_Table[type].m_texture_rect}
-  , m_explosion{textures.get(Textures::ID::EXPLOSION)}
+  , m_textures{textures}
+  , m_fonts{fonts}
+  , m_sprite{
+        textures.get(getData(type).texture),
+        getData(type).texture_rect.toIntRect()}
+  , m_explosion{
+        textures.get(Textures::ID::EXPLOSION),
+        Animations::ID::EXPLOSION}
 {
-  m_explosion.setFrameSize(sf::Vector2i{256, 256});
-  m_explosion.setNumFrames(16);
-  m_explosion.setDuration(sf::seconds(1));
-
   SFML::centerOrigin(m_sprite);
   SFML::centerOrigin(m_explosion);
 
+  updateDisplays();
+  updateDisplayedTexts();
+}
+
+Aircraft::Aircraft(Aircraft const& prototype)
+  : Parent{prototype}
+  , m_type{prototype.m_type}
+  , m_textures{prototype.m_textures}
+  , m_fonts{prototype.m_fonts}
+  , m_sprite{prototype.m_sprite}
+  , m_explosion{prototype.m_explosion}
+  , m_fire_countdown{prototype.m_fire_countdown}
+  , m_is_firing{prototype.m_is_firing}
+  , m_is_launching_missile{prototype.m_is_launching_missile}
+  , m_show_explosion{prototype.m_show_explosion}
+  , m_published_destruction{prototype.m_published_destruction}
+  , m_spawned_pickup{prototype.m_spawned_pickup}
+  , m_fire_rate_level{prototype.m_fire_rate_level}
+  , m_spread_level{prototype.m_spread_level}
+  , m_missile_ammo{prototype.m_missile_ammo}
+  , m_travelled_distance{prototype.m_travelled_distance}
+  , m_direction_index{prototype.m_direction_index}
+  , m_displayed_hitpoints{prototype.m_displayed_hitpoints}
+  , m_displayed_missile_ammo{prototype.m_displayed_missile_ammo}
+  , m_displayed_rotation{prototype.m_displayed_rotation}
+{
+  // Texts are copied with their font and laid out string, commands are built
+  // once the copy is bound.
+  if (prototype.m_health_display)
+  {
+    std::unique_ptr<TextNode> health_display =
+        std::make_unique<TextNode>(*prototype.m_health_display);
+    m_health_display = health_display.get();
+    attachChild(std::move(health_display));
+  }
+
+  if (prototype.m_missile_display)
+  {
+    std::unique_ptr<TextNode> missile_display =
+        std::make_unique<TextNode>(*prototype.m_missile_display);
+    m_missile_display = missile_display.get();
+    attachChild(std::move(missile_display));
+  }
+}
+
+std::unique_ptr<Aircraft> Aircraft::clone() const
+{
+  return std::unique_ptr<Aircraft>{new Aircraft{*this}};
+}
+
+void Aircraft::reset(Aircraft::Type type, sf::Vector2f position)
+{
+  AircraftData const& data = getData(type);
+  Parent::reset(data.hit_point, position);
+  if (type != m_type)
+  {
+    m_type = type;
+    m_sprite.setTexture(m_textures.get(data.texture));
+    m_sprite.setTextureRect(data.texture_rect.toIntRect());
+    SFML::centerOrigin(m_sprite);
+    updateDisplays();
+  }
+
+  m_explosion.restart();
+  m_fire_countdown = sf::Time::Zero;
+  m_is_firing = false;
+  m_is_launching_missile = false;
+  m_show_explosion = true;
+  m_published_destruction = false;
+  m_spawned_pickup = false;
+  m_fire_rate_level = 1;
+  m_spread_level = 1;
+  m_missile_ammo = 2;
+  m_travelled_distance = 0.f;
+  m_direction_index = 0;
+  updateDisplayedTexts();
+}
+
+void Aircraft::onServicesBound(ServiceRegistry& services) noexcept
+{
+  Parent::onServicesBound(services);
+
+  // Commands only hold the handle of the aircraft, they do nothing if it has
+  // been removed from the scene before being executed.
+  Handle handle = getHandle();
+  TextureHolder const* textures = &m_textures;
+
   m_fire_command.name = "CreateBullets";
   m_fire_command.category =
       BitFlags<Category::Type>{Category::Type::SCENE_AIR_LAYER};
-  m_fire_command.action = [this, &textures](SceneNode& node, sf::Time) {
-    createBullets(node, textures);
+  m_fire_command.action = [handle, textures](SceneNode& node, sf::Time) {
+    if (Aircraft const* aircraft = node.resolve<Aircraft>(handle))
+      aircraft->createBullets(node, *textures);
   };
 
   m_missile_command.name = "CreateProjectile";
   m_missile_command.category =
       BitFlags<Category::Type>{Category::Type::SCENE_AIR_LAYER};
-  m_missile_command.action = [this, &textures](SceneNode& node, sf::Time) {
-    createProjectile(node, Projectile::Type::MISSILE, 0.f, 0.5f, textures);
+  m_missile_command.action = [handle, textures](SceneNode& node, sf::Time) {
+    if (Aircraft const* aircraft = node.resolve<Aircraft>(handle))
+      aircraft->createProjectile(
+          node, Projectile::Type::MISSILE, 0.f, 0.5f, *textures);
   };
 
   m_drop_pickup_command.name = "DropPickup";
   m_drop_pickup_command.category =
       BitFlags<Category::Type>{Category::Type::SCENE_AIR_LAYER};
-  m_drop_pickup_command.action = [this, &textures](SceneNode& node, sf::Time) {
-    createPickup(node, textures);
+  m_drop_pickup_command.action = [handle, textures](SceneNode& node, sf::Time) {
+    if (Aircraft const* aircraft = node.resolve<Aircraft>(handle))
+      aircraft->createPickup(node, *textures);
   };
+}
 
-  std::unique_ptr<TextNode> health_display =
-      std::make_unique<TextNode>(fonts, "");
-  m_health_display = health_display.get();
-  attachChild(std::move(health_display));
-
-  if (getCategory() ==
-      BitFlags<Category::Type>{Category::Type::PLAYER_AIRCRAFT})
-  {
-    std::unique_ptr<TextNode> missile_display =
-        std::make_unique<TextNode>(fonts, "");
-    missile_display->setPosition(0, 70.f);
-    m_missile_display = missile_display.get();
-    attachChild(std::move(missile_display));
-  }
-
-  updateDisplayedTexts();
+ECS::EntityId Aircraft::spawnEntity(ECS::Registry& registry) const
+{
+  return registry.spawn(makeBundle<ECS::AircraftBundle>(
+      ECS::AircraftInfo{toUnderlyingType(m_type)}));
 }
 
 void Aircraft::createBullets(
@@ -121,16 +204,20 @@ void Aircraft::createProjectile(
     float y_offset,
     TextureHolder const& textures) const noexcept
 {
-  std::unique_ptr<Projectile> projectile =
-      std::make_unique<Projectile>(type, textures);
-
   sf::Vector2f offset{
       x_offset * m_sprite.getGlobalBounds().width,
       y_offset * m_sprite.getGlobalBounds().height};
-  sf::Vector2f velocity{0, projectile->getMaxSpeed()};
-
   float sign = isAllied() ? -1.f : 1.f;
-  projectile->setPosition(getWorldPosition() + offset * sign);
+  sf::Vector2f position = getWorldPosition() + offset * sign;
+
+  EntityPool* pool = node.getServices() ? node.getServices()->find<EntityPool>()
+                                        : nullptr;
+  std::unique_ptr<Projectile> projectile =
+      pool ? pool->acquire(type, position)
+           : std::make_unique<Projectile>(type, textures);
+  projectile->setSimPosition(position);
+
+  sf::Vector2f velocity{0, projectile->getMaxSpeed()};
   projectile->setVelocity(velocity * sign);
   node.attachChild(std::move(projectile));
 }
@@ -138,23 +225,74 @@ void Aircraft::createProjectile(
 void Aircraft::createPickup(
     SceneNode& node, TextureHolder const& textures) const noexcept
 {
-  auto type = static_cast<Pickup::Type>(
-      Math::randomInt(toUnderlyingType(Pickup::Type::TYPE_COUNT)));
-
-  std::unique_ptr<Pickup> pickup = std::make_unique<Pickup>(type, textures);
-  pickup->setPosition(getWorldPosition());
+  // Any pickup of the catalog can drop, including the ones without a code
+  // counterpart.
+  int const pickup_count =
+      static_cast<int>(EntityCatalog::getCurrent().getPickups().size());
+  auto type = static_cast<Pickup::Type>(Math::randomInt(pickup_count));
+
+  EntityPool* pool = node.getServices() ? node.getServices()->find<EntityPool>()
+                                        : nullptr;
+  std::unique_ptr<Pickup> pickup =
+      pool ? pool->acquire(type, getWorldPosition())
+           : std::make_unique<Pickup>(type, textures);
+  pickup->setSimPosition(getWorldPosition());
   pickup->setVelocity(0.f, 1.f);
   node.attachChild(std::move(pickup));
 }
 
+void Aircraft::updateDisplays()
+{
+  // Only the player has texts, the health of the others is shown by the
+  // health bars.
+  if (isAllied() && !m_health_display)
+  {
+    std::unique_ptr<TextNode> health_display =
+        std::make_unique<TextNode>(m_fonts, "");
+    health_display->setPosition(0.f, 65.f);
+    m_health_display = health_display.get();
+    attachChild(std::move(health_display));
+
+    std::unique_ptr<TextNode> missile_display =
+        std::make_unique<TextNode>(m_fonts, "");
+    missile_display->setPosition(0.f, 85.f);
+    m_missile_display = missile_display.get();
+    attachChild(std::move(missile_display));
+  }
+  else if (!isAllied() && m_health_display)
+  {
+    detachChild(*m_health_display);
+    detachChild(*m_missile_display);
+    m_health_display = nullptr;
+    m_missile_display = nullptr;
+  }
+
+  m_displayed_hitpoints.reset();
+  m_displayed_missile_ammo.reset();
+  m_displayed_rotation.reset();
+}
+
 void Aircraft::updateDisplayedTexts() noexcept
 {
-  m_health_display->setString(std::to_string(getHitpoints()) + "HP");
-  m_health_display->setPosition(0.f, 50.f);
-  m_health_display->setRotation(-getRotation());
+  if (!m_health_display)
+    return;
 
-  if (m_missile_display)
+  // Lay texts out again only when their value changed.
+  if (m_displayed_hitpoints != getHitpoints())
   {
+    m_displayed_hitpoints = getHitpoints();
+    m_health_display->setString(std::to_string(getHitpoints()) + "HP");
+  }
+
+  if (m_displayed_rotation != getRotation())
+  {
+    m_displayed_rotation = getRotation();
+    m_health_display->setRotation(-getRotation());
+  }
+
+  if (m_displayed_missile_ammo != m_missile_ammo)
+  {
+    m_displayed_missile_ammo = m_missile_ammo;
     if (m_missile_ammo == 0)
       m_missile_display->setString("");
     else
@@ -164,9 +302,10 @@ void Aircraft::updateDisplayedTexts() noexcept
 
 void Aircraft::updateRollAnimation() noexcept
 {
-  if (Data_Table[m_type].has_rool_animation)
+  AircraftData const& data = getData(m_type);
+  if (data.has_roll_animation)
   {
-    sf::IntRect texture_rect = Data_Table[m_type].m_texture_rect;
+    sf::IntRect texture_rect = data.texture_rect.toIntRect();
 
     // Roll left: Texture rect offset once.
     if (getVelocity().x < 0.f)
@@ -200,7 +339,7 @@ bool Aircraft::isMarkedForRemoval() const noexcept
 
 float Aircraft::getMaxSpeed() const noexcept
 {
-  return Data_Table[m_type].speed;
+  return getData(m_type).speed;
 }
 
 bool Aircraft::isAllied() const noexcept
@@ -208,6 +347,11 @@ bool Aircraft::isAllied() const noexcept
   return m_type == Aircraft::Type::EAGLE;
 }
 
+Aircraft::Type Aircraft::getType() const noexcept
+{
+  return m_type;
+}
+
 void Aircraft::increaseFireRate() noexcept
 {
   if (m_fire_rate_level < 10)
@@ -228,7 +372,7 @@ void Aircraft::collectMissiles(uint16_t count) noexcept
 void Aircraft::fire() noexcept
 {
   // Only ships with fire interval != 0 are able to fire.
-  if (Data_Table[m_type].fire_interval != sf::Time::Zero)
+  if (getData(m_type).fire_interval > 0.f)
     m_is_firing = true;
 }
 
@@ -241,20 +385,13 @@ void Aircraft::launchMissile() noexcept
   }
 }
 
-void Aircraft::playLocalSound(
-    CommandQueue& commands, SoundEffect::ID effect) noexcept
+void Aircraft::playLocalSound(SoundEffect::ID effect) noexcept
 {
-  sf::Vector2f world_position = getWorldPosition();
-
-  Command command;
-  command.name = "PlaySound";
-  command.category = BitFlags<Category::Type>{Category::Type::SOUND_EFFECT};
-  command.action = derivedAction<SoundNode>(
-      [effect, world_position](SoundNode& node, sf::Time) {
-        node.playSound(effect, world_position);
-      });
+  if (!getServices())
+    return;
 
-  commands.push(command);
+  if (SoundNode* sound_node = getServices()->find<SoundNode>())
+    sound_node->playSound(effect, getWorldPosition());
 }
 
 void Aircraft::updateCurrent(sf::Time const& dt, CommandQueue& commands)
@@ -267,17 +404,22 @@ void Aircraft::updateCurrent(sf::Time const& dt, CommandQueue& commands)
   if (isDestroyed())
   {
     checkPickupDrop(commands);
+
+    // Once in the registry, the explosion plays with all other animations.
+    if (!m_explosion.isBound() && getRegistry())
+      m_explosion.bind(*getRegistry(), getEntityId());
     m_explosion.update(dt);
 
-    // Play explosion sound only once.
-    if (!m_played_explosion_sound)
+    // Notify destruction only once, consumers play the explosion sound.
+    if (!m_published_destruction && getServices())
     {
-      SoundEffect::ID sound_effect = (Math::randomInt(2) == 0)
-                                         ? SoundEffect::ID::EXPLOSION_1
-                                         : SoundEffect::ID::EXPLOSION_2;
-      playLocalSound(commands, sound_effect);
+      if (EventBus* events = getServices()->find<EventBus>())
+        events->publish(GameplayEvent::Destroyed{
+            getHandle(),
+            getCategory().toRaw(),
+            getWorldPosition()});
 
-      m_played_explosion_sound = true;
+      m_published_destruction = true;
     }
     return;
   }
@@ -293,7 +435,9 @@ void Aircraft::updateCurrent(sf::Time const& dt, CommandQueue& commands)
 void Aircraft::updateMovementPattern(sf::Time const& dt) noexcept
 {
   // Enemy airplane: Movement pattern
-  const std::vector<Direction>& directions = Data_Table[m_type].directions;
+  EntityCatalog const& catalog = EntityCatalog::getCurrent();
+  std::span<Direction const> directions =
+      catalog.getDirections(catalog.getData(m_type));
   if (!directions.empty())
   {
     // Moved long enough in current direction: Change direction.
@@ -335,11 +479,10 @@ void Aircraft::checkProjectileLaunch(
     // Interval expired: We can fire a new bullet.
     commands.push(m_fire_command);
     playLocalSound(
-        commands,
         isAllied() ? SoundEffect::ID::ALLIED_GUN_FIRE
                    : SoundEffect::ID::ENEMY_GUN_FIRE);
 
-    m_fire_countdown += Data_Table[m_type].fire_interval /
+    m_fire_countdown += getData(m_type).getFireInterval() /
                         (static_cast<float>(m_fire_rate_level) + 1.f);
     m_is_firing = false;
   }
@@ -354,7 +497,7 @@ void Aircraft::checkProjectileLaunch(
   if (m_is_launching_missile)
   {
     commands.push(m_missile_command);
-    playLocalSound(commands, SoundEffect::ID::LAUNCH_MISSILE);
+    playLocalSound(SoundEffect::ID::LAUNCH_MISSILE);
 
     m_is_launching_missile = false;
   }
@@ -363,9 +506,34 @@ void Aircraft::checkProjectileLaunch(
 void Aircraft::drawCurrent(
     sf::RenderTarget& target, sf::RenderStates states) const
 {
+  float const pixel_scale = LodRenderer::getPixelScale(target);
   if (isDestroyed() && m_show_explosion)
-    target.draw(m_explosion, states);
-  else
+  {
+    if (!drawLod(pixel_scale, states, m_explosion.getGlobalBounds()))
+      target.draw(m_explosion, states);
+  }
+  else if (!drawLod(pixel_scale, states, m_sprite.getGlobalBounds()))
     target.draw(m_sprite, states);
 }
+
+void Aircraft::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  float const pixel_scale = LodRenderer::getPixelScale(target);
+  if (isDestroyed() && m_show_explosion)
+  {
+    if (!drawLod(pixel_scale, states, m_explosion.getGlobalBounds()))
+    {
+      target.draw(
+          m_explosion,
+          states,
+          &m_textures.getImage(m_explosion.getClip().getTexture()));
+    }
+  }
+  else if (!drawLod(pixel_scale, states, m_sprite.getGlobalBounds()))
+  {
+    target.draw(
+        m_sprite, states, &m_textures.getImage(getData(m_type).texture));
+  }
+}
 } // namespace FastSimDesign
\ No newline at end of file
@@ -20,6 +20,9 @@
 
 #include <SFML/Graphics/Sprite.hpp>
 
+#include <memory>
+#include <optional>
+
 namespace FastSimDesign {
 class TextNode;
 class Aircraft final : public Entity
@@ -48,6 +51,10 @@ public:
   virtual bool isMarkedForRemoval() const noexcept override;
   float getMaxSpeed() const noexcept;
   bool isAllied() const noexcept;
+  Aircraft::Type getType() const noexcept;
+
+  std::unique_ptr<Aircraft> clone() const;
+  void reset(Aircraft::Type type, sf::Vector2f position);
 
   void increaseFireRate() noexcept;
   void increaseSpread() noexcept;
@@ -55,9 +62,11 @@ public:
 
   void fire() noexcept;
   void launchMissile() noexcept;
-  void playLocalSound(CommandQueue& commands, SoundEffect::ID effect) noexcept;
+  void playLocalSound(SoundEffect::ID effect) noexcept;
 
 private:
+  Aircraft(Aircraft const& prototype);
+
   void createBullets(
       SceneNode& node, TextureHolder const& textures) const noexcept;
   void createProjectile(
@@ -69,20 +78,27 @@ private:
   void createPickup(
       SceneNode& node, TextureHolder const& textures) const noexcept;
 
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual ECS::EntityId spawnEntity(ECS::Registry& registry) const override;
   virtual void updateCurrent(
       sf::Time const& dt, CommandQueue& commands) override;
   void updateMovementPattern(sf::Time const& dt) noexcept;
   void checkPickupDrop(CommandQueue& commands) noexcept;
   void checkProjectileLaunch(
       sf::Time const& dt, CommandQueue& commands) noexcept;
+  void updateDisplays();
   void updateDisplayedTexts() noexcept;
   void updateRollAnimation() noexcept;
 
   virtual void drawCurrent(
       sf::RenderTarget& target, sf::RenderStates states) const override;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
 
 private:
   Aircraft::Type m_type{};
+  TextureHolder const& m_textures;
+  FontHolder const& m_fonts;
   sf::Sprite m_sprite{};
   Animation m_explosion{};
 
@@ -93,7 +109,7 @@ private:
   bool m_is_firing{false};
   bool m_is_launching_missile{false};
   bool m_show_explosion{true};
-  bool m_played_explosion_sound{false};
+  bool m_published_destruction{false};
   bool m_spawned_pickup{false};
 
   int m_fire_rate_level{1};
@@ -103,8 +119,12 @@ private:
   float m_travelled_distance{0.f};
   std::size_t m_direction_index{0};
 
+  // Player only, with the values they display.
   TextNode* m_health_display{nullptr};
   TextNode* m_missile_display{nullptr};
+  std::optional<int> m_displayed_hitpoints{};
+  std::optional<int> m_displayed_missile_ammo{};
+  std::optional<float> m_displayed_rotation{};
 };
 } // namespace FastSimDesign
 #endif
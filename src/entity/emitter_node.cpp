@@ -10,7 +10,9 @@
 
 #include "emitter_node.h"
 
-#include "../core/command_queue.h"
+#include "../core/service_registry.h"
+#include "../utils/generic_utility.h"
+#include "entity_catalog.h"
 
 #include <SFML/System/Time.hpp>
 
@@ -28,41 +30,59 @@ EmitterNode::EmitterNode(Particle::Type type) noexcept
 {
 }
 
-void EmitterNode::updateCurrent(sf::Time const& dt, CommandQueue& commands)
+void EmitterNode::onServicesBound(ServiceRegistry& services) noexcept
 {
-  if (m_particle_system)
-  {
-    emitParticles(dt);
-  }
-  else
-  {
-    // Find particle node with the same type as emitter node.
-    auto finder = [this](ParticleNode& container, sf::Time) {
-      if (container.getParticuleType() == m_type)
-        m_particle_system = &container;
-    };
+  if (ECS::Registry* registry = services.find<ECS::Registry>())
+    m_entity = registry->spawn(ECS::EmitterBundle{
+        ECS::SceneLink{getHandle()},
+        ECS::EmitterInfo{toUnderlyingType(m_type)}});
+}
+
+void EmitterNode::onServicesUnbound(ServiceRegistry& services) noexcept
+{
+  if (ECS::Registry* registry = services.find<ECS::Registry>())
+    registry->destroy(m_entity);
+  m_entity = ECS::EntityId{};
+}
 
-    // Send a command through the scene graph to find the right particle system.
-    Command finder_command;
-    finder_command.name = "ParticleFinder";
-    finder_command.category = BitFlags{Category::Type::PARTICLE_SYSTEM};
-    finder_command.action = derivedAction<ParticleNode>(finder);
+void EmitterNode::updateCurrent(sf::Time const& dt, CommandQueue&)
+{
+  ParticleNode* particle_system = resolve<ParticleNode>(m_particle_system);
 
-    commands.push(finder_command);
+  // Find particle node with the same type as emitter node.
+  if (!particle_system && getServices())
+  {
+    particle_system = getServices()->find<ParticleNode>(m_type);
+    if (particle_system)
+      m_particle_system = particle_system->getHandle();
   }
+
+  if (particle_system)
+    emitParticles(dt, *particle_system);
 }
 
-void EmitterNode::emitParticles(sf::Time const& dt) noexcept
+void EmitterNode::emitParticles(
+    sf::Time const& dt, ParticleNode& particle_system) noexcept
 {
-  float const emission_rate = 30.f;
-  sf::Time const interval = sf::seconds(1.f) / emission_rate;
+  // The particle system scales the emission down with its load and the
+  // distance from the view.
+  sf::Vector2f const position = getWorldPosition();
+  ParticleNode::Emission const emission =
+      particle_system.getEmission(position);
+  float const emission_rate = getData(m_type).emission_rate * emission.rate;
+  if (emission_rate <= 0.f)
+  {
+    m_accumulated_time = sf::Time::Zero;
+    return;
+  }
+  sf::Time const interval = sf::seconds(1.f / emission_rate);
 
   m_accumulated_time += dt;
 
   while (m_accumulated_time > interval)
   {
     m_accumulated_time -= interval;
-    m_particle_system->addParticule(getWorldPosition());
+    particle_system.addParticule(position, emission.scale);
   }
 }
 
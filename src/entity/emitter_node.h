@@ -13,6 +13,8 @@
 #ifndef FAST_SIM_DESIGN_EMITTER_NODE_H
 #define FAST_SIM_DESIGN_EMITTER_NODE_H
 
+#include "../ecs/components.h"
+#include "../ecs/registry.h"
 #include "../gui/scene_node.h"
 #include "particle.h"
 #include "particle_node.h"
@@ -30,14 +32,18 @@ public:
   virtual ~EmitterNode() = default;
 
 private:
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept override;
   virtual void updateCurrent(
       sf::Time const& dt, CommandQueue& commands) override;
-  void emitParticles(sf::Time const& dt) noexcept;
+  void emitParticles(
+      sf::Time const& dt, ParticleNode& particle_system) noexcept;
 
 private:
   sf::Time m_accumulated_time{sf::Time::Zero};
   Particle::Type m_type;
-  ParticleNode* m_particle_system{nullptr};
+  Handle m_particle_system{};
+  ECS::EntityId m_entity{};
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -1,83 +1,218 @@
-////////////////////////////////////////////////////////////
-///
-/// Copyright 2024-present, Joseph Garnier
-/// All rights reserved.
-///
-/// This source code is licensed under the license found in the
-/// LICENSE file in the root directory of this source tree.
-///
-////////////////////////////////////////////////////////////
-
-#include "entity.h"
-
-#include <cassert>
-
-namespace FastSimDesign {
-////////////////////////////////////////////////////////////
-/// Methods
-////////////////////////////////////////////////////////////
-Entity::Entity(int hitpoints) noexcept
-  : Parent{}
-  , m_hitpoints{hitpoints}
-{
-}
-
-void Entity::setVelocity(sf::Vector2f velocity) noexcept
-{
-  m_velocity = velocity;
-}
-
-void Entity::setVelocity(float vx, float vy) noexcept
-{
-  m_velocity.x = vx;
-  m_velocity.y = vy;
-}
-
-sf::Vector2f const& Entity::getVelocity() const noexcept
-{
-  return m_velocity;
-}
-
-void Entity::accelerate(sf::Vector2f const& velocity) noexcept
-{
-  m_velocity += velocity;
-}
-
-void Entity::accelerate(float vx, float vy) noexcept
-{
-  m_velocity.x += vx;
-  m_velocity.y += vy;
-}
-
-int Entity::getHitpoints() const noexcept
-{
-  return m_hitpoints;
-}
-
-void Entity::repair(int points)
-{
-  assert(points > 0);
-  m_hitpoints += points;
-}
-
-void Entity::damage(int points)
-{
-  assert(points > 0);
-  m_hitpoints -= points;
-}
-
-void Entity::destroy()
-{
-  m_hitpoints = 0;
-}
-
-bool Entity::isDestroyed() const noexcept
-{
-  return m_hitpoints <= 0;
-}
-
-void Entity::updateCurrent(sf::Time const& dt, CommandQueue&)
-{
-  move(m_velocity * dt.asSeconds());
-}
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "entity.h"
+
+#include <cassert>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+Entity::Entity(int hitpoints) noexcept
+  : Parent{}
+  , m_hitpoints{hitpoints}
+{
+}
+
+Entity::Entity(Entity const& prototype) noexcept
+  : Parent{prototype}
+  , m_velocity{prototype.m_velocity}
+  , m_hitpoints{prototype.m_hitpoints}
+{
+}
+
+void Entity::setSimPosition(sf::Vector2f const& position) noexcept
+{
+  setSimPosition(position.x, position.y);
+}
+
+void Entity::setSimPosition(float x, float y) noexcept
+{
+  setPosition(x, y);
+  if (m_registry)
+    *m_registry->get<ECS::Position>(m_entity) = ECS::Position{x, y};
+}
+
+sf::Vector2f Entity::getSimPosition() const noexcept
+{
+  if (m_registry)
+  {
+    ECS::Position const* position = m_registry->get<ECS::Position>(m_entity);
+    return sf::Vector2f{position->x, position->y};
+  }
+  return Parent::getPosition();
+}
+
+void Entity::setVelocity(sf::Vector2f velocity) noexcept
+{
+  setVelocity(velocity.x, velocity.y);
+}
+
+void Entity::setVelocity(float vx, float vy) noexcept
+{
+  if (!m_registry)
+    m_velocity = sf::Vector2f{vx, vy};
+  else if (ECS::Velocity* velocity = m_registry->get<ECS::Velocity>(m_entity))
+    *velocity = ECS::Velocity{vx, vy};
+}
+
+sf::Vector2f Entity::getVelocity() const noexcept
+{
+  if (!m_registry)
+    return m_velocity;
+
+  // Destroyed entities have no velocity anymore.
+  ECS::Velocity const* velocity = m_registry->get<ECS::Velocity>(m_entity);
+  return velocity ? sf::Vector2f{velocity->x, velocity->y} : sf::Vector2f{};
+}
+
+void Entity::accelerate(sf::Vector2f const& velocity) noexcept
+{
+  accelerate(velocity.x, velocity.y);
+}
+
+void Entity::accelerate(float vx, float vy) noexcept
+{
+  sf::Vector2f velocity = getVelocity();
+  setVelocity(velocity.x + vx, velocity.y + vy);
+}
+
+int Entity::getHitpoints() const noexcept
+{
+  if (m_registry)
+    return m_registry->get<ECS::Hitpoints>(m_entity)->value;
+  return m_hitpoints;
+}
+
+void Entity::repair(int points)
+{
+  assert(points > 0);
+  if (m_registry)
+    m_registry->get<ECS::Hitpoints>(m_entity)->value += points;
+  else
+    m_hitpoints += points;
+}
+
+void Entity::damage(int points)
+{
+  assert(points > 0);
+  if (m_registry)
+    m_registry->get<ECS::Hitpoints>(m_entity)->value -= points;
+  else
+    m_hitpoints -= points;
+  stopIfDestroyed();
+}
+
+void Entity::destroy()
+{
+  if (m_registry)
+    m_registry->get<ECS::Hitpoints>(m_entity)->value = 0;
+  else
+    m_hitpoints = 0;
+  stopIfDestroyed();
+}
+
+bool Entity::isDestroyed() const noexcept
+{
+  return getHitpoints() <= 0;
+}
+
+ECS::EntityId Entity::getEntityId() const noexcept
+{
+  return m_entity;
+}
+
+void Entity::reset(int hitpoints, sf::Vector2f position) noexcept
+{
+  assert(!m_registry && "Only detached entities can be reset.");
+  m_velocity = sf::Vector2f{};
+  m_hitpoints = hitpoints;
+  setPosition(position);
+  setRotation(0.f);
+}
+
+void Entity::onServicesBound(ServiceRegistry& services) noexcept
+{
+  m_lod_renderer = services.find<LodRenderer>();
+  if (ECS::Registry* registry = services.find<ECS::Registry>())
+  {
+    m_entity = spawnEntity(*registry);
+    m_registry = registry;
+    stopIfDestroyed();
+  }
+}
+
+void Entity::onServicesUnbound(ServiceRegistry&) noexcept
+{
+  m_lod_renderer = nullptr;
+  if (!m_registry)
+    return;
+
+  // Keep the last state, the entity may be attached again later.
+  pullFromRegistry();
+  m_registry->destroy(m_entity);
+  m_registry = nullptr;
+  m_entity = ECS::EntityId{};
+}
+
+bool Entity::drawLod(
+    float pixel_scale,
+    sf::RenderStates const& states,
+    sf::FloatRect const& bounds) const
+{
+  if (!m_lod_renderer)
+    return false;
+
+  sf::FloatRect const scene_bounds = states.transform.transformRect(bounds);
+  LodRenderer::Tier const tier =
+      m_lod_renderer->getTier(scene_bounds, pixel_scale);
+  if (tier == LodRenderer::Tier::FULL)
+    return false;
+
+  m_lod_renderer->append(
+      tier, scene_bounds, LodRenderer::getColor(getCategory()));
+  return true;
+}
+
+ECS::Registry* Entity::getRegistry() const noexcept
+{
+  return m_registry;
+}
+
+ECS::EntityId Entity::spawnEntity(ECS::Registry& registry) const
+{
+  return registry.spawn(
+      ECS::Position{getSimPosition().x, getSimPosition().y},
+      ECS::Velocity{m_velocity.x, m_velocity.y},
+      ECS::Hitpoints{m_hitpoints},
+      ECS::SceneLink{getHandle()});
+}
+
+void Entity::stopIfDestroyed() noexcept
+{
+  // Wrecks stay still while they explode: strip their velocity so that the
+  // movement system skips them without branching.
+  if (m_registry && isDestroyed())
+    m_registry->remove<ECS::Velocity>(m_entity);
+}
+
+void Entity::updateCurrent(sf::Time const&, CommandQueue&)
+{
+  // Movement is integrated by the ECS movement system.
+}
+
+void Entity::pullFromRegistry() noexcept
+{
+  m_velocity = getVelocity();
+  m_hitpoints = getHitpoints();
+  setPosition(getSimPosition());
+}
 } // namespace FastSimDesign
\ No newline at end of file
@@ -1,51 +1,101 @@
-////////////////////////////////////////////////////////////
-///
-/// Copyright 2024-present, Joseph Garnier
-/// All rights reserved.
-///
-/// This source code is licensed under the license found in the
-/// LICENSE file in the root directory of this source tree.
-///
-////////////////////////////////////////////////////////////
-
-#pragma once
-
-#ifndef FAST_SIM_DESIGN_ENTITY_H
-#define FAST_SIM_DESIGN_ENTITY_H
-
-#include "../gui/scene_node.h"
-
-namespace FastSimDesign {
-class Entity : public SceneNode
-{
-public:
-private:
-  using Parent = SceneNode;
-
-public:
-  explicit Entity(int hitpoints) noexcept;
-  virtual ~Entity() = default;
-
-  void setVelocity(sf::Vector2f velocity) noexcept;
-  void setVelocity(float vx, float vy) noexcept;
-  sf::Vector2f const& getVelocity() const noexcept;
-
-  void accelerate(sf::Vector2f const& velocity) noexcept;
-  void accelerate(float vx, float vy) noexcept;
-
-  int getHitpoints() const noexcept;
-  void repair(int points);
-  void damage(int points);
-  void destroy();
-  virtual bool isDestroyed() const noexcept override;
-
-protected:
-  virtual void updateCurrent(
-      sf::Time const& dt, CommandQueue& commands) override;
-
-private:
-  sf::Vector2f m_velocity{};
-  int m_hitpoints{0};
-};
-} // namespace FastSimDesign
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ENTITY_H
+#define FAST_SIM_DESIGN_ENTITY_H
+
+#include "../ecs/components.h"
+#include "../ecs/registry.h"
+#include "../gui/lod_renderer.h"
+#include "../gui/scene_node.h"
+
+namespace FastSimDesign {
+class Entity : public SceneNode
+{
+public:
+private:
+  using Parent = SceneNode;
+
+public:
+  explicit Entity(int hitpoints) noexcept;
+  virtual ~Entity() = default;
+
+  // Simulated position, owned by the ECS registry once the entity is bound to
+  // it. The node transform is only synced from it for rendering, so moving
+  // the node through sf::Transformable is overwritten by the next sync.
+  void setSimPosition(sf::Vector2f const& position) noexcept;
+  void setSimPosition(float x, float y) noexcept;
+  sf::Vector2f getSimPosition() const noexcept;
+
+  void setVelocity(sf::Vector2f velocity) noexcept;
+  void setVelocity(float vx, float vy) noexcept;
+  sf::Vector2f getVelocity() const noexcept;
+
+  void accelerate(sf::Vector2f const& velocity) noexcept;
+  void accelerate(float vx, float vy) noexcept;
+
+  int getHitpoints() const noexcept;
+  void repair(int points);
+  void damage(int points);
+  void destroy();
+  virtual bool isDestroyed() const noexcept override;
+
+  ECS::EntityId getEntityId() const noexcept;
+
+protected:
+  // Copy a prototype, the copy is not bound to the ECS registry.
+  Entity(Entity const& prototype) noexcept;
+
+  // Bring a detached entity back to a fresh state before reusing it.
+  void reset(int hitpoints, sf::Vector2f position) noexcept;
+
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept override;
+  virtual ECS::EntityId spawnEntity(ECS::Registry& registry) const;
+  ECS::Registry* getRegistry() const noexcept;
+  // Append the marker of the entity to the LOD renderer and return true when
+  // `bounds`, in the coordinates of the node, are too small on screen for
+  // the detailed drawing, at `pixel_scale` pixels per unit of the scene.
+  bool drawLod(
+      float pixel_scale,
+      sf::RenderStates const& states,
+      sf::FloatRect const& bounds) const;
+  virtual void updateCurrent(
+      sf::Time const& dt, CommandQueue& commands) override;
+
+  template<typename Bundle, typename Info>
+  Bundle makeBundle(Info const& info) const noexcept
+  {
+    return Bundle{
+        ECS::Position{getSimPosition().x, getSimPosition().y},
+        ECS::Velocity{m_velocity.x, m_velocity.y},
+        ECS::Hitpoints{m_hitpoints},
+        ECS::SceneLink{getHandle()},
+        info};
+  }
+
+private:
+  void pullFromRegistry() noexcept;
+  void stopIfDestroyed() noexcept;
+
+private:
+  // Used until the entity is bound to the ECS registry, which then owns the
+  // kinematics and the hitpoints.
+  sf::Vector2f m_velocity{};
+  int m_hitpoints{0};
+
+  ECS::Registry* m_registry{nullptr};
+  ECS::EntityId m_entity{};
+  LodRenderer const* m_lod_renderer{nullptr};
+};
+} // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -0,0 +1,877 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "entity_catalog.h"
+
+#include "../core/log.h"
+#include "../core/resource_exception.h"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+namespace FastSimDesign {
+namespace {
+constexpr std::array<char, 8> Cache_Magic{
+    'F', 'S', 'D', 'E', 'N', 'T', 'T', '\0'};
+constexpr std::size_t Section_Alignment = 16;
+
+enum class Section : uint16_t
+{
+  AIRCRAFTS,
+  PROJECTILES,
+  PICKUPS,
+  PARTICLES,
+  DIRECTIONS,
+  SPAWNS,
+  SECTION_COUNT
+};
+
+struct CacheSection
+{
+  std::uint32_t offset{0};
+  std::uint32_t count{0};
+};
+
+struct CacheHeader
+{
+  std::array<char, 8> magic{};
+  std::uint32_t version{0};
+  std::uint32_t size{0};
+  // Size and write time of the definitions file the cache was compiled from.
+  std::uint64_t source_size{0};
+  std::int64_t source_time{0};
+  std::array<CacheSection, toUnderlyingType(Section::SECTION_COUNT)>
+      sections{};
+};
+
+constexpr std::string_view Texture_Names[]{
+    "ENTITIES",
+    "JUNGLE",
+    "TITLE_SCREEN",
+    "BUTTONS",
+    "EXPLOSION",
+    "PARTICLE",
+    "FINISH_LINE",
+    "MINION_HIT",
+    "MINION_WALK",
+    "MUSCLE_HIT",
+    "MUSCLE_WALK",
+    "NURSE_IDLE",
+    "NURSE_WALK",
+    "RANGER_IDLE",
+    "RANGER_WALK"};
+static_assert(
+    std::size(Texture_Names) == toUnderlyingType(Textures::ID::TEXTURE_COUNT),
+    "Texture_Names must have one entry per Textures::ID.");
+
+constexpr std::string_view Action_Names[]{
+    "REPAIR",
+    "COLLECT_MISSILES",
+    "INCREASE_SPREAD",
+    "INCREASE_FIRE_RATE"};
+static_assert(
+    std::size(Action_Names) ==
+        toUnderlyingType(PickupData::Action::ACTION_COUNT),
+    "Action_Names must have one entry per PickupData::Action.");
+
+constexpr std::string_view Blend_Names[]{"ALPHA", "ADD"};
+static_assert(
+    std::size(Blend_Names) ==
+        toUnderlyingType(ParticleData::Blend::BLEND_COUNT),
+    "Blend_Names must have one entry per ParticleData::Blend.");
+
+struct Definitions
+{
+  std::vector<AircraftData> aircrafts{};
+  std::vector<ProjectileData> projectiles{};
+  std::vector<PickupData> pickups{};
+  std::vector<ParticleData> particles{};
+  std::vector<Direction> directions{};
+  std::vector<SpawnOffset> spawns{};
+};
+
+////////////////////////////////////////////////////////////
+/// Parsing
+////////////////////////////////////////////////////////////
+/// Reads definitions written as:
+///
+///   # Comment.
+///   [aircraft RAPTOR]
+///   speed = 80
+///   directions = 45 80, -45 160
+///   spawns = 0 500, 100 1100
+///
+/// Sections are `aircraft`, `projectile`, `pickup` or `particle` followed by
+/// the type name. Lists of numbers are separated by spaces.
+///
+/// A projectile `trail` names particle types, which may be defined further in
+/// the file: names are resolved once every section is read.
+///
+/// Definitions start from the built-in tables: a section named after a
+/// built-in type changes the fields it gives, any other adds a type.
+class DefinitionParser final
+{
+public:
+  explicit DefinitionParser(std::filesystem::path const& path)
+    : m_path{path}
+  {
+    m_definitions.aircrafts.assign(
+        std::begin(Aircraft_Table), std::end(Aircraft_Table));
+    m_definitions.projectiles.assign(
+        std::begin(Projectile_Table), std::end(Projectile_Table));
+    m_definitions.pickups.assign(
+        std::begin(Pickup_Table), std::end(Pickup_Table));
+    m_definitions.particles.assign(
+        std::begin(Particle_Table), std::end(Particle_Table));
+    m_definitions.directions.assign(
+        std::begin(Built_In_Directions), std::end(Built_In_Directions));
+    m_definitions.spawns.assign(
+        std::begin(Built_In_Spawns), std::end(Built_In_Spawns));
+  }
+
+  Definitions parse(std::string_view text)
+  {
+    while (!text.empty())
+    {
+      std::size_t end = text.find('\n');
+      std::string_view line = text.substr(0, end);
+      text = end == std::string_view::npos ? std::string_view{}
+                                           : text.substr(end + 1);
+      ++m_line;
+
+      line = trim(line.substr(0, line.find('#')));
+      if (line.empty())
+        continue;
+
+      if (line.front() == '[')
+        parseSection(line);
+      else
+        parseField(line);
+    }
+    checkSection();
+    resolveTrails();
+    return std::move(m_definitions);
+  }
+
+private:
+  [[noreturn]] void fail(std::string const& message) const
+  {
+    fail(m_line, message);
+  }
+
+  [[noreturn]] void fail(std::size_t line, std::string const& message) const
+  {
+    throw ResourceException{
+        m_path.string() + ":" + std::to_string(line) + ": " + message};
+  }
+
+  static std::string_view trim(std::string_view text) noexcept
+  {
+    std::size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos)
+      return {};
+    std::size_t last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+  }
+
+  // Split `text` on spaces and tabs.
+  static std::vector<std::string_view> split(std::string_view text)
+  {
+    std::vector<std::string_view> words;
+    while (!(text = trim(text)).empty())
+    {
+      std::size_t end = text.find_first_of(" \t");
+      words.push_back(text.substr(0, end));
+      text = end == std::string_view::npos ? std::string_view{}
+                                           : text.substr(end);
+    }
+    return words;
+  }
+
+  template<typename T>
+  T toNumber(std::string_view text) const
+  {
+    T value{};
+    auto [end, error] =
+        std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{} || end != text.data() + text.size())
+      fail("'" + std::string{text} + "' is not a valid number");
+    return value;
+  }
+
+  template<typename T, std::size_t N>
+  std::array<T, N> toNumbers(std::string_view text) const
+  {
+    std::vector<std::string_view> words = split(text);
+    if (words.size() != N)
+      fail("expected " + std::to_string(N) + " values");
+
+    std::array<T, N> values{};
+    for (std::size_t i = 0; i < N; ++i)
+      values[i] = toNumber<T>(words[i]);
+    return values;
+  }
+
+  bool toBool(std::string_view text) const
+  {
+    if (text == "true")
+      return true;
+    if (text != "false")
+      fail("expected true or false");
+    return false;
+  }
+
+  template<typename Enum, std::size_t N>
+  Enum toEnum(std::string_view text, std::string_view const (&names)[N]) const
+  {
+    auto it = std::find(std::begin(names), std::end(names), text);
+    if (it == std::end(names))
+      fail("unknown value '" + std::string{text} + "'");
+    return static_cast<Enum>(std::distance(std::begin(names), it));
+  }
+
+  TextureRect toTextureRect(std::string_view text) const
+  {
+    auto [left, top, width, height] = toNumbers<std::int32_t, 4>(text);
+    return TextureRect{left, top, width, height};
+  }
+
+  // Color as "r g b" or "r g b a", packed as RGBA.
+  std::uint32_t toColor(std::string_view text) const
+  {
+    std::vector<std::string_view> words = split(text);
+    if (words.size() != 3 && words.size() != 4)
+      fail("expected a color as 'r g b' or 'r g b a'");
+
+    std::uint32_t color = 0;
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+      std::uint32_t channel = i < words.size()
+                                  ? toNumber<std::uint32_t>(words[i])
+                                  : 255;
+      if (channel > 255)
+        fail("color channels must be in [0, 255]");
+      color = (color << 8) | channel;
+    }
+    return color;
+  }
+
+  // Directions as "angle distance, angle distance, ...".
+  void toDirections(std::string_view text, AircraftData& data)
+  {
+    data.first_direction =
+        static_cast<std::uint32_t>(m_definitions.directions.size());
+    data.direction_count = 0;
+    while (!text.empty())
+    {
+      std::size_t end = text.find(',');
+      auto [angle, distance] = toNumbers<float, 2>(text.substr(0, end));
+      m_definitions.directions.push_back(Direction{angle, distance});
+      ++data.direction_count;
+      text = end == std::string_view::npos ? std::string_view{}
+                                           : text.substr(end + 1);
+    }
+  }
+
+  // Enemy starts as "x y, x y, ...".
+  void toSpawns(std::string_view text, AircraftData& data)
+  {
+    data.first_spawn = static_cast<std::uint32_t>(m_definitions.spawns.size());
+    data.spawn_count = 0;
+    while (!text.empty())
+    {
+      std::size_t end = text.find(',');
+      auto [x, y] = toNumbers<float, 2>(text.substr(0, end));
+      m_definitions.spawns.push_back(SpawnOffset{x, y});
+      ++data.spawn_count;
+      text = end == std::string_view::npos ? std::string_view{}
+                                           : text.substr(end + 1);
+    }
+  }
+
+  // Particle names as "NAME NAME ...", resolved by resolveTrails().
+  void toTrail(std::string_view text)
+  {
+    std::vector<std::string_view> names = split(text);
+    if (names.size() > ProjectileData::Max_Trail_Count)
+      fail(
+          "a trail has at most " +
+          std::to_string(ProjectileData::Max_Trail_Count) + " particles");
+    m_trails.push_back(PendingTrail{m_record, m_line, std::move(names)});
+  }
+
+  void resolveTrails()
+  {
+    for (PendingTrail const& trail : m_trails)
+    {
+      ProjectileData& data = m_definitions.projectiles[trail.record];
+      data.trail = {};
+      data.trail_count = 0;
+      for (std::string_view name : trail.names)
+      {
+        auto it = std::find_if(
+            m_definitions.particles.begin(),
+            m_definitions.particles.end(),
+            [&](ParticleData const& particle) {
+              return std::string_view{particle.name.data()} == name;
+            });
+        if (it == m_definitions.particles.end())
+          fail(trail.line, "unknown particle '" + std::string{name} + "'");
+        data.trail[data.trail_count++] = static_cast<std::uint16_t>(
+            it - m_definitions.particles.begin());
+      }
+    }
+  }
+
+  // Select the record named `name`, a built-in one or a new one.
+  template<typename Data>
+  void selectRecord(std::vector<Data>& records, std::string_view name)
+  {
+    std::string section{m_kind};
+    section.append(" ").append(name);
+    if (std::find(m_sections.begin(), m_sections.end(), section) !=
+        m_sections.end())
+      fail("'" + std::string{name} + "' is already defined");
+    m_sections.push_back(std::move(section));
+
+    auto it = std::find_if(records.begin(), records.end(), [&](Data const& r) {
+      return std::string_view{r.name.data()} == name;
+    });
+    m_record = static_cast<std::size_t>(it - records.begin());
+    if (it == records.end())
+      records.emplace_back().name = toEntityName(name);
+  }
+
+  void parseSection(std::string_view line)
+  {
+    checkSection();
+    if (line.back() != ']')
+      fail("missing ']'");
+
+    std::vector<std::string_view> words =
+        split(line.substr(1, line.size() - 2));
+    if (words.size() != 2)
+      fail("expected '[<kind> <NAME>]'");
+
+    std::string_view kind = words[0];
+    std::string_view name = words[1];
+    if (name.size() >= EntityName{}.size())
+      fail("type name is too long");
+
+    m_kind = kind;
+    m_section_line = m_line;
+    if (kind == "aircraft")
+      selectRecord(m_definitions.aircrafts, name);
+    else if (kind == "projectile")
+      selectRecord(m_definitions.projectiles, name);
+    else if (kind == "pickup")
+      selectRecord(m_definitions.pickups, name);
+    else if (kind == "particle")
+      selectRecord(m_definitions.particles, name);
+    else
+      fail("unknown entity kind '" + std::string{kind} + "'");
+  }
+
+  // Check the fields required by the record of the last section, once all
+  // of them are read.
+  void checkSection() const
+  {
+    if (m_kind != "pickup")
+      return;
+
+    // Pickups that repair or give missiles would apply nothing, and
+    // Entity::repair() asserts on it.
+    PickupData const& data = m_definitions.pickups[m_record];
+    bool const needs_amount =
+        data.action == PickupData::Action::REPAIR ||
+        data.action == PickupData::Action::COLLECT_MISSILES;
+    if (needs_amount && data.amount <= 0)
+      fail(
+          m_section_line,
+          "pickup '" + std::string{data.name.data()} +
+              "' needs a positive 'amount'");
+  }
+
+  void parseField(std::string_view line)
+  {
+    std::size_t equal = line.find('=');
+    if (equal == std::string_view::npos)
+      fail("expected '<key> = <value>'");
+    if (m_kind.empty())
+      fail("field outside of a section");
+
+    std::string_view key = trim(line.substr(0, equal));
+    std::string_view value = trim(line.substr(equal + 1));
+
+    // Fields apply to the record of the last section.
+    if (m_kind == "aircraft")
+      parseAircraftField(m_definitions.aircrafts[m_record], key, value);
+    else if (m_kind == "projectile")
+      parseProjectileField(m_definitions.projectiles[m_record], key, value);
+    else if (m_kind == "pickup")
+      parsePickupField(m_definitions.pickups[m_record], key, value);
+    else
+      parseParticleField(m_definitions.particles[m_record], key, value);
+  }
+
+  void parseAircraftField(
+      AircraftData& data, std::string_view key, std::string_view value)
+  {
+    if (key == "hit_point")
+      data.hit_point = toNumber<std::int32_t>(value);
+    else if (key == "speed")
+      data.speed = toNumber<float>(value);
+    else if (key == "texture")
+      data.texture = toEnum<Textures::ID>(value, Texture_Names);
+    else if (key == "texture_rect")
+      data.texture_rect = toTextureRect(value);
+    else if (key == "fire_interval")
+      data.fire_interval = toNumber<float>(value);
+    else if (key == "directions")
+      toDirections(value, data);
+    else if (key == "spawns")
+      toSpawns(value, data);
+    else if (key == "roll_animation")
+      data.has_roll_animation = toBool(value);
+    else
+      fail("unknown aircraft field '" + std::string{key} + "'");
+  }
+
+  void parseProjectileField(
+      ProjectileData& data, std::string_view key, std::string_view value)
+  {
+    if (key == "damage")
+      data.damage = toNumber<std::int32_t>(value);
+    else if (key == "speed")
+      data.speed = toNumber<float>(value);
+    else if (key == "texture")
+      data.texture = toEnum<Textures::ID>(value, Texture_Names);
+    else if (key == "texture_rect")
+      data.texture_rect = toTextureRect(value);
+    else if (key == "trail")
+      toTrail(value);
+    else
+      fail("unknown projectile field '" + std::string{key} + "'");
+  }
+
+  void parsePickupField(
+      PickupData& data, std::string_view key, std::string_view value)
+  {
+    if (key == "action")
+      data.action = toEnum<PickupData::Action>(value, Action_Names);
+    else if (key == "amount")
+      data.amount = toNumber<std::int32_t>(value);
+    else if (key == "texture")
+      data.texture = toEnum<Textures::ID>(value, Texture_Names);
+    else if (key == "texture_rect")
+      data.texture_rect = toTextureRect(value);
+    else
+      fail("unknown pickup field '" + std::string{key} + "'");
+  }
+
+  void parseParticleField(
+      ParticleData& data, std::string_view key, std::string_view value)
+  {
+    if (key == "color")
+      data.color = toColor(value);
+    else if (key == "lifetime")
+      data.lifetime = toNumber<float>(value);
+    else if (key == "emission_rate")
+      data.emission_rate = toNumber<float>(value);
+    else if (key == "budget")
+      data.budget = toNumber<std::uint32_t>(value);
+    else if (key == "blend")
+      data.blend = toEnum<ParticleData::Blend>(value, Blend_Names);
+    else if (key == "texture")
+      data.texture = toEnum<Textures::ID>(value, Texture_Names);
+    else if (key == "texture_rect")
+      data.texture_rect = toTextureRect(value);
+    else
+      fail("unknown particle field '" + std::string{key} + "'");
+  }
+
+private:
+  struct PendingTrail
+  {
+    std::size_t record{0};
+    std::size_t line{0};
+    std::vector<std::string_view> names{};
+  };
+
+  std::filesystem::path const& m_path;
+  Definitions m_definitions{};
+  std::size_t m_line{0};
+  std::string_view m_kind{};
+  std::size_t m_record{0}; // Of the last section, in the records of its kind.
+  std::size_t m_section_line{0};
+  std::vector<std::string> m_sections{}; // As "<kind> <NAME>".
+  std::vector<PendingTrail> m_trails{};
+};
+
+////////////////////////////////////////////////////////////
+/// Compilation
+////////////////////////////////////////////////////////////
+template<typename Data>
+void appendSection(
+    std::vector<std::byte>& blob,
+    CacheHeader& header,
+    Section section,
+    std::vector<Data> const& records)
+{
+  std::size_t offset =
+      (blob.size() + Section_Alignment - 1) / Section_Alignment *
+      Section_Alignment;
+  blob.resize(offset + records.size() * sizeof(Data));
+  if (!records.empty())
+    std::memcpy(
+        blob.data() + offset,
+        records.data(),
+        records.size() * sizeof(Data));
+
+  header.sections[toUnderlyingType(section)] = CacheSection{
+      static_cast<std::uint32_t>(offset),
+      static_cast<std::uint32_t>(records.size())};
+}
+
+// Built-in types are already at the index of their enum value, since the
+// definitions start from their tables.
+std::vector<std::byte> compile(
+    Definitions const& definitions,
+    std::uint64_t source_size,
+    std::int64_t source_time)
+{
+  CacheHeader header{};
+  header.magic = Cache_Magic;
+  header.version = EntityCatalog::Cache_Version;
+  header.source_size = source_size;
+  header.source_time = source_time;
+
+  std::vector<std::byte> blob(sizeof(CacheHeader));
+  appendSection(blob, header, Section::AIRCRAFTS, definitions.aircrafts);
+  appendSection(blob, header, Section::PROJECTILES, definitions.projectiles);
+  appendSection(blob, header, Section::PICKUPS, definitions.pickups);
+  appendSection(blob, header, Section::PARTICLES, definitions.particles);
+  appendSection(blob, header, Section::DIRECTIONS, definitions.directions);
+  appendSection(blob, header, Section::SPAWNS, definitions.spawns);
+
+  header.size = static_cast<std::uint32_t>(blob.size());
+  std::memcpy(blob.data(), &header, sizeof(CacheHeader));
+  return blob;
+}
+
+// Return an empty span if the section does not fit in the blob.
+template<typename Data>
+std::span<Data const> viewSection(
+    std::span<std::byte const> blob,
+    CacheHeader const& header,
+    Section section) noexcept
+{
+  CacheSection const& range = header.sections[toUnderlyingType(section)];
+  if (range.offset % alignof(Data) != 0 || range.offset > blob.size() ||
+      range.count > (blob.size() - range.offset) / sizeof(Data))
+    return {};
+
+  return {
+      reinterpret_cast<Data const*>(blob.data() + range.offset),
+      range.count};
+}
+
+template<typename Data>
+bool hasValidNames(std::span<Data const> records) noexcept
+{
+  return std::all_of(records.begin(), records.end(), [](Data const& record) {
+    return record.name.back() == '\0';
+  });
+}
+
+template<typename Enum>
+bool isValidEnum(Enum value, Enum count) noexcept
+{
+  return toUnderlyingType(value) < toUnderlyingType(count);
+}
+
+// Mapped bytes may hold any value, a bool is only read once known to be 0 or
+// 1.
+bool isValidBool(bool const& value) noexcept
+{
+  unsigned char byte = 0;
+  std::memcpy(&byte, &value, sizeof(byte));
+  return byte <= 1;
+}
+
+template<typename Data>
+bool hasValidTextures(std::span<Data const> records) noexcept
+{
+  return std::all_of(records.begin(), records.end(), [](Data const& record) {
+    return isValidEnum(record.texture, Textures::ID::TEXTURE_COUNT);
+  });
+}
+
+template<typename Data>
+std::optional<std::uint16_t> findByName(
+    std::span<Data const> records, std::string_view name) noexcept
+{
+  for (std::size_t i = 0; i < records.size(); ++i)
+  {
+    if (std::string_view{records[i].name.data()} == name)
+      return static_cast<std::uint16_t>(i);
+  }
+  return std::nullopt;
+}
+
+std::string readFile(std::filesystem::path const& path)
+{
+  std::ifstream file{path, std::ios::binary};
+  if (!file)
+    throw ResourceException{"Failed to open " + path.string()};
+
+  std::ostringstream text;
+  text << file.rdbuf();
+  return text.str();
+}
+
+// Write next to the cache then rename, so that a crash never leaves a
+// truncated cache behind.
+bool writeCache(
+    std::filesystem::path const& path, std::vector<std::byte> const& blob)
+{
+  std::filesystem::path temporary = path;
+  temporary += ".tmp";
+  {
+    std::ofstream file{temporary, std::ios::binary | std::ios::trunc};
+    if (!file)
+      return false;
+
+    file.write(
+        reinterpret_cast<char const*>(blob.data()),
+        static_cast<std::streamsize>(blob.size()));
+    if (!file)
+      return false;
+  }
+
+  std::error_code error;
+  std::filesystem::rename(temporary, path, error);
+  if (error)
+    std::filesystem::remove(temporary, error);
+  return !error;
+}
+
+EntityCatalog const* Current_Catalog{nullptr};
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+EntityCatalog const& EntityCatalog::getCurrent() noexcept
+{
+  assert(Current_Catalog && "No entity catalog has been loaded.");
+  return *Current_Catalog;
+}
+
+void EntityCatalog::setCurrent(EntityCatalog const* catalog) noexcept
+{
+  Current_Catalog = catalog;
+}
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+void EntityCatalog::load(
+    std::filesystem::path const& definitions,
+    std::filesystem::path const& cache)
+{
+  std::error_code error;
+  std::uint64_t const source_size =
+      std::filesystem::file_size(definitions, error);
+  if (error)
+    throw ResourceException{"Failed to open " + definitions.string()};
+  std::int64_t const source_time = static_cast<std::int64_t>(
+      std::filesystem::last_write_time(definitions, error)
+          .time_since_epoch()
+          .count());
+
+  if (m_cache_file.open(cache) &&
+      assign(m_cache_file.getBytes(), source_size, source_time))
+  {
+    LOG_INFO("Entity catalog mapped from {}.", cache.string());
+    return;
+  }
+  m_cache_file.close();
+
+  std::string const text = readFile(definitions);
+  std::vector<std::byte> blob = compile(
+      DefinitionParser{definitions}.parse(text), source_size, source_time);
+
+  if (writeCache(cache, blob) && m_cache_file.open(cache) &&
+      assign(m_cache_file.getBytes(), source_size, source_time))
+  {
+    LOG_INFO(
+        "Entity catalog compiled from {} into {}.",
+        definitions.string(),
+        cache.string());
+    return;
+  }
+  m_cache_file.close();
+
+  LOG_WARN(
+      "Entity catalog cache {} could not be written, using it from memory.",
+      cache.string());
+  m_blob = std::move(blob);
+  [[maybe_unused]] bool const assigned =
+      assign(m_blob, source_size, source_time);
+  assert(assigned && "A freshly compiled catalog must be valid.");
+}
+
+bool EntityCatalog::isLoadedFromCache() const noexcept
+{
+  return m_cache_file.isOpen();
+}
+
+bool EntityCatalog::assign(
+    std::span<std::byte const> blob,
+    std::uint64_t source_size,
+    std::int64_t source_time) noexcept
+{
+  CacheHeader header{};
+  if (blob.size() < sizeof(CacheHeader))
+    return false;
+  std::memcpy(&header, blob.data(), sizeof(CacheHeader));
+
+  // Stale or foreign cache: rebuild it.
+  if (header.magic != Cache_Magic || header.version != Cache_Version ||
+      header.size != blob.size() || header.source_size != source_size ||
+      header.source_time != source_time)
+    return false;
+
+  auto aircrafts = viewSection<AircraftData>(blob, header, Section::AIRCRAFTS);
+  auto projectiles =
+      viewSection<ProjectileData>(blob, header, Section::PROJECTILES);
+  auto pickups = viewSection<PickupData>(blob, header, Section::PICKUPS);
+  auto particles = viewSection<ParticleData>(blob, header, Section::PARTICLES);
+  auto directions = viewSection<Direction>(blob, header, Section::DIRECTIONS);
+  auto spawns = viewSection<SpawnOffset>(blob, header, Section::SPAWNS);
+
+  if (aircrafts.size() < std::size(Aircraft_Table) ||
+      projectiles.size() < std::size(Projectile_Table) ||
+      pickups.size() < std::size(Pickup_Table) ||
+      particles.size() < std::size(Particle_Table))
+    return false;
+
+  // Every index and enum is checked, a corrupted cache is rebuilt instead of
+  // indexing past the texture holder, a pool or the particle systems.
+  if (!hasValidNames(aircrafts) || !hasValidNames(projectiles) ||
+      !hasValidNames(pickups) || !hasValidNames(particles))
+    return false;
+  if (!hasValidTextures(aircrafts) || !hasValidTextures(projectiles) ||
+      !hasValidTextures(pickups) || !hasValidTextures(particles))
+    return false;
+
+  for (AircraftData const& aircraft : aircrafts)
+  {
+    if (aircraft.first_direction > directions.size() ||
+        aircraft.direction_count >
+            directions.size() - aircraft.first_direction ||
+        aircraft.first_spawn > spawns.size() ||
+        aircraft.spawn_count > spawns.size() - aircraft.first_spawn ||
+        !isValidBool(aircraft.has_roll_animation))
+      return false;
+  }
+
+  for (ProjectileData const& projectile : projectiles)
+  {
+    if (projectile.trail_count > ProjectileData::Max_Trail_Count)
+      return false;
+    for (std::uint16_t particle : projectile.getTrail())
+    {
+      if (particle >= particles.size())
+        return false;
+    }
+  }
+
+  for (PickupData const& pickup : pickups)
+  {
+    if (!isValidEnum(pickup.action, PickupData::Action::ACTION_COUNT))
+      return false;
+  }
+
+  for (ParticleData const& particle : particles)
+  {
+    if (!isValidEnum(particle.blend, ParticleData::Blend::BLEND_COUNT))
+      return false;
+  }
+
+  m_aircrafts = aircrafts;
+  m_projectiles = projectiles;
+  m_pickups = pickups;
+  m_particles = particles;
+  m_directions = directions;
+  m_spawns = spawns;
+  return true;
+}
+
+std::span<AircraftData const> EntityCatalog::getAircrafts() const noexcept
+{
+  return m_aircrafts;
+}
+
+std::span<ProjectileData const> EntityCatalog::getProjectiles() const noexcept
+{
+  return m_projectiles;
+}
+
+std::span<PickupData const> EntityCatalog::getPickups() const noexcept
+{
+  return m_pickups;
+}
+
+std::span<ParticleData const> EntityCatalog::getParticles() const noexcept
+{
+  return m_particles;
+}
+
+std::optional<Aircraft::Type> EntityCatalog::findAircraft(
+    std::string_view name) const noexcept
+{
+  if (auto index = findByName(m_aircrafts, name))
+    return static_cast<Aircraft::Type>(*index);
+  return std::nullopt;
+}
+
+std::optional<Projectile::Type> EntityCatalog::findProjectile(
+    std::string_view name) const noexcept
+{
+  if (auto index = findByName(m_projectiles, name))
+    return static_cast<Projectile::Type>(*index);
+  return std::nullopt;
+}
+
+std::optional<Pickup::Type> EntityCatalog::findPickup(
+    std::string_view name) const noexcept
+{
+  if (auto index = findByName(m_pickups, name))
+    return static_cast<Pickup::Type>(*index);
+  return std::nullopt;
+}
+
+std::optional<Particle::Type> EntityCatalog::findParticle(
+    std::string_view name) const noexcept
+{
+  if (auto index = findByName(m_particles, name))
+    return static_cast<Particle::Type>(*index);
+  return std::nullopt;
+}
+} // namespace FastSimDesign
\ No newline at end of file
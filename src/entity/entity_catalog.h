@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ENTITY_CATALOG_H
+#define FAST_SIM_DESIGN_ENTITY_CATALOG_H
+
+#include "../core/mapped_file.h"
+#include "entity_data.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace FastSimDesign {
+/// Entity type definitions: the built-in tables of entity_data.h, tuned and
+/// extended by a text file edited by designers.
+///
+/// The first load compiles the definitions into a packed binary cache. Next
+/// starts map that cache as long as the definitions file is unchanged, so no
+/// parsing happens at runtime. Records are indexed by type: built-in types sit
+/// at the index of their enum value and any other definition is appended
+/// after them, so new types need no code change.
+class EntityCatalog final
+{
+public:
+  // Bump when a record layout, the cache format or a built-in table changes.
+  static constexpr std::uint32_t Cache_Version = 5;
+
+public:
+  explicit EntityCatalog() = default;
+  EntityCatalog(EntityCatalog const&) = delete;
+  EntityCatalog(EntityCatalog&&) = default;
+  EntityCatalog& operator=(EntityCatalog const&) = delete;
+  EntityCatalog& operator=(EntityCatalog&&) = default;
+  virtual ~EntityCatalog() = default;
+
+  // Map the cache if it is up to date with the definitions, otherwise compile
+  // the definitions and rewrite the cache. Throw a ResourceException if the
+  // definitions can not be read or are invalid.
+  void load(
+      std::filesystem::path const& definitions,
+      std::filesystem::path const& cache);
+  bool isLoadedFromCache() const noexcept;
+
+  AircraftData const& getData(Aircraft::Type type) const noexcept;
+  ProjectileData const& getData(Projectile::Type type) const noexcept;
+  PickupData const& getData(Pickup::Type type) const noexcept;
+  ParticleData const& getData(Particle::Type type) const noexcept;
+  std::span<Direction const> getDirections(
+      AircraftData const& data) const noexcept;
+  std::span<SpawnOffset const> getSpawns(
+      AircraftData const& data) const noexcept;
+
+  std::span<AircraftData const> getAircrafts() const noexcept;
+  std::span<ProjectileData const> getProjectiles() const noexcept;
+  std::span<PickupData const> getPickups() const noexcept;
+  std::span<ParticleData const> getParticles() const noexcept;
+
+  std::optional<Aircraft::Type> findAircraft(
+      std::string_view name) const noexcept;
+  std::optional<Projectile::Type> findProjectile(
+      std::string_view name) const noexcept;
+  std::optional<Pickup::Type> findPickup(std::string_view name) const noexcept;
+  std::optional<Particle::Type> findParticle(
+      std::string_view name) const noexcept;
+
+  // Catalog read by the entities. It is set once at startup, before any
+  // entity is created, and stays read-only afterwards.
+  static EntityCatalog const& getCurrent() noexcept;
+  static void setCurrent(EntityCatalog const* catalog) noexcept;
+
+private:
+  bool assign(
+      std::span<std::byte const> blob,
+      std::uint64_t source_size,
+      std::int64_t source_time) noexcept;
+
+private:
+  MappedFile m_cache_file{};
+  std::vector<std::byte> m_blob{}; // Used if the cache could not be written.
+  std::span<AircraftData const> m_aircrafts{};
+  std::span<ProjectileData const> m_projectiles{};
+  std::span<PickupData const> m_pickups{};
+  std::span<ParticleData const> m_particles{};
+  std::span<Direction const> m_directions{};
+  std::span<SpawnOffset const> m_spawns{};
+};
+
+////////////////////////////////////////////////////////////
+/// Access
+////////////////////////////////////////////////////////////
+inline AircraftData const& EntityCatalog::getData(
+    Aircraft::Type type) const noexcept
+{
+  assert(toUnderlyingType(type) < m_aircrafts.size());
+  return m_aircrafts[toUnderlyingType(type)];
+}
+
+inline ProjectileData const& EntityCatalog::getData(
+    Projectile::Type type) const noexcept
+{
+  assert(toUnderlyingType(type) < m_projectiles.size());
+  return m_projectiles[toUnderlyingType(type)];
+}
+
+inline PickupData const& EntityCatalog::getData(
+    Pickup::Type type) const noexcept
+{
+  assert(toUnderlyingType(type) < m_pickups.size());
+  return m_pickups[toUnderlyingType(type)];
+}
+
+inline ParticleData const& EntityCatalog::getData(
+    Particle::Type type) const noexcept
+{
+  assert(toUnderlyingType(type) < m_particles.size());
+  return m_particles[toUnderlyingType(type)];
+}
+
+inline std::span<Direction const> EntityCatalog::getDirections(
+    AircraftData const& data) const noexcept
+{
+  return m_directions.subspan(data.first_direction, data.direction_count);
+}
+
+inline std::span<SpawnOffset const> EntityCatalog::getSpawns(
+    AircraftData const& data) const noexcept
+{
+  return m_spawns.subspan(data.first_spawn, data.spawn_count);
+}
+
+template<typename Type>
+inline auto const& getData(Type type) noexcept
+{
+  return EntityCatalog::getCurrent().getData(type);
+}
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -14,62 +14,302 @@
 #define FAST_SIM_DESIGN_ENTITY_DATA_H
 
 #include "../core/resource_identifiers.h"
+#include "../utils/generic_utility.h"
 #include "aircraft.h"
 #include "particle.h"
 #include "pickup.h"
 #include "projectile.h"
 
-#include <functional>
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Time.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
 
 namespace FastSimDesign {
-struct Direction
+// Records are plain data without pointers: the entity catalog stores them as
+// is in its binary cache and maps that file back on the next start.
+using EntityName = std::array<char, 32>;
+
+struct TextureRect
 {
-  explicit Direction(float angle_, float distance_) noexcept;
-  Direction(Direction const&) = default;
-  Direction(Direction&&) = default;
-  Direction& operator=(Direction const&) = default;
-  Direction& operator=(Direction&&) = default;
-  virtual ~Direction() = default;
+  std::int32_t left{0};
+  std::int32_t top{0};
+  std::int32_t width{0};
+  std::int32_t height{0};
+
+  sf::IntRect toIntRect() const noexcept
+  {
+    return sf::IntRect{left, top, width, height};
+  }
+};
 
+struct Direction
+{
   float angle{0.f};
   float distance{0.f};
 };
 
+// Start of an enemy, from the start of the player, `y` ahead of it.
+struct SpawnOffset
+{
+  float x{0.f};
+  float y{0.f};
+};
+
 struct AircraftData
 {
-  int hit_point{0};
+  EntityName name{};
+  std::int32_t hit_point{0};
   float speed{0.f};
   Textures::ID texture{};
-  sf::IntRect m_texture_rect{};
-  sf::Time fire_interval{sf::Time::Zero};
-  std::vector<Direction> directions{};
-  bool has_rool_animation{false};
+  TextureRect texture_rect{};
+  float fire_interval{0.f}; // In seconds, zero if the aircraft can not fire.
+  std::uint32_t first_direction{0}; // Movement pattern in the direction pool.
+  std::uint32_t direction_count{0};
+  std::uint32_t first_spawn{0}; // Enemies of the type in the spawn pool.
+  std::uint32_t spawn_count{0};
+  bool has_roll_animation{false};
+
+  sf::Time getFireInterval() const noexcept
+  {
+    return sf::seconds(fire_interval);
+  }
 };
 
 struct ProjectileData
 {
-  int damage{0};
+  static constexpr std::size_t Max_Trail_Count = 4;
+
+  EntityName name{};
+  std::int32_t damage{0};
   float speed{0.f};
   Textures::ID texture{};
-  sf::IntRect m_texture_rect{};
+  TextureRect texture_rect{};
+  // Particle types emitted behind the projectile, the first `trail_count`.
+  std::array<std::uint16_t, Max_Trail_Count> trail{};
+  std::uint32_t trail_count{0};
+
+  std::span<std::uint16_t const> getTrail() const noexcept
+  {
+    return std::span<std::uint16_t const>{trail}.first(trail_count);
+  }
 };
 
 struct PickupData
 {
-  std::function<void(Aircraft&)> action{};
+  enum class Action : uint16_t
+  {
+    REPAIR,
+    COLLECT_MISSILES,
+    INCREASE_SPREAD,
+    INCREASE_FIRE_RATE,
+    ACTION_COUNT
+  };
+
+  EntityName name{};
+  Action action{};
+  std::int32_t amount{0};
   Textures::ID texture{};
-  sf::IntRect m_texture_rect{};
+  TextureRect texture_rect{};
 };
 
 struct ParticleData
 {
-  sf::Color m_color{};
-  sf::Time m_lifetime{};
+  enum class Blend : uint16_t
+  {
+    ALPHA,
+    ADD,
+    BLEND_COUNT
+  };
+
+  EntityName name{};
+  std::uint32_t color{0}; // RGBA.
+  float lifetime{0.f}; // In seconds.
+  float emission_rate{30.f}; // Particles per second and emitter.
+  std::uint32_t budget{1 << 14}; // Live particles shared by all emitters.
+  Blend blend{Blend::ALPHA};
+  Textures::ID texture{Textures::ID::PARTICLE};
+  TextureRect texture_rect{}; // Whole texture when empty.
+
+  sf::Color getColor() const noexcept { return sf::Color{color}; }
+  sf::Time getLifetime() const noexcept { return sf::seconds(lifetime); }
+  sf::BlendMode getBlendMode() const noexcept
+  {
+    return blend == Blend::ADD ? sf::BlendAdd : sf::BlendAlpha;
+  }
 };
 
-std::unordered_map<Aircraft::Type, AircraftData> initializeAircraftData();
-std::unordered_map<Projectile::Type, ProjectileData> initializeProjectileData();
-std::unordered_map<Pickup::Type, PickupData> initializePickupData();
-std::unordered_map<Particle::Type, ParticleData> initializeParticleData();
+static_assert(
+    std::is_trivially_copyable_v<AircraftData> &&
+        std::is_trivially_copyable_v<ProjectileData> &&
+        std::is_trivially_copyable_v<PickupData> &&
+        std::is_trivially_copyable_v<ParticleData> &&
+        std::is_trivially_copyable_v<Direction> &&
+        std::is_trivially_copyable_v<SpawnOffset>,
+    "Entity records must be plain data.");
+
+////////////////////////////////////////////////////////////
+/// Built-in types
+////////////////////////////////////////////////////////////
+constexpr EntityName toEntityName(std::string_view name) noexcept
+{
+  EntityName entity_name{};
+  for (std::size_t i = 0; i < name.size() && i + 1 < entity_name.size(); ++i)
+    entity_name[i] = name[i];
+  return entity_name;
+}
+
+// True when the table has one entry per enum value and no name twice.
+template<typename Type, typename Data, std::size_t N>
+inline constexpr bool isIndexedByType(Data const (&table)[N]) noexcept
+{
+  if (N != toUnderlyingType(Type::TYPE_COUNT))
+    return false;
+
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    for (std::size_t j = i + 1; j < N; ++j)
+    {
+      if (table[i].name == table[j].name)
+        return false;
+    }
+  }
+  return true;
+}
+
+// Types referenced by the code, stored at the index of their enum value. The
+// entity catalog starts from these tables: its definitions file tunes them
+// and appends other types after them.
+inline constexpr Direction Built_In_Directions[]{
+    // RAPTOR
+    {45.f, 80.f},
+    {-45.f, 160.f},
+    {45.f, 80.f},
+    // AVENGER
+    {45.f, 50.f},
+    {0.f, 50.f},
+    {-45.f, 100.f},
+    {0.f, 50.f},
+    {45.f, 50.f}};
+
+inline constexpr SpawnOffset Built_In_Spawns[]{
+    // RAPTOR
+    {0.f, 500.f},
+    {0.f, 1000.f},
+    {100.f, 1100.f},
+    {-100.f, 1100.f},
+    // AVENGER
+    {-70.f, 1400.f},
+    {-70.f, 1600.f},
+    {70.f, 1400.f},
+    {70.f, 1600.f}};
+
+inline constexpr AircraftData Aircraft_Table[]{
+    {.name = toEntityName("EAGLE"),
+     .hit_point = 100,
+     .speed = 200.f,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {0, 0, 48, 64},
+     .fire_interval = 1.f,
+     .has_roll_animation = true},
+    {.name = toEntityName("RAPTOR"),
+     .hit_point = 20,
+     .speed = 80.f,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {144, 0, 84, 64},
+     .fire_interval = 0.f,
+     .first_direction = 0,
+     .direction_count = 3,
+     .first_spawn = 0,
+     .spawn_count = 4,
+     .has_roll_animation = false},
+    {.name = toEntityName("AVENGER"),
+     .hit_point = 40,
+     .speed = 50.f,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {228, 0, 60, 59},
+     .fire_interval = 2.f,
+     .first_direction = 3,
+     .direction_count = 5,
+     .first_spawn = 4,
+     .spawn_count = 4,
+     .has_roll_animation = false}};
+static_assert(
+    isIndexedByType<Aircraft::Type>(Aircraft_Table),
+    "Aircraft_Table must have one entry per Aircraft::Type, in enum order.");
+
+inline constexpr ProjectileData Projectile_Table[]{
+    {.name = toEntityName("ALLIED_BULLET"),
+     .damage = 10,
+     .speed = 300.f,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {175, 64, 3, 14}},
+    {.name = toEntityName("ENEMY_BULLET"),
+     .damage = 10,
+     .speed = 300.f,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {178, 64, 3, 14}},
+    {.name = toEntityName("MISSILE"),
+     .damage = 200,
+     .speed = 150.f,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {160, 64, 15, 32},
+     .trail =
+         {toUnderlyingType(Particle::Type::SMOKE),
+          toUnderlyingType(Particle::Type::PROPELLANT)},
+     .trail_count = 2}};
+static_assert(
+    isIndexedByType<Projectile::Type>(Projectile_Table),
+    "Projectile_Table must have one entry per Projectile::Type, in enum "
+    "order.");
+
+inline constexpr PickupData Pickup_Table[]{
+    {.name = toEntityName("HEALTH_REFILL"),
+     .action = PickupData::Action::REPAIR,
+     .amount = 25,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {0, 64, 40, 40}},
+    {.name = toEntityName("MISSILE_REFILL"),
+     .action = PickupData::Action::COLLECT_MISSILES,
+     .amount = 3,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {40, 64, 40, 40}},
+    {.name = toEntityName("FIRE_SPREAD"),
+     .action = PickupData::Action::INCREASE_SPREAD,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {80, 64, 40, 40}},
+    {.name = toEntityName("FIRE_RATE"),
+     .action = PickupData::Action::INCREASE_FIRE_RATE,
+     .texture = Textures::ID::ENTITIES,
+     .texture_rect = {120, 64, 40, 40}}};
+static_assert(
+    isIndexedByType<Pickup::Type>(Pickup_Table),
+    "Pickup_Table must have one entry per Pickup::Type, in enum order.");
+
+inline constexpr ParticleData Particle_Table[]{
+    {.name = toEntityName("PROPELLANT"),
+     .color = 0xFFFF32FF,
+     .lifetime = 0.6f,
+     .emission_rate = 30.f,
+     .budget = 4096,
+     .blend = ParticleData::Blend::ALPHA,
+     .texture = Textures::ID::PARTICLE},
+    {.name = toEntityName("SMOKE"),
+     .color = 0x323232FF,
+     .lifetime = 4.f,
+     .emission_rate = 30.f,
+     .budget = 16384,
+     .blend = ParticleData::Blend::ALPHA,
+     .texture = Textures::ID::PARTICLE}};
+static_assert(
+    isIndexedByType<Particle::Type>(Particle_Table),
+    "Particle_Table must have one entry per Particle::Type, in enum order.");
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "entity_pool.h"
+
+#include "../utils/generic_utility.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+EntityPool::EntityPool(
+    TextureHolder const& textures, FontHolder const& fonts) noexcept
+  : Parent{}
+  , m_textures{textures}
+  , m_fonts{fonts}
+{
+}
+
+std::unique_ptr<Aircraft> EntityPool::acquire(
+    Aircraft::Type type, sf::Vector2f position)
+{
+  return acquireFrom(m_aircrafts, type, position, m_textures, m_fonts);
+}
+
+std::unique_ptr<Projectile> EntityPool::acquire(
+    Projectile::Type type, sf::Vector2f position)
+{
+  return acquireFrom(m_projectiles, type, position, m_textures);
+}
+
+std::unique_ptr<Pickup> EntityPool::acquire(
+    Pickup::Type type, sf::Vector2f position)
+{
+  return acquireFrom(m_pickups, type, position, m_textures);
+}
+
+void EntityPool::reserve(Aircraft::Type type, std::size_t count)
+{
+  reserveIn(m_aircrafts, type, count, m_textures, m_fonts);
+}
+
+void EntityPool::reserve(Projectile::Type type, std::size_t count)
+{
+  reserveIn(m_projectiles, type, count, m_textures);
+}
+
+void EntityPool::recycle(SceneNode::Ptr node) noexcept
+{
+  SceneNode* raw = node.get();
+  if (dynamic_cast<Aircraft*>(raw))
+    recycleInto(m_aircrafts, std::unique_ptr<Aircraft>{
+        static_cast<Aircraft*>(node.release())});
+  else if (dynamic_cast<Projectile*>(raw))
+    recycleInto(m_projectiles, std::unique_ptr<Projectile>{
+        static_cast<Projectile*>(node.release())});
+  else if (dynamic_cast<Pickup*>(raw))
+    recycleInto(m_pickups, std::unique_ptr<Pickup>{
+        static_cast<Pickup*>(node.release())});
+}
+
+std::size_t EntityPool::getFreeCount() const noexcept
+{
+  std::size_t count = 0;
+  for (auto const& free : m_aircrafts.free)
+    count += free.size();
+  for (auto const& free : m_projectiles.free)
+    count += free.size();
+  for (auto const& free : m_pickups.free)
+    count += free.size();
+  return count;
+}
+
+void EntityPool::clear() noexcept
+{
+  m_aircrafts = Pool<Aircraft>{};
+  m_projectiles = Pool<Projectile>{};
+  m_pickups = Pool<Pickup>{};
+}
+
+template<typename T, typename Type, typename... Args>
+std::unique_ptr<T> EntityPool::acquireFrom(
+    Pool<T>& pool, Type type, sf::Vector2f position, Args const&... args)
+{
+  std::size_t const index = toUnderlyingType(type);
+  std::unique_ptr<T> node;
+  if (index < pool.free.size() && !pool.free[index].empty())
+  {
+    node = std::move(pool.free[index].back());
+    pool.free[index].pop_back();
+  }
+  else
+  {
+    node = getPrototype(pool, type, args...).clone();
+  }
+
+  node->reset(type, position);
+  return node;
+}
+
+template<typename T, typename Type, typename... Args>
+void EntityPool::reserveIn(
+    Pool<T>& pool, Type type, std::size_t count, Args const&... args)
+{
+  std::size_t const index = toUnderlyingType(type);
+  T& prototype = getPrototype(pool, type, args...);
+  std::vector<std::unique_ptr<T>>& free = pool.free[index];
+
+  count = std::min(count, Max_Free_Per_Type);
+  free.reserve(count);
+  while (free.size() < count)
+    free.push_back(prototype.clone());
+}
+
+template<typename T, typename Type, typename... Args>
+T& EntityPool::getPrototype(Pool<T>& pool, Type type, Args const&... args)
+{
+  std::size_t const index = toUnderlyingType(type);
+  if (index >= pool.prototypes.size())
+  {
+    pool.prototypes.resize(index + 1);
+    pool.free.resize(index + 1);
+  }
+
+  // The free list is sized once, recycling then never allocates.
+  if (!pool.prototypes[index])
+  {
+    pool.prototypes[index] = std::make_unique<T>(type, args...);
+    pool.free[index].reserve(Max_Free_Per_Type);
+  }
+  return *pool.prototypes[index];
+}
+
+template<typename T>
+void EntityPool::recycleInto(Pool<T>& pool, std::unique_ptr<T> node) noexcept
+{
+  // Nodes of a type never acquired from the pool, such as the player, have
+  // no free list to go to and die.
+  std::size_t const index = toUnderlyingType(node->getType());
+  if (index >= pool.free.size() || !pool.prototypes[index] ||
+      pool.free[index].size() >= Max_Free_Per_Type)
+    return;
+
+  pool.free[index].push_back(std::move(node));
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,95 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ENTITY_POOL_H
+#define FAST_SIM_DESIGN_ENTITY_POOL_H
+
+#include "../core/resource_identifiers.h"
+#include "../gui/scene_node.h"
+#include "aircraft.h"
+#include "pickup.h"
+#include "projectile.h"
+
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace FastSimDesign {
+/// Per-type pools of aircrafts, projectiles and pickups.
+///
+/// Wrecks removed from the scene graph are kept and reset on the next spawn of
+/// their type. When a pool is empty, the instance is cloned from a prototype
+/// built once per type, which skips the texture, font and text setup of the
+/// constructors.
+class EntityPool final : public NodeRecycler
+{
+public:
+  // Instances kept per type, extra wrecks are destroyed.
+  static constexpr std::size_t Max_Free_Per_Type = 128;
+
+private:
+  using Parent = NodeRecycler;
+
+  template<typename T>
+  struct Pool
+  {
+    std::vector<std::unique_ptr<T>> prototypes{};
+    std::vector<std::vector<std::unique_ptr<T>>> free{};
+  };
+
+public:
+  explicit EntityPool(
+      TextureHolder const& textures, FontHolder const& fonts) noexcept;
+  EntityPool(EntityPool const&) = delete;
+  EntityPool(EntityPool&&) = default;
+  EntityPool& operator=(EntityPool const&) = delete;
+  EntityPool& operator=(EntityPool&&) = delete;
+  virtual ~EntityPool() = default;
+
+  std::unique_ptr<Aircraft> acquire(
+      Aircraft::Type type, sf::Vector2f position);
+  std::unique_ptr<Projectile> acquire(
+      Projectile::Type type, sf::Vector2f position);
+  std::unique_ptr<Pickup> acquire(Pickup::Type type, sf::Vector2f position);
+
+  // Fill the pool of a type up to `count` instances ahead of a wave.
+  void reserve(Aircraft::Type type, std::size_t count);
+  void reserve(Projectile::Type type, std::size_t count);
+
+  virtual void recycle(SceneNode::Ptr node) noexcept override;
+
+  std::size_t getFreeCount() const noexcept;
+  void clear() noexcept;
+
+private:
+  template<typename T, typename Type, typename... Args>
+  std::unique_ptr<T> acquireFrom(
+      Pool<T>& pool, Type type, sf::Vector2f position, Args const&... args);
+  template<typename T, typename Type, typename... Args>
+  void reserveIn(
+      Pool<T>& pool, Type type, std::size_t count, Args const&... args);
+  template<typename T, typename Type, typename... Args>
+  T& getPrototype(Pool<T>& pool, Type type, Args const&... args);
+  template<typename T>
+  void recycleInto(Pool<T>& pool, std::unique_ptr<T> node) noexcept;
+
+private:
+  TextureHolder const& m_textures;
+  FontHolder const& m_fonts;
+  Pool<Aircraft> m_aircrafts{};
+  Pool<Projectile> m_projectiles{};
+  Pool<Pickup> m_pickups{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,50 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_GAMEPLAY_EVENT_H
+#define FAST_SIM_DESIGN_GAMEPLAY_EVENT_H
+
+#include "../core/handle.h"
+#include "../utils/bit_flags.h"
+#include "category.h"
+#include "pickup.h"
+
+#include <SFML/System/Vector2.hpp>
+
+namespace FastSimDesign {
+namespace GameplayEvent {
+// Pair of colliding nodes. Either node may already be removed from the scene
+// when the event is read, resolving its handle then gives nothing.
+struct Collided
+{
+  Handle a;
+  Handle b;
+};
+
+// Entity just destroyed. The node may already be removed from the scene when
+// the event is read, resolving its handle then gives nothing. The category is
+// stored raw to keep the event trivially copyable, see `BitFlags::FromRaw()`.
+struct Destroyed
+{
+  Handle id;
+  BitFlags<Category::Type>::UnderlyingT category;
+  sf::Vector2f position;
+};
+
+struct PickupCollected
+{
+  Pickup::Type type;
+  sf::Vector2f position;
+};
+} // namespace GameplayEvent
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "health_bar_node.h"
+
+#include "../core/service_registry.h"
+#include "../ecs/components.h"
+#include "../gui/software_render_target.h"
+#include "entity_catalog.h"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <algorithm>
+
+namespace FastSimDesign {
+namespace {
+void appendQuad(
+    std::vector<sf::Vertex>& vertices,
+    sf::Vector2f top_left,
+    sf::Vector2f size,
+    sf::Color color)
+{
+  vertices.emplace_back(top_left, color);
+  vertices.emplace_back(top_left + sf::Vector2f{size.x, 0.f}, color);
+  vertices.emplace_back(top_left + size, color);
+  vertices.emplace_back(top_left + sf::Vector2f{0.f, size.y}, color);
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+void HealthBarNode::rebuild(ECS::Registry& registry)
+{
+  m_vertices.clear();
+  registry.query<ECS::Position, ECS::Hitpoints, ECS::AircraftInfo>()
+      .eachChunk<ECS::Position, ECS::Hitpoints, ECS::AircraftInfo>(
+          [this](
+              std::size_t count,
+              ECS::Position const* positions,
+              ECS::Hitpoints const* hitpoints,
+              ECS::AircraftInfo const* infos) {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+              // Wrecks have no bar.
+              if (hitpoints[i].value <= 0)
+                continue;
+
+              int const max_hitpoints =
+                  getData(static_cast<Aircraft::Type>(infos[i].type))
+                      .hit_point;
+              float const ratio = std::clamp(
+                  static_cast<float>(hitpoints[i].value) /
+                      static_cast<float>(max_hitpoints),
+                  0.f,
+                  1.f);
+
+              sf::Vector2f const top_left{
+                  positions[i].x - Bar_Width / 2.f,
+                  positions[i].y + Bar_Offset};
+              appendQuad(
+                  m_vertices,
+                  top_left,
+                  sf::Vector2f{Bar_Width, Bar_Height},
+                  sf::Color{0, 0, 0, 160});
+              appendQuad(
+                  m_vertices,
+                  top_left,
+                  sf::Vector2f{Bar_Width * ratio, Bar_Height},
+                  sf::Color{
+                      static_cast<sf::Uint8>(255.f * (1.f - ratio)),
+                      static_cast<sf::Uint8>(255.f * ratio),
+                      0});
+            }
+          });
+}
+
+void HealthBarNode::onServicesBound(ServiceRegistry& services) noexcept
+{
+  services.provide<HealthBarNode>(*this);
+}
+
+void HealthBarNode::onServicesUnbound(ServiceRegistry& services) noexcept
+{
+  services.revoke<HealthBarNode>(*this);
+}
+
+void HealthBarNode::drawCurrent(
+    sf::RenderTarget& target, sf::RenderStates states) const
+{
+  if (!m_vertices.empty())
+    target.draw(m_vertices.data(), m_vertices.size(), sf::Quads, states);
+}
+
+void HealthBarNode::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  if (!m_vertices.empty())
+    target.draw(m_vertices.data(), m_vertices.size(), sf::Quads, states);
+}
+
+} // namespace FastSimDesign
\ No newline at end of file
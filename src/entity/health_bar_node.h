@@ -0,0 +1,56 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_HEALTH_BAR_NODE_H
+#define FAST_SIM_DESIGN_HEALTH_BAR_NODE_H
+
+#include "../ecs/registry.h"
+#include "../gui/scene_node.h"
+
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+namespace FastSimDesign {
+/// Health bars of all the aircraft, drawn as quads of one vertex array.
+///
+/// Bars are rebuilt from the ECS registry in one pass, only when the
+/// simulation moved since the last build.
+class HealthBarNode final : public SceneNode
+{
+private:
+  using Parent = SceneNode;
+
+public:
+  static constexpr float Bar_Width = 40.f;
+  static constexpr float Bar_Height = 5.f;
+  static constexpr float Bar_Offset = 50.f; // Below the aircraft center.
+
+public:
+  explicit HealthBarNode() = default;
+  virtual ~HealthBarNode() = default;
+
+  void rebuild(ECS::Registry& registry);
+
+private:
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept override;
+  virtual void drawCurrent(
+      sf::RenderTarget& target, sf::RenderStates states) const override;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
+
+private:
+  std::vector<sf::Vertex> m_vertices{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
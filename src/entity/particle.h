@@ -13,13 +13,11 @@
 #ifndef FAST_SIM_DESIGN_PARTICLE_H
 #define FAST_SIM_DESIGN_PARTICLE_H
 
-#include <SFML/Graphics/Color.hpp>
-#include <SFML/System/Time.hpp>
-#include <SFML/System/Vector2.hpp>
-
 #include <cstdint>
 
 namespace FastSimDesign {
+// Particles are stored per system in a ParticleBuffer, only their type is
+// shared with the emitters.
 struct Particle
 {
   enum class Type : uint16_t
@@ -28,10 +26,6 @@ struct Particle
     SMOKE,
     TYPE_COUNT
   };
-
-  sf::Vector2f m_position;
-  sf::Color m_color;
-  sf::Time m_lifetime;
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -0,0 +1,299 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "particle_buffer.h"
+
+#include "particle_kernels.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+namespace FastSimDesign {
+namespace ParticleKernels {
+void decayScalar(float* lifetimes, std::size_t count, float dt) noexcept
+{
+  for (std::size_t i = 0; i < count; ++i)
+    lifetimes[i] -= dt;
+}
+
+void computeAlphasScalar(
+    AlphaRun const& run, std::size_t first, std::size_t last) noexcept
+{
+  float const right = run.view.left + run.view.width;
+  float const bottom = run.view.top + run.view.height;
+  for (std::size_t i = first; i < last; ++i)
+  {
+    float const half_x = run.half_size.x * run.scales[i];
+    float const half_y = run.half_size.y * run.scales[i];
+    bool const is_visible =
+        run.x[i] + half_x > run.view.left && run.x[i] - half_x < right &&
+        run.y[i] + half_y > run.view.top && run.y[i] - half_y < bottom;
+
+    float alpha = std::clamp(run.lifetimes[i] * run.alpha_scale, 0.f, 255.f);
+    run.alphas[i] = is_visible ? static_cast<std::uint8_t>(alpha) : 0;
+  }
+}
+
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+FAST_SIM_DESIGN_TARGET_AVX2 void decayAvx2(
+    float* lifetimes, std::size_t count, float dt) noexcept
+{
+  __m256 const delta = _mm256_set1_ps(dt);
+
+  std::size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256 lifetime = _mm256_loadu_ps(lifetimes + i);
+    _mm256_storeu_ps(lifetimes + i, _mm256_sub_ps(lifetime, delta));
+  }
+  decayScalar(lifetimes + i, count - i, dt);
+}
+
+FAST_SIM_DESIGN_TARGET_AVX2 void computeAlphasAvx2(
+    AlphaRun const& run, std::size_t count) noexcept
+{
+  __m256 const factor = _mm256_set1_ps(run.alpha_scale);
+  __m256 const zero = _mm256_setzero_ps();
+  __m256 const max = _mm256_set1_ps(255.f);
+  __m256 const half_x = _mm256_set1_ps(run.half_size.x);
+  __m256 const half_y = _mm256_set1_ps(run.half_size.y);
+  __m256 const left = _mm256_set1_ps(run.view.left);
+  __m256 const top = _mm256_set1_ps(run.view.top);
+  __m256 const right = _mm256_set1_ps(run.view.left + run.view.width);
+  __m256 const bottom = _mm256_set1_ps(run.view.top + run.view.height);
+
+  // Eight alphas per iteration, narrowed from 32 to 8 bits with saturation.
+  std::size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256 const x = _mm256_loadu_ps(run.x + i);
+    __m256 const y = _mm256_loadu_ps(run.y + i);
+    __m256 const scale = _mm256_loadu_ps(run.scales + i);
+    __m256 const extent_x = _mm256_mul_ps(half_x, scale);
+    __m256 const extent_y = _mm256_mul_ps(half_y, scale);
+    __m256 visible = _mm256_and_ps(
+        _mm256_cmp_ps(_mm256_add_ps(x, extent_x), left, _CMP_GT_OQ),
+        _mm256_cmp_ps(_mm256_sub_ps(x, extent_x), right, _CMP_LT_OQ));
+    visible = _mm256_and_ps(
+        visible,
+        _mm256_cmp_ps(_mm256_add_ps(y, extent_y), top, _CMP_GT_OQ));
+    visible = _mm256_and_ps(
+        visible,
+        _mm256_cmp_ps(_mm256_sub_ps(y, extent_y), bottom, _CMP_LT_OQ));
+
+    __m256 alpha = _mm256_mul_ps(_mm256_loadu_ps(run.lifetimes + i), factor);
+    alpha = _mm256_min_ps(_mm256_max_ps(alpha, zero), max);
+    alpha = _mm256_and_ps(alpha, visible);
+    __m256i integers = _mm256_cvttps_epi32(alpha);
+
+    __m128i words = _mm_packus_epi32(
+        _mm256_castsi256_si128(integers),
+        _mm256_extracti128_si256(integers, 1));
+    __m128i bytes = _mm_packus_epi16(words, words);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(run.alphas + i), bytes);
+  }
+  computeAlphasScalar(run, i, count);
+}
+#endif
+
+void decay(float* lifetimes, std::size_t count, float dt) noexcept
+{
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+  if (Simd::isAvx2Supported())
+  {
+    decayAvx2(lifetimes, count, dt);
+    return;
+  }
+#endif
+  decayScalar(lifetimes, count, dt);
+}
+
+void computeAlphas(AlphaRun const& run, std::size_t count) noexcept
+{
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+  if (Simd::isAvx2Supported())
+  {
+    computeAlphasAvx2(run, count);
+    return;
+  }
+#endif
+  computeAlphasScalar(run, 0, count);
+}
+} // namespace ParticleKernels
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+ParticleBuffer::ParticleBuffer(std::size_t capacity)
+  : m_x(std::bit_ceil(std::max<std::size_t>(capacity, 1)))
+  , m_y(m_x.size())
+  , m_lifetimes(m_x.size())
+  , m_scales(m_x.size())
+  , m_alphas(m_x.size())
+  , m_mask{m_x.size() - 1}
+{
+}
+
+void ParticleBuffer::push(
+    sf::Vector2f position, float lifetime, float scale) noexcept
+{
+  // Full: the new particle replaces the oldest one.
+  if (m_size == getCapacity())
+  {
+    m_head = (m_head + 1) & m_mask;
+    --m_size;
+  }
+
+  std::size_t const index = (m_head + m_size) & m_mask;
+  m_x[index] = position.x;
+  m_y[index] = position.y;
+  m_lifetimes[index] = lifetime;
+  m_scales[index] = scale;
+  ++m_size;
+}
+
+void ParticleBuffer::update(float dt) noexcept
+{
+  decay(dt, 0, m_size);
+  removeExpired();
+}
+
+void ParticleBuffer::decay(
+    float dt, std::size_t first, std::size_t count) noexcept
+{
+  float* lifetimes = m_lifetimes.data();
+  forEachSegment(first, count, [&](std::size_t slot, std::size_t size) {
+    ParticleKernels::decay(lifetimes + slot, size, dt);
+  });
+}
+
+std::size_t ParticleBuffer::removeExpired() noexcept
+{
+  // Expired particles are the oldest ones.
+  std::size_t removed = 0;
+  while (m_size > 0 && m_lifetimes[m_head] <= 0.f)
+  {
+    m_head = (m_head + 1) & m_mask;
+    --m_size;
+    ++removed;
+  }
+  return removed;
+}
+
+std::size_t ParticleBuffer::writeVertices(
+    std::span<sf::Vertex> vertices,
+    sf::Vector2f half_size,
+    float max_lifetime,
+    sf::FloatRect const& view,
+    std::size_t first,
+    std::size_t count) const noexcept
+{
+  assert(vertices.size() >= (first + count) * 4);
+  float const alpha_scale = max_lifetime > 0.f ? 255.f / max_lifetime : 0.f;
+
+  sf::Vertex* const begin = vertices.data() + first * 4;
+  sf::Vertex* vertex = begin;
+  forEachSegment(first, count, [&](std::size_t slot, std::size_t size) {
+    ParticleKernels::AlphaRun const run{
+        m_x.data() + slot,
+        m_y.data() + slot,
+        m_scales.data() + slot,
+        m_lifetimes.data() + slot,
+        m_alphas.data() + slot,
+        alpha_scale,
+        half_size,
+        view};
+    ParticleKernels::computeAlphas(run, size);
+
+    // Null alphas are culled or expired particles, their quads are skipped.
+    for (std::size_t i = slot; i < slot + size; ++i)
+    {
+      std::uint8_t const alpha = m_alphas[i];
+      if (alpha == 0)
+        continue;
+
+      float const half_x = half_size.x * m_scales[i];
+      float const half_y = half_size.y * m_scales[i];
+      float const left = m_x[i] - half_x;
+      float const right = m_x[i] + half_x;
+      float const top = m_y[i] - half_y;
+      float const bottom = m_y[i] + half_y;
+
+      vertex[0].position = sf::Vector2f{left, top};
+      vertex[1].position = sf::Vector2f{right, top};
+      vertex[2].position = sf::Vector2f{right, bottom};
+      vertex[3].position = sf::Vector2f{left, bottom};
+      vertex[0].color.a = alpha;
+      vertex[1].color.a = alpha;
+      vertex[2].color.a = alpha;
+      vertex[3].color.a = alpha;
+      vertex += 4;
+    }
+  });
+  return static_cast<std::size_t>(vertex - begin);
+}
+
+void ParticleBuffer::prepareVertices(
+    std::span<sf::Vertex> vertices,
+    sf::FloatRect const& texture_rect,
+    sf::Color color) const noexcept
+{
+  float const left = texture_rect.left;
+  float const top = texture_rect.top;
+  float const right = texture_rect.left + texture_rect.width;
+  float const bottom = texture_rect.top + texture_rect.height;
+  for (std::size_t i = 0; i + 4 <= vertices.size(); i += 4)
+  {
+    vertices[i + 0].texCoords = sf::Vector2f{left, top};
+    vertices[i + 1].texCoords = sf::Vector2f{right, top};
+    vertices[i + 2].texCoords = sf::Vector2f{right, bottom};
+    vertices[i + 3].texCoords = sf::Vector2f{left, bottom};
+    for (std::size_t corner = 0; corner < 4; ++corner)
+      vertices[i + corner].color = color;
+  }
+}
+
+std::size_t ParticleBuffer::getSize() const noexcept
+{
+  return m_size;
+}
+
+std::size_t ParticleBuffer::getCapacity() const noexcept
+{
+  return m_mask + 1;
+}
+
+bool ParticleBuffer::isEmpty() const noexcept
+{
+  return m_size == 0;
+}
+
+void ParticleBuffer::clear() noexcept
+{
+  m_head = 0;
+  m_size = 0;
+}
+
+template<typename Function>
+void ParticleBuffer::forEachSegment(
+    std::size_t first, std::size_t count, Function&& function) const
+{
+  assert(first + count <= m_size);
+
+  // A range wraps around the end of the arrays at most once.
+  std::size_t const slot = (m_head + first) & m_mask;
+  std::size_t const first_size = std::min(count, getCapacity() - slot);
+  if (first_size > 0)
+    function(slot, first_size);
+  if (count > first_size)
+    function(std::size_t{0}, count - first_size);
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,94 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_PARTICLE_BUFFER_H
+#define FAST_SIM_DESIGN_PARTICLE_BUFFER_H
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace FastSimDesign {
+/// Fixed-capacity ring buffer of particles stored as structure of arrays.
+///
+/// Particles of a buffer share their lifetime, so they expire in emission
+/// order: the oldest ones are dropped from the front and, once the buffer is
+/// full, a new particle overwrites the oldest one.
+///
+/// Ranges are given in emission order, from the oldest particle. Disjoint
+/// ranges touch disjoint data and can be processed by different threads.
+class ParticleBuffer final
+{
+public:
+  // Capacity is rounded up to a power of two.
+  explicit ParticleBuffer(std::size_t capacity);
+  ParticleBuffer(ParticleBuffer const&) = default;
+  ParticleBuffer(ParticleBuffer&&) = default;
+  ParticleBuffer& operator=(ParticleBuffer const&) = default;
+  ParticleBuffer& operator=(ParticleBuffer&&) = default;
+  virtual ~ParticleBuffer() = default;
+
+  // `scale` multiplies the quad size of the particle.
+  void push(sf::Vector2f position, float lifetime, float scale = 1.f) noexcept;
+
+  // Decay lifetimes by `dt` seconds and drop expired particles.
+  void update(float dt) noexcept;
+  void decay(float dt, std::size_t first, std::size_t count) noexcept;
+  // Drop expired particles and return how many were dropped.
+  std::size_t removeExpired() noexcept;
+
+  // Write the quads of the particles in [first, first + count) that overlap
+  // `view`, packed from vertex `4 * first`, and return the number of vertices
+  // written. Only positions and alphas are written: texture coordinates and
+  // the rgb of `color` are set once with prepareVertices().
+  std::size_t writeVertices(
+      std::span<sf::Vertex> vertices,
+      sf::Vector2f half_size,
+      float max_lifetime,
+      sf::FloatRect const& view,
+      std::size_t first,
+      std::size_t count) const noexcept;
+  void prepareVertices(
+      std::span<sf::Vertex> vertices,
+      sf::FloatRect const& texture_rect,
+      sf::Color color) const noexcept;
+
+  std::size_t getSize() const noexcept;
+  std::size_t getCapacity() const noexcept;
+  bool isEmpty() const noexcept;
+  void clear() noexcept;
+
+private:
+  // Call `function(slot, size)` for each run of contiguous slots holding the
+  // particles in [first, first + count).
+  template<typename Function>
+  void forEachSegment(
+      std::size_t first, std::size_t count, Function&& function) const;
+
+private:
+  std::vector<float> m_x{};
+  std::vector<float> m_y{};
+  std::vector<float> m_lifetimes{};
+  std::vector<float> m_scales{};
+  mutable std::vector<std::uint8_t> m_alphas{};
+  std::size_t m_mask{0};
+  std::size_t m_head{0}; // Oldest particle.
+  std::size_t m_size{0};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
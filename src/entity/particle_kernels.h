@@ -0,0 +1,61 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_PARTICLE_KERNELS_H
+#define FAST_SIM_DESIGN_PARTICLE_KERNELS_H
+
+#include "../utils/simd_util.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace FastSimDesign {
+/// Loops of the particle buffer over its columns. Each has a scalar path and
+/// an AVX2 one chosen at runtime, both exposed so that they can be checked
+/// against each other.
+namespace ParticleKernels {
+// Particles of a run whose alphas are computed together.
+struct AlphaRun
+{
+  float const* x;
+  float const* y;
+  float const* scales;
+  float const* lifetimes;
+  std::uint8_t* alphas;
+  float alpha_scale; // Alpha of one second of remaining lifetime.
+  sf::Vector2f half_size;
+  sf::FloatRect view;
+};
+
+// Subtract `dt` from `count` lifetimes.
+void decay(float* lifetimes, std::size_t count, float dt) noexcept;
+void decayScalar(float* lifetimes, std::size_t count, float dt) noexcept;
+
+// Alpha is the remaining fraction of the lifetime, clamped to [0, 255], and
+// zero when the quad of the particle is outside the view.
+void computeAlphas(AlphaRun const& run, std::size_t count) noexcept;
+// Alphas of the particles in [first, last).
+void computeAlphasScalar(
+    AlphaRun const& run, std::size_t first, std::size_t last) noexcept;
+
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+FAST_SIM_DESIGN_TARGET_AVX2 void decayAvx2(
+    float* lifetimes, std::size_t count, float dt) noexcept;
+FAST_SIM_DESIGN_TARGET_AVX2 void computeAlphasAvx2(
+    AlphaRun const& run, std::size_t count) noexcept;
+#endif
+} // namespace ParticleKernels
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
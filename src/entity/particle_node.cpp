@@ -10,22 +10,19 @@
 
 #include "particle_node.h"
 
-#include "entity_data.h"
+#include "../core/service_registry.h"
+#include "entity_catalog.h"
 
-#include <SFML/Config.hpp>
-#include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Time.hpp>
 #include <SFML/System/Vector2.hpp>
 
 #include <algorithm>
-#include <unordered_map>
+#include <cassert>
+#include <cmath>
+#include <span>
 
 namespace FastSimDesign {
-namespace {
-std::unordered_map<Particle::Type, ParticleData> Data_table =
-    initializeParticleData();
-}
 ////////////////////////////////////////////////////////////
 /// Statics
 ////////////////////////////////////////////////////////////
@@ -34,100 +31,251 @@ std::unordered_map<Particle::Type, ParticleData> Data_table =
 /// Methods
 ////////////////////////////////////////////////////////////
 
-ParticleNode::ParticleNode(
-    Particle::Type type, TextureHolder const& textures) noexcept
+ParticleNode::ParticleNode(Particle::Type type)
   : Parent{}
-  , m_texture{textures.get(Textures::ID::PARTICLE)}
+  , m_particules{getData(type).budget}
   , m_type{type}
 {
 }
 
-void ParticleNode::addParticule(sf::Vector2f position) noexcept
+ParticleNode::~ParticleNode()
 {
-  Particle particule;
-  particule.m_position = position;
-  particule.m_color = Data_table[m_type].m_color;
-  particule.m_lifetime = Data_table[m_type].m_lifetime;
+  if (m_is_updating)
+    m_workers->wait(m_tasks);
+}
 
-  m_particules.push_back(std::move(particule));
+void ParticleNode::addParticule(sf::Vector2f position, float scale) noexcept
+{
+  if (m_is_updating)
+  {
+    m_emitted.push_back(EmittedParticle{position, scale});
+    return;
+  }
+  m_particules.push(position, getData(m_type).lifetime, scale);
+  m_needs_vertex_update = true;
 }
 
-Particle::Type ParticleNode::getParticuleType() const noexcept
+void ParticleNode::finishUpdate()
 {
-  return m_type;
+  if (!m_is_updating)
+    return;
+  m_workers->wait(m_tasks);
+  m_is_updating = false;
+
+  // Quads were written from the oldest particle, the expired ones were
+  // skipped.
+  std::size_t const expired_count = m_particules.removeExpired();
+  std::size_t const first_emitted = m_particules.getSize();
+  bool const emitted_fit = expired_count + first_emitted + m_emitted.size() <=
+                           m_particules.getCapacity();
+
+  float const lifetime = getData(m_type).lifetime;
+  for (EmittedParticle const& particle : m_emitted)
+    m_particules.push(particle.position, lifetime, particle.scale);
+
+  // Write the quads of the emitted particles after the others, unless the
+  // buffer overflowed and the whole array has to be rewritten.
+  if (emitted_fit && isWritingVertices())
+  {
+    std::size_t const count = m_particules.writeVertices(
+        m_vertices.subspan(expired_count * 4),
+        m_half_size,
+        lifetime,
+        m_view_bounds,
+        first_emitted,
+        m_emitted.size());
+    m_vertex_ranges.push_back(
+        VertexRange{(expired_count + first_emitted) * 4, count});
+    m_needs_vertex_update = false;
+  }
+  else
+    m_needs_vertex_update = true;
+  m_emitted.clear();
 }
 
-BitFlags<Category::Type> ParticleNode::getCategory() const noexcept
+ParticleNode::Emission ParticleNode::getEmission(
+    sf::Vector2f position) const noexcept
 {
-  return BitFlags<Category::Type>{Category::Type::PARTICLE_SYSTEM};
+  // Throttle emission as the live particles approach the budget.
+  float const budget =
+      static_cast<float>(std::max(getData(m_type).budget, 1u));
+  float const load =
+      static_cast<float>(m_particules.getSize() + m_emitted.size()) / budget;
+  float const budget_factor =
+      std::clamp((1.f - load) / (1.f - Budget_Soft_Limit), 0.f, 1.f);
+
+  // Level of detail from the distance between the emitter and the view.
+  float const right = m_view_bounds.left + m_view_bounds.width;
+  float const bottom = m_view_bounds.top + m_view_bounds.height;
+  float const distance = std::hypot(
+      std::max({m_view_bounds.left - position.x, position.x - right, 0.f}),
+      std::max({m_view_bounds.top - position.y, position.y - bottom, 0.f}));
+  int const level =
+      distance > 0.f ? 1 + static_cast<int>(distance / Lod_Distance) : 0;
+  if (level > Max_Lod_Level)
+    return Emission{0.f, 1.f};
+
+  // Fewer but larger particles keep the covered area.
+  float const rate = std::ldexp(budget_factor, -level);
+  return Emission{rate, std::sqrt(std::ldexp(1.f, level))};
 }
 
-void ParticleNode::updateCurrent(sf::Time const& dt, CommandQueue&)
+void ParticleNode::setViewBounds(sf::FloatRect const& bounds) noexcept
 {
-  // Remove expired particles at beginning.
-  while (!m_particules.empty() &&
-         m_particules.front().m_lifetime <= sf::Time::Zero)
-    m_particules.pop_front();
+  m_view_bounds = bounds;
+}
 
-  // Decrease lifetime of existing particles.
-  for (Particle& particle : m_particules)
-    particle.m_lifetime -= dt;
+void ParticleNode::setDrawn(bool is_drawn) noexcept
+{
+  if (is_drawn && !m_is_drawn)
+    m_needs_vertex_update = true;
+  m_is_drawn = is_drawn;
+}
 
+void ParticleNode::setVertexSlice(std::span<sf::Vertex> vertices) noexcept
+{
+  assert(!m_is_updating && "Vertices moved during the particles update.");
+  assert(vertices.empty() || vertices.size() == getVertexCapacity());
+  m_vertices = vertices;
+  m_vertex_ranges.clear();
   m_needs_vertex_update = true;
+
+  // Texture coordinates and color never change, only positions and alphas
+  // are written each frame.
+  if (m_renderer && !m_vertices.empty())
+    m_particules.prepareVertices(
+        m_vertices,
+        m_renderer->getTextureRect(m_type),
+        getData(m_type).getColor());
 }
 
-void ParticleNode::drawCurrent(
-    sf::RenderTarget& target, sf::RenderStates states) const
+std::span<ParticleNode::VertexRange const>
+ParticleNode::getVertexRanges() const noexcept
 {
+  assert(!m_is_updating && "Particles drawn during their update.");
   if (m_needs_vertex_update)
   {
     computeVertices();
     m_needs_vertex_update = false;
   }
+  return m_vertex_ranges;
+}
 
-  // Apply particle texture.
-  states.texture = &m_texture;
+std::size_t ParticleNode::getVertexCapacity() const noexcept
+{
+  return m_particules.getCapacity() * 4;
+}
+
+Particle::Type ParticleNode::getParticuleType() const noexcept
+{
+  return m_type;
+}
 
-  // Draw vertices.
-  target.draw(m_vertices, states);
+std::size_t ParticleNode::getParticleCount() const noexcept
+{
+  return m_particules.getSize();
 }
 
-void ParticleNode::computeVertices() const noexcept
+void ParticleNode::onServicesBound(ServiceRegistry& services) noexcept
 {
-  sf::Vector2f const size{m_texture.getSize()};
-  sf::Vector2f const half = size / 2.f;
+  services.provide<ParticleNode>(*this, m_type);
+  m_workers = services.find<WorkerPool>();
 
-  // Refill vertex array.
-  m_vertices.clear();
-  for (auto const& particle : m_particules)
+  // The renderer gives the slice of its vertex buffer on attachment.
+  m_renderer = services.find<ParticleRenderer>();
+  if (m_renderer)
   {
-    sf::Vector2f const& pos = particle.m_position;
-    sf::Color color = particle.m_color;
+    sf::FloatRect const texture_rect = m_renderer->getTextureRect(m_type);
+    m_half_size = sf::Vector2f{texture_rect.width, texture_rect.height} / 2.f;
+    m_renderer->attachSystem(*this);
+  }
+}
 
-    float ratio = particle.m_lifetime.asSeconds() /
-                  Data_table[m_type].m_lifetime.asSeconds();
-    color.a = static_cast<sf::Uint8>(255 * std::max(ratio, 0.f));
+void ParticleNode::onServicesUnbound(ServiceRegistry& services) noexcept
+{
+  finishUpdate();
+  services.revoke<ParticleNode>(*this, m_type);
+  if (m_renderer)
+    m_renderer->detachSystem(*this);
+  m_renderer = nullptr;
+  m_vertices = {};
+  m_workers = nullptr;
+}
+
+BitFlags<Category::Type> ParticleNode::getCategory() const noexcept
+{
+  return BitFlags<Category::Type>{Category::Type::PARTICLE_SYSTEM};
+}
+
+void ParticleNode::updateCurrent(sf::Time const& dt, CommandQueue&)
+{
+  // Several update steps may run before a draw.
+  finishUpdate();
 
-    addVertex(pos.x - half.x, pos.y - half.y, 0.f, 0.f, color);
-    addVertex(pos.x + half.x, pos.y - half.y, size.x, 0.f, color);
-    addVertex(pos.x + half.x, pos.y + half.y, size.x, size.y, color);
-    addVertex(pos.x - half.x, pos.y + half.y, 0.f, size.y, color);
+  if (m_workers)
+  {
+    startUpdate(dt.asSeconds());
+    return;
   }
+
+  // Decrease lifetime of existing particles, remove expired ones.
+  m_particules.update(dt.asSeconds());
+  m_needs_vertex_update = true;
 }
 
-void ParticleNode::addVertex(
-    float world_x,
-    float world_y,
-    float tex_coord_x,
-    float tex_coord_y,
-    sf::Color const& color) const noexcept
+void ParticleNode::startUpdate(float dt)
 {
-  sf::Vertex vertex;
-  vertex.position = sf::Vector2f{world_x, world_y};
-  vertex.texCoords = sf::Vector2f{tex_coord_x, tex_coord_y};
-  vertex.color = color;
+  m_is_updating = true;
 
-  m_vertices.append(vertex);
+  std::size_t const count = m_particules.getSize();
+  std::size_t const range_size =
+      m_workers->getRangeSize(count, Min_Task_Size);
+  m_vertex_ranges.clear();
+  for (std::size_t first = 0; first < count; first += range_size)
+    m_vertex_ranges.push_back(VertexRange{first * 4, 0});
+
+  // Each task decays its own range of particles and writes their quads in
+  // its own range of vertices, there is nothing to merge.
+  sf::Vector2f const half = m_half_size;
+  float const lifetime = getData(m_type).lifetime;
+  sf::FloatRect const view = m_view_bounds;
+  bool const is_drawn = isWritingVertices();
+  m_workers->submitRanges(
+      m_tasks,
+      count,
+      range_size,
+      [this, dt, half, lifetime, view, range_size, is_drawn](
+          std::size_t first, std::size_t size) {
+        m_particules.decay(dt, first, size);
+        if (!is_drawn)
+          return;
+        m_vertex_ranges[first / range_size].count =
+            m_particules.writeVertices(
+                m_vertices, half, lifetime, view, first, size);
+      });
+}
+
+void ParticleNode::computeVertices() const noexcept
+{
+  if (m_vertices.empty())
+  {
+    m_vertex_ranges.clear();
+    return;
+  }
+
+  std::size_t const count = m_particules.writeVertices(
+      m_vertices,
+      m_half_size,
+      getData(m_type).lifetime,
+      m_view_bounds,
+      0,
+      m_particules.getSize());
+  m_vertex_ranges.assign(1, VertexRange{0, count});
+}
+
+bool ParticleNode::isWritingVertices() const noexcept
+{
+  return m_is_drawn && !m_vertices.empty();
 }
 
 } // namespace FastSimDesign
\ No newline at end of file
@@ -13,51 +13,116 @@
 #ifndef FAST_SIM_DESIGN_PARTICLE_NODE_H
 #define FAST_SIM_DESIGN_PARTICLE_NODE_H
 
-#include "../core/resource_identifiers.h"
+#include "../core/worker_pool.h"
 #include "../gui/scene_node.h"
 #include "particle.h"
+#include "particle_buffer.h"
+#include "particle_renderer.h"
 
-#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp>
 
-#include <deque>
+#include <cstddef>
+#include <span>
+#include <vector>
 
 namespace FastSimDesign {
+/// Particle system of one particle type. Its quads are drawn by the particle
+/// renderer found in the services.
 class ParticleNode final : public SceneNode
 {
 private:
   using Parent = SceneNode;
 
 public:
-  explicit ParticleNode(
-      Particle::Type type, TextureHolder const& textures) noexcept;
-  virtual ~ParticleNode() = default;
+  // Smallest number of particles worth a task of the worker pool.
+  static constexpr std::size_t Min_Task_Size = 4096;
+  // Share of the budget from which emission is throttled, down to nothing
+  // when the budget is reached.
+  static constexpr float Budget_Soft_Limit = 0.75f;
+  // Distance from the view covered by each level of detail. Every level
+  // halves the emission rate and doubles the quad area, emitters beyond the
+  // last level do not emit.
+  static constexpr float Lod_Distance = 128.f;
+  static constexpr int Max_Lod_Level = 3;
 
-  void addParticule(sf::Vector2f position) noexcept;
+  struct Emission
+  {
+    float rate{1.f}; // Multiplies the emission rate of the type.
+    float scale{1.f}; // Multiplies the quad size.
+  };
+
+  // Vertices of visible quads, from the start of the slice of the system.
+  struct VertexRange
+  {
+    std::size_t first{0};
+    std::size_t count{0};
+  };
+
+public:
+  explicit ParticleNode(Particle::Type type);
+  virtual ~ParticleNode();
+
+  void addParticule(sf::Vector2f position, float scale = 1.f) noexcept;
+  // Wait for the particles update started by the last update step, must be
+  // called before drawing.
+  void finishUpdate();
+  Emission getEmission(sf::Vector2f position) const noexcept;
+  void setViewBounds(sf::FloatRect const& bounds) noexcept;
+  // A system not drawn, e.g. too small on screen, writes no quads until it
+  // is drawn again.
+  void setDrawn(bool is_drawn) noexcept;
+  // Slice of the vertex buffer of the renderer where the quads are written,
+  // of getVertexCapacity() vertices. Empty when the system is not drawn by a
+  // renderer.
+  void setVertexSlice(std::span<sf::Vertex> vertices) noexcept;
+  // Ranges of the slice holding the quads to draw, brought up to date.
+  std::span<VertexRange const> getVertexRanges() const noexcept;
+  std::size_t getVertexCapacity() const noexcept;
   Particle::Type getParticuleType() const noexcept;
+  std::size_t getParticleCount() const noexcept;
   virtual BitFlags<Category::Type> getCategory() const noexcept override;
 
 private:
+  struct EmittedParticle
+  {
+    sf::Vector2f position;
+    float scale;
+  };
+
+private:
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept override;
   virtual void updateCurrent(
       sf::Time const& dt, CommandQueue& commands) override;
-  virtual void drawCurrent(
-      sf::RenderTarget& target, sf::RenderStates states) const override;
 
+  void startUpdate(float dt);
   void computeVertices() const noexcept;
-  void addVertex(
-      float world_x,
-      float world_y,
-      float tex_coord_x,
-      float tex_coord_y,
-      sf::Color const& color) const noexcept;
+  bool isWritingVertices() const noexcept;
 
 private:
-  std::deque<Particle> m_particules{};
-  sf::Texture const& m_texture;
+  ParticleBuffer m_particules;
   Particle::Type m_type{};
+  ParticleRenderer* m_renderer{nullptr};
+  sf::Vector2f m_half_size{}; // Of the quads, from the sprite in the atlas.
+  sf::FloatRect m_view_bounds{}; // Set by the world every update step.
+
+  // Decay and vertex fill run on the worker pool in disjoint ranges of
+  // particles, while the rest of the world updates. Particles emitted in the
+  // meantime are queued and appended when the update finishes.
+  WorkerPool* m_workers{nullptr};
+  TaskGroup m_tasks{};
+  bool m_is_updating{false};
+  std::vector<EmittedParticle> m_emitted{};
 
-  mutable sf::VertexArray m_vertices{sf::Quads};
+  // One quad per slot of the buffer, in the slice given by the renderer.
+  // Each range of particles packs the quads of its visible particles at the
+  // start of its own range of vertices.
+  std::span<sf::Vertex> m_vertices{};
+  mutable std::vector<VertexRange> m_vertex_ranges{};
   mutable bool m_needs_vertex_update{true};
+  bool m_is_drawn{true};
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -0,0 +1,270 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "particle_renderer.h"
+
+#include "../core/resource_exception.h"
+#include "../core/service_registry.h"
+#include "../core/texture_holder.h"
+#include "../gui/software_render_target.h"
+#include "entity_catalog.h"
+#include "particle_node.h"
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <utility>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+ParticleRenderer::ParticleRenderer(TextureHolder const& textures)
+  : Parent{}
+{
+  buildAtlas(textures);
+}
+
+ParticleRenderer::~ParticleRenderer()
+{
+  // Systems still attached must not write into the freed buffer.
+  for (ParticleNode* system : m_systems)
+  {
+    system->finishUpdate();
+    system->setVertexSlice({});
+  }
+}
+
+void ParticleRenderer::attachSystem(ParticleNode& system)
+{
+  assert(
+      std::find(m_systems.begin(), m_systems.end(), &system) ==
+          m_systems.end() &&
+      "Particle system already attached.");
+
+  // Keep systems grouped by blend mode, in attachment order.
+  auto blend_of = [](ParticleNode const* node) {
+    return getData(node->getParticuleType()).blend;
+  };
+  auto position = std::upper_bound(
+      m_systems.begin(),
+      m_systems.end(),
+      &system,
+      [&](ParticleNode const* left, ParticleNode const* right) {
+        return blend_of(left) < blend_of(right);
+      });
+  m_systems.insert(position, &system);
+  assignSlices();
+}
+
+void ParticleRenderer::detachSystem(ParticleNode const& system) noexcept
+{
+  std::erase(m_systems, &system);
+  assignSlices();
+}
+
+sf::FloatRect ParticleRenderer::getTextureRect(
+    Particle::Type type) const noexcept
+{
+  assert(toUnderlyingType(type) < m_texture_rects.size());
+  return m_texture_rects[toUnderlyingType(type)];
+}
+
+sf::Texture const& ParticleRenderer::getAtlas() const noexcept
+{
+  return m_atlas;
+}
+
+void ParticleRenderer::prepareDraw(float pixel_scale)
+{
+  m_packed_vertices.clear();
+  m_batches.clear();
+  for (std::size_t i = 0; i < m_systems.size(); ++i)
+  {
+    ParticleData const& data = getData(m_systems[i]->getParticuleType());
+    if (m_batches.empty() || m_batches.back().blend_mode != data.getBlendMode())
+      m_batches.push_back(
+          Batch{data.getBlendMode(), m_packed_vertices.size(), 0});
+
+    // Particles in the view have the size of their sprite. Systems not drawn
+    // skip writing their quads on the next updates.
+    sf::FloatRect const rect =
+        getTextureRect(m_systems[i]->getParticuleType());
+    bool const is_drawn =
+        std::max(rect.width, rect.height) * pixel_scale >= Min_Pixel_Size;
+    m_systems[i]->setDrawn(is_drawn);
+    if (!is_drawn)
+      continue;
+
+    for (ParticleNode::VertexRange const& range :
+         m_systems[i]->getVertexRanges())
+    {
+      auto const first = m_vertices.begin() +
+                         static_cast<std::ptrdiff_t>(
+                             m_slice_offsets[i] + range.first);
+      m_packed_vertices.insert(
+          m_packed_vertices.end(),
+          first,
+          first + static_cast<std::ptrdiff_t>(range.count));
+      m_batches.back().count += range.count;
+    }
+  }
+  std::erase_if(m_batches, [](Batch const& batch) {
+    return batch.count == 0;
+  });
+}
+
+void ParticleRenderer::onServicesBound(ServiceRegistry& services) noexcept
+{
+  services.provide<ParticleRenderer>(*this);
+}
+
+void ParticleRenderer::onServicesUnbound(ServiceRegistry& services) noexcept
+{
+  services.revoke<ParticleRenderer>(*this);
+}
+
+void ParticleRenderer::drawCurrent(
+    sf::RenderTarget& target, sf::RenderStates states) const
+{
+  states.texture = &m_atlas;
+  for (Batch const& batch : m_batches)
+  {
+    states.blendMode = batch.blend_mode;
+    target.draw(
+        m_packed_vertices.data() + batch.first, batch.count, sf::Quads, states);
+  }
+}
+
+void ParticleRenderer::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  for (Batch const& batch : m_batches)
+  {
+    states.blendMode = batch.blend_mode;
+    target.draw(
+        m_packed_vertices.data() + batch.first,
+        batch.count,
+        sf::Quads,
+        states,
+        &m_atlas_image);
+  }
+}
+
+void ParticleRenderer::assignSlices()
+{
+  // Moving the buffer moves the quads being written by the systems.
+  for (ParticleNode* system : m_systems)
+    system->finishUpdate();
+
+  std::size_t capacity = 0;
+  m_slice_offsets.clear();
+  for (ParticleNode const* system : m_systems)
+  {
+    m_slice_offsets.push_back(capacity);
+    capacity += system->getVertexCapacity();
+  }
+  m_vertices.resize(capacity);
+
+  for (std::size_t i = 0; i < m_systems.size(); ++i)
+  {
+    m_systems[i]->setVertexSlice(
+        std::span<sf::Vertex>{m_vertices}.subspan(
+            m_slice_offsets[i], m_systems[i]->getVertexCapacity()));
+  }
+}
+
+void ParticleRenderer::buildAtlas(TextureHolder const& textures)
+{
+  std::span<ParticleData const> particles =
+      EntityCatalog::getCurrent().getParticles();
+
+  // Types sharing a sprite share its place in the atlas.
+  using Sprite = std::pair<Textures::ID, sf::IntRect>;
+  std::vector<Sprite> sprites{};
+  std::vector<std::size_t> sprite_indices{};
+  for (ParticleData const& data : particles)
+  {
+    sf::IntRect rect = data.texture_rect.toIntRect();
+    if (rect.width <= 0 || rect.height <= 0)
+    {
+      sf::Vector2u const size = textures.getImage(data.texture).getSize();
+      rect = sf::IntRect{
+          0, 0, static_cast<int>(size.x), static_cast<int>(size.y)};
+    }
+
+    Sprite const sprite{data.texture, rect};
+    auto found = std::find(sprites.begin(), sprites.end(), sprite);
+    sprite_indices.push_back(
+        static_cast<std::size_t>(found - sprites.begin()));
+    if (found == sprites.end())
+      sprites.push_back(sprite);
+  }
+
+  // Pack sprites on shelves, left to right then top to bottom.
+  unsigned atlas_width = Atlas_Width;
+  for (Sprite const& sprite : sprites)
+    atlas_width = std::max(
+        atlas_width,
+        static_cast<unsigned>(sprite.second.width) + 2 * Atlas_Padding);
+
+  std::vector<sf::Vector2u> positions{};
+  unsigned x = 0;
+  unsigned y = 0;
+  unsigned shelf_height = 0;
+  for (Sprite const& sprite : sprites)
+  {
+    unsigned const width = sprite.second.width + 2 * Atlas_Padding;
+    unsigned const height = sprite.second.height + 2 * Atlas_Padding;
+    if (x + width > atlas_width)
+    {
+      x = 0;
+      y += shelf_height;
+      shelf_height = 0;
+    }
+    positions.push_back(sf::Vector2u{x + Atlas_Padding, y + Atlas_Padding});
+    x += width;
+    shelf_height = std::max(shelf_height, height);
+  }
+
+  sf::Image atlas{};
+  atlas.create(
+      atlas_width, std::max(y + shelf_height, 1u), sf::Color::Transparent);
+  for (std::size_t i = 0; i < sprites.size(); ++i)
+  {
+    auto [texture, rect] = sprites[i];
+    atlas.copy(
+        textures.getImage(texture), positions[i].x, positions[i].y, rect);
+  }
+
+  if (!textures.isHeadless() && !m_atlas.loadFromImage(atlas))
+    throw ResourceException{"Failed to create the particle atlas"};
+  m_atlas_image = std::move(atlas);
+
+  m_texture_rects.clear();
+  for (std::size_t sprite_index : sprite_indices)
+  {
+    m_texture_rects.push_back(sf::FloatRect{
+        static_cast<float>(positions[sprite_index].x),
+        static_cast<float>(positions[sprite_index].y),
+        static_cast<float>(sprites[sprite_index].second.width),
+        static_cast<float>(sprites[sprite_index].second.height)});
+  }
+}
+
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_PARTICLE_RENDERER_H
+#define FAST_SIM_DESIGN_PARTICLE_RENDERER_H
+
+#include "../core/resource_identifiers.h"
+#include "../gui/scene_node.h"
+#include "particle.h"
+
+#include <SFML/Graphics/BlendMode.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+namespace FastSimDesign {
+class ParticleNode;
+/// Draws the particles of every particle system with one draw call per blend
+/// mode, whatever the number of particle types.
+///
+/// The sprites of all particle types are packed into one texture atlas.
+/// Particle systems attached to the renderer no longer draw themselves, they
+/// write their quads in place into their own slice of one vertex buffer,
+/// ordered by blend mode. Before drawing, the quads written are packed into
+/// one vertex array per blend mode, each drawn with a single call.
+class ParticleRenderer final : public SceneNode
+{
+private:
+  using Parent = SceneNode;
+
+public:
+  static constexpr unsigned Atlas_Width = 512;
+  static constexpr unsigned Atlas_Padding = 1;
+  // Particle types whose quads are smaller on screen are not drawn.
+  static constexpr float Min_Pixel_Size = 4.f;
+
+public:
+  explicit ParticleRenderer(TextureHolder const& textures);
+  virtual ~ParticleRenderer();
+
+  void attachSystem(ParticleNode& system);
+  void detachSystem(ParticleNode const& system) noexcept;
+  sf::FloatRect getTextureRect(Particle::Type type) const noexcept;
+  sf::Texture const& getAtlas() const noexcept;
+  // Pack the quads of the systems big enough on screen, once they are
+  // updated and before the renderer is drawn.
+  void prepareDraw(float pixel_scale);
+
+private:
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept override;
+  virtual void drawCurrent(
+      sf::RenderTarget& target, sf::RenderStates states) const override;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
+  void buildAtlas(TextureHolder const& textures);
+  // Give each system its slice of the vertex buffer, after the ones before
+  // it.
+  void assignSlices();
+
+private:
+  struct Batch
+  {
+    sf::BlendMode blend_mode{};
+    std::size_t first{0}; // In the packed vertices.
+    std::size_t count{0};
+  };
+
+private:
+  sf::Texture m_atlas{}; // Not created when headless.
+  sf::Image m_atlas_image{};
+  std::vector<sf::FloatRect> m_texture_rects{}; // Per catalog particle type.
+  std::vector<ParticleNode*> m_systems{}; // Ordered by blend mode.
+  std::vector<std::size_t> m_slice_offsets{}; // Per system.
+  std::vector<sf::Vertex> m_vertices{};
+  std::vector<sf::Vertex> m_packed_vertices{};
+  std::vector<Batch> m_batches{}; // One per blend mode with quads to draw.
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
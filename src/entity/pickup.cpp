@@ -10,32 +10,38 @@
 
 #include "pickup.h"
 
+#include "../core/texture_holder.h"
+#include "../gui/software_render_target.h"
+#include "../utils/generic_utility.h"
 #include "../utils/sfml_util.h"
 #include "category.h"
-#include "entity_data.h"
+#include "entity_catalog.h"
 
 #include <SFML/Graphics/RenderTarget.hpp>
 
-#include <unordered_map>
-
 namespace FastSimDesign {
-namespace {
-std::unordered_map<Pickup::Type, PickupData> Data_Table =
-    initializePickupData();
-}
-
 ////////////////////////////////////////////////////////////
 /// Methods
 ////////////////////////////////////////////////////////////
 Pickup::Pickup(Pickup::Type type, TextureHolder const& textures) noexcept
   : Parent{1}
   , m_type{type}
+  , m_textures{textures}
   , m_sprite{
-        textures.get(Data_Table[type].texture), Data_Table[type].m_texture_rect}
+        textures.get(getData(type).texture),
+        getData(type).texture_rect.toIntRect()}
 {
   SFML::centerOrigin(m_sprite);
 }
 
+Pickup::Pickup(Pickup const& prototype) noexcept
+  : Parent{prototype}
+  , m_type{prototype.m_type}
+  , m_textures{prototype.m_textures}
+  , m_sprite{prototype.m_sprite}
+{
+}
+
 BitFlags<Category::Type> Pickup::getCategory() const noexcept
 {
   return BitFlags<Category::Type>{Category::Type::PICKUP};
@@ -46,15 +52,73 @@ sf::FloatRect Pickup::getBoundingRect() const noexcept
   return getWorldTransform().transformRect(m_sprite.getGlobalBounds());
 }
 
+ECS::EntityId Pickup::spawnEntity(ECS::Registry& registry) const
+{
+  return registry.spawn(makeBundle<ECS::PickupBundle>(
+      ECS::PickupInfo{toUnderlyingType(m_type)}));
+}
+
+Pickup::Type Pickup::getType() const noexcept
+{
+  return m_type;
+}
+
+std::unique_ptr<Pickup> Pickup::clone() const
+{
+  return std::unique_ptr<Pickup>{new Pickup{*this}};
+}
+
+void Pickup::reset(Pickup::Type type, sf::Vector2f position) noexcept
+{
+  Parent::reset(1, position);
+  if (type != m_type)
+  {
+    m_type = type;
+    m_sprite.setTexture(m_textures.get(getData(type).texture));
+    m_sprite.setTextureRect(getData(type).texture_rect.toIntRect());
+    SFML::centerOrigin(m_sprite);
+  }
+}
+
 void Pickup::apply(Aircraft& player) const
 {
-  Data_Table[m_type].action(player);
+  PickupData const& data = getData(m_type);
+  switch (data.action)
+  {
+    case PickupData::Action::REPAIR:
+      player.repair(data.amount);
+      break;
+    case PickupData::Action::COLLECT_MISSILES:
+      player.collectMissiles(static_cast<uint16_t>(data.amount));
+      break;
+    case PickupData::Action::INCREASE_SPREAD:
+      player.increaseSpread();
+      break;
+    case PickupData::Action::INCREASE_FIRE_RATE:
+      player.increaseFireRate();
+      break;
+    default:
+      break;
+  }
 }
 
 void Pickup::drawCurrent(
     sf::RenderTarget& target, sf::RenderStates states) const
 {
-  target.draw(m_sprite, states);
+  float const pixel_scale = LodRenderer::getPixelScale(target);
+  if (!drawLod(pixel_scale, states, m_sprite.getGlobalBounds()))
+    target.draw(m_sprite, states);
+}
+
+void Pickup::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  float const pixel_scale = LodRenderer::getPixelScale(target);
+  if (!drawLod(pixel_scale, states, m_sprite.getGlobalBounds()))
+  {
+    target.draw(
+        m_sprite, states, &m_textures.getImage(getData(m_type).texture));
+  }
 }
 
 } // namespace FastSimDesign
\ No newline at end of file
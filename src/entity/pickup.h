@@ -19,12 +19,14 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Sprite.hpp>
 
+#include <memory>
+
 namespace FastSimDesign {
 class Aircraft;
 class Pickup : public Entity
 {
 public:
-  enum class Type
+  enum class Type : uint16_t
   {
     HEALTH_REFILL,
     MISSILE_REFILL,
@@ -43,14 +45,24 @@ public:
   virtual BitFlags<Category::Type> getCategory() const noexcept override;
   virtual sf::FloatRect getBoundingRect() const noexcept override;
 
+  Pickup::Type getType() const noexcept;
   void apply(Aircraft& player) const;
 
+  std::unique_ptr<Pickup> clone() const;
+  void reset(Pickup::Type type, sf::Vector2f position) noexcept;
+
 protected:
+  Pickup(Pickup const& prototype) noexcept;
+
+  virtual ECS::EntityId spawnEntity(ECS::Registry& registry) const override;
   virtual void drawCurrent(
       sf::RenderTarget& target, sf::RenderStates states) const override;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
 
 private:
   Pickup::Type m_type{};
+  TextureHolder const& m_textures;
   sf::Sprite m_sprite{};
 };
 } // namespace FastSimDesign
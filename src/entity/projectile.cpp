@@ -10,47 +10,82 @@
 
 #include "projectile.h"
 
+#include "../core/texture_holder.h"
+#include "../gui/software_render_target.h"
+#include "../utils/generic_utility.h"
 #include "../utils/math_util.h"
 #include "../utils/sfml_util.h"
 #include "emitter_node.h"
-#include "entity_data.h"
+#include "entity_catalog.h"
 #include "particle.h"
 
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/System/Vector2.hpp>
 #include <glm/trigonometric.hpp>
 
+#include <cstdint>
 #include <memory>
 
 namespace FastSimDesign {
-namespace {
-std::unordered_map<Projectile::Type, ProjectileData> Data_Table =
-    initializeProjectileData();
-}
-
 ////////////////////////////////////////////////////////////
 /// Methods
 ////////////////////////////////////////////////////////////
 Projectile::Projectile(Projectile::Type type, TextureHolder const& textures)
   : Parent{1}
   , m_type{type}
+  , m_textures{textures}
   , m_sprite{
-        textures.get(Data_Table[type].texture), Data_Table[type].m_texture_rect}
+        textures.get(getData(type).texture),
+        getData(type).texture_rect.toIntRect()}
 {
   SFML::centerOrigin(m_sprite);
+  updateEmitters();
+}
 
-  // Add particle system for missiles.
-  if (isGuided())
+Projectile::Projectile(Projectile const& prototype)
+  : Parent{prototype}
+  , m_type{prototype.m_type}
+  , m_textures{prototype.m_textures}
+  , m_sprite{prototype.m_sprite}
+  , m_target_direction{prototype.m_target_direction}
+{
+  updateEmitters();
+}
+
+std::unique_ptr<Projectile> Projectile::clone() const
+{
+  return std::unique_ptr<Projectile>{new Projectile{*this}};
+}
+
+void Projectile::reset(Projectile::Type type, sf::Vector2f position)
+{
+  Parent::reset(1, position);
+  m_target_direction = sf::Vector2f{};
+  if (type != m_type)
+  {
+    m_type = type;
+    m_sprite.setTexture(m_textures.get(getData(type).texture));
+    m_sprite.setTextureRect(getData(type).texture_rect.toIntRect());
+    SFML::centerOrigin(m_sprite);
+    updateEmitters();
+  }
+}
+
+void Projectile::updateEmitters()
+{
+  // The particle trail of the type is emitted from the tail of the sprite.
+  for (EmitterNode* emitter : m_trail)
+    detachChild(*emitter);
+  m_trail.clear();
+
+  float const offset = m_sprite.getLocalBounds().height / 2.f;
+  for (std::uint16_t particle : getData(m_type).getTrail())
   {
-    std::unique_ptr<EmitterNode> smoke =
-        std::make_unique<EmitterNode>(Particle::Type::SMOKE);
-    smoke->setPosition(0.f, getBoundingRect().height / 2.f);
-    attachChild(std::move(smoke));
-
-    std::unique_ptr<EmitterNode> propellant =
-        std::make_unique<EmitterNode>(Particle::Type::PROPELLANT);
-    propellant->setPosition(0.f, getBoundingRect().height / 2.f);
-    attachChild(std::move(propellant));
+    std::unique_ptr<EmitterNode> emitter =
+        std::make_unique<EmitterNode>(static_cast<Particle::Type>(particle));
+    emitter->setPosition(0.f, offset);
+    m_trail.push_back(emitter.get());
+    attachChild(std::move(emitter));
   }
 }
 
@@ -65,6 +100,12 @@ bool Projectile::isGuided() const
   return m_type == Projectile::Type::MISSILE;
 }
 
+ECS::EntityId Projectile::spawnEntity(ECS::Registry& registry) const
+{
+  return registry.spawn(makeBundle<ECS::ProjectileBundle>(
+      ECS::ProjectileInfo{toUnderlyingType(m_type)}));
+}
+
 BitFlags<Category::Type> Projectile::getCategory() const noexcept
 {
   if (m_type == Projectile::Type::ENEMY_BULLET)
@@ -80,12 +121,17 @@ sf::FloatRect Projectile::getBoundingRect() const noexcept
 
 float Projectile::getMaxSpeed() const
 {
-  return Data_Table[m_type].speed;
+  return getData(m_type).speed;
 }
 
 int Projectile::getDamage() const
 {
-  return Data_Table[m_type].damage;
+  return getData(m_type).damage;
+}
+
+Projectile::Type Projectile::getType() const noexcept
+{
+  return m_type;
 }
 
 void Projectile::updateCurrent(const sf::Time& dt, CommandQueue& commands)
@@ -110,7 +156,20 @@ void Projectile::updateCurrent(const sf::Time& dt, CommandQueue& commands)
 void Projectile::drawCurrent(
     sf::RenderTarget& target, sf::RenderStates states) const
 {
-  target.draw(m_sprite, states);
+  float const pixel_scale = LodRenderer::getPixelScale(target);
+  if (!drawLod(pixel_scale, states, m_sprite.getGlobalBounds()))
+    target.draw(m_sprite, states);
+}
+
+void Projectile::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  float const pixel_scale = LodRenderer::getPixelScale(target);
+  if (!drawLod(pixel_scale, states, m_sprite.getGlobalBounds()))
+  {
+    target.draw(
+        m_sprite, states, &m_textures.getImage(getData(m_type).texture));
+  }
 }
 
 } // namespace FastSimDesign
\ No newline at end of file
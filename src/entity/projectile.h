@@ -18,7 +18,11 @@
 
 #include <SFML/Graphics/Sprite.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace FastSimDesign {
+class EmitterNode;
 class Projectile : public Entity
 {
 public:
@@ -45,18 +49,31 @@ public:
   virtual sf::FloatRect getBoundingRect() const noexcept override;
   float getMaxSpeed() const;
   int getDamage() const;
+  Projectile::Type getType() const noexcept;
+
+  std::unique_ptr<Projectile> clone() const;
+  void reset(Projectile::Type type, sf::Vector2f position);
 
 protected:
+  Projectile(Projectile const& prototype);
+
+  virtual ECS::EntityId spawnEntity(ECS::Registry& registry) const override;
+
 private:
+  void updateEmitters();
   virtual void updateCurrent(
       const sf::Time& dt, CommandQueue& commands) override;
   virtual void drawCurrent(
       sf::RenderTarget& target, sf::RenderStates states) const override;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
 
 private:
   Projectile::Type m_type{};
+  TextureHolder const& m_textures;
   sf::Sprite m_sprite{};
   sf::Vector2f m_target_direction{};
+  std::vector<EmitterNode*> m_trail{}; // One emitter per trail particle.
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -10,6 +10,7 @@
 
 #include "sound_node.h"
 
+#include "../core/service_registry.h"
 #include "../core/sound_player.h"
 #include "../entity/category.h"
 
@@ -36,4 +37,14 @@ BitFlags<Category::Type> SoundNode::getCategory() const noexcept
 {
   return BitFlags<Category::Type>{Category::Type::SOUND_EFFECT};
 }
+
+void SoundNode::onServicesBound(ServiceRegistry& services) noexcept
+{
+  services.provide<SoundNode>(*this);
+}
+
+void SoundNode::onServicesUnbound(ServiceRegistry& services) noexcept
+{
+  services.revoke<SoundNode>(*this);
+}
 } // namespace FastSimDesign
\ No newline at end of file
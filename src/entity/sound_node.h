@@ -33,6 +33,10 @@ public:
 
   virtual BitFlags<Category::Type> getCategory() const noexcept override;
 
+private:
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept override;
+
 private:
   SoundPlayer& m_sounds;
 };
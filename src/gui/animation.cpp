@@ -10,7 +10,10 @@
 
 #include "animation.h"
 
+#include "../utils/generic_utility.h"
+
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 
 namespace FastSimDesign {
 ////////////////////////////////////////////////////////////
@@ -20,74 +23,75 @@ namespace FastSimDesign {
 ////////////////////////////////////////////////////////////
 /// Methods
 ////////////////////////////////////////////////////////////
-Animation::Animation(sf::Texture const& texture) noexcept
-  : m_sprite{texture}
+Animation::Animation(sf::Texture const& texture, Animations::ID clip) noexcept
+  : m_texture{&texture}
+  , m_state{toUnderlyingType(clip), 0, 0.f}
 {
 }
 
 void Animation::setTexture(sf::Texture const& texture)
 {
-  m_sprite.setTexture(texture);
+  m_texture = &texture;
 }
 
 sf::Texture const* Animation::getTexture() const noexcept
 {
-  return m_sprite.getTexture();
-}
-
-void Animation::setFrameSize(sf::Vector2i frame_size) noexcept
-{
-  m_frame_size = std::move(frame_size);
+  return m_texture;
 }
 
-sf::Vector2i const& Animation::getFrameSize() const noexcept
+void Animation::setClip(Animations::ID clip) noexcept
 {
-  return m_frame_size;
+  unbind();
+  m_state = ECS::AnimationState{toUnderlyingType(clip), 0, 0.f};
 }
 
-void Animation::setNumFrames(std::size_t num_frames) noexcept
+AnimationClip const& Animation::getClip() const noexcept
 {
-  m_num_frames = num_frames;
+  return AnimationClip::get(static_cast<Animations::ID>(m_state.clip));
 }
 
-std::size_t Animation::getNumFrames() const noexcept
+void Animation::bind(ECS::Registry& registry, ECS::EntityId entity)
 {
-  return m_num_frames;
+  unbind();
+  registry.add(entity, m_state);
+  m_registry = &registry;
+  m_entity = entity;
 }
 
-void Animation::setDuration(sf::Time duration) noexcept
+void Animation::unbind() noexcept
 {
-  m_duration = std::move(duration);
-}
+  if (!m_registry)
+    return;
 
-sf::Time const& Animation::getDuration() const noexcept
-{
-  return m_duration;
+  // Keep the last state, the entity may already be destroyed.
+  m_state = getState();
+  if (m_registry->isAlive(m_entity))
+    m_registry->remove<ECS::AnimationState>(m_entity);
+  m_registry = nullptr;
+  m_entity = ECS::EntityId{};
 }
 
-void Animation::setRepeating(bool flag) noexcept
+bool Animation::isBound() const noexcept
 {
-  m_repeat = flag;
-}
-
-bool Animation::isRepeat() const noexcept
-{
-  return m_repeat;
+  return m_registry && m_registry->has<ECS::AnimationState>(m_entity);
 }
 
 void Animation::restart() noexcept
 {
-  m_current_frame = 0;
+  unbind();
+  m_state.frame = 0;
+  m_state.elapsed = 0.f;
 }
 
 bool Animation::isFinished() const noexcept
 {
-  return m_current_frame >= m_num_frames;
+  return getState().frame >= getClip().getFrameCount();
 }
 
 sf::FloatRect Animation::getLocalBounds() const noexcept
 {
-  return sf::FloatRect{getOrigin(), static_cast<sf::Vector2f>(getFrameSize())};
+  return sf::FloatRect{
+      sf::Vector2f{}, static_cast<sf::Vector2f>(getClip().getFrameSize())};
 }
 
 sf::FloatRect Animation::getGlobalBounds() const noexcept
@@ -97,51 +101,42 @@ sf::FloatRect Animation::getGlobalBounds() const noexcept
 
 void Animation::update(sf::Time const& dt)
 {
-  sf::Time time_per_frame = m_duration / static_cast<float>(m_num_frames);
-  m_elapsed_time += dt;
-
-  sf::Vector2i texture_bounds{m_sprite.getTexture()->getSize()};
-  sf::IntRect texture_rect = m_sprite.getTextureRect();
-
-  if (m_current_frame == 0)
-    texture_rect = sf::IntRect{0, 0, m_frame_size.x, m_frame_size.y};
-
-  // While we have a frame to process.
-  while (m_elapsed_time >= time_per_frame &&
-         (m_current_frame <= m_num_frames || m_repeat))
-  {
-    // Move the texture rect left.
-    texture_rect.left += texture_rect.width;
-
-    // If we reach the end of the texture.
-    if (texture_rect.left + texture_rect.width > texture_bounds.x)
-    {
-      // Move it down one line.
-      texture_rect.left = 0;
-      texture_rect.top += texture_rect.height;
-    }
-
-    // And progress to next frame.
-    m_elapsed_time -= time_per_frame;
-    if (m_repeat)
-    {
-      m_current_frame = (m_current_frame + 1) % m_num_frames;
-      if (m_current_frame == 0)
-        texture_rect = sf::IntRect{0, 0, m_frame_size.x, m_frame_size.y};
-    }
-    else
-    {
-      ++m_current_frame;
-    }
-  }
+  // Bound animations are advanced by the animation system.
+  if (!isBound())
+    AnimationClip::advance(&m_state, 1, dt.asSeconds());
+}
 
-  m_sprite.setTextureRect(texture_rect);
+std::array<sf::Vertex, 4> Animation::getVertices() const noexcept
+{
+  sf::FloatRect const frame{getClip().getFrame(getState().frame)};
+  sf::Vector2f const size{frame.width, frame.height};
+  return std::array<sf::Vertex, 4>{
+      sf::Vertex{sf::Vector2f{0.f, 0.f}, sf::Vector2f{frame.left, frame.top}},
+      sf::Vertex{
+          sf::Vector2f{size.x, 0.f},
+          sf::Vector2f{frame.left + size.x, frame.top}},
+      sf::Vertex{size, sf::Vector2f{frame.left, frame.top} + size},
+      sf::Vertex{
+          sf::Vector2f{0.f, size.y},
+          sf::Vector2f{frame.left, frame.top + size.y}}};
 }
 
 void Animation::draw(sf::RenderTarget& target, sf::RenderStates states) const
 {
+  std::array<sf::Vertex, 4> const quad = getVertices();
   states.transform *= getTransform();
-  target.draw(m_sprite, states);
+  states.texture = m_texture;
+  target.draw(quad.data(), quad.size(), sf::Quads, states);
+}
+
+ECS::AnimationState const& Animation::getState() const noexcept
+{
+  if (m_registry)
+  {
+    if (auto const* state = m_registry->get<ECS::AnimationState>(m_entity))
+      return *state;
+  }
+  return m_state;
 }
 
 } // namespace FastSimDesign
\ No newline at end of file
@@ -13,24 +13,32 @@
 #ifndef FAST_SIM_DESIGN_ANIMATION_H
 #define FAST_SIM_DESIGN_ANIMATION_H
 
+#include "../ecs/registry.h"
+#include "animation_clip.h"
+
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Rect.hpp>
-#include <SFML/Graphics/Sprite.hpp>
 #include <SFML/Graphics/Texture.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Time.hpp>
-#include <SFML/System/Vector2.hpp>
 
-#include <cstddef>
+#include <array>
 
 namespace FastSimDesign {
+/// Drawable playing an animation clip.
+///
+/// Until it is bound to an entity, the animation advances with update().
+/// Once bound, its state lives in the ECS registry and the animation system
+/// advances it with every other playing animation.
 class Animation final
   : public sf::Drawable
   , public sf::Transformable
 {
 public:
   explicit Animation() = default;
-  explicit Animation(sf::Texture const& texture) noexcept;
+  explicit Animation(
+      sf::Texture const& texture, Animations::ID clip) noexcept;
   Animation(Animation const&) = default;
   Animation(Animation&&) = default;
   Animation& operator=(Animation const&) = default;
@@ -40,23 +48,20 @@ public:
   void setTexture(sf::Texture const& texture);
   sf::Texture const* getTexture() const noexcept;
 
-  void setFrameSize(sf::Vector2i frame_size) noexcept;
-  sf::Vector2i const& getFrameSize() const noexcept;
-
-  void setNumFrames(std::size_t num_frames) noexcept;
-  std::size_t getNumFrames() const noexcept;
+  void setClip(Animations::ID clip) noexcept;
+  AnimationClip const& getClip() const noexcept;
 
-  void setDuration(sf::Time duration) noexcept;
-  sf::Time const& getDuration() const noexcept;
-
-  void setRepeating(bool flag) noexcept;
-  bool isRepeat() const noexcept;
+  void bind(ECS::Registry& registry, ECS::EntityId entity);
+  void unbind() noexcept;
+  bool isBound() const noexcept;
 
   void restart() noexcept;
   bool isFinished() const noexcept;
 
   sf::FloatRect getLocalBounds() const noexcept;
   sf::FloatRect getGlobalBounds() const noexcept;
+  // Quad of the current frame, in local coordinates.
+  std::array<sf::Vertex, 4> getVertices() const noexcept;
 
   void update(sf::Time const& dt);
 
@@ -64,14 +69,13 @@ private:
   virtual void draw(
       sf::RenderTarget& target, sf::RenderStates states) const override;
 
+  ECS::AnimationState const& getState() const noexcept;
+
 private:
-  sf::Sprite m_sprite{};
-  sf::Vector2i m_frame_size{};
-  std::size_t m_num_frames{0};
-  std::size_t m_current_frame{0};
-  sf::Time m_duration{sf::Time::Zero};
-  sf::Time m_elapsed_time{sf::Time::Zero};
-  bool m_repeat{false};
+  sf::Texture const* m_texture{nullptr};
+  ECS::AnimationState m_state{}; // Used while unbound.
+  ECS::Registry* m_registry{nullptr};
+  ECS::EntityId m_entity{};
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
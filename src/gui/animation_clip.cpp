@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "animation_clip.h"
+
+#include "../utils/generic_utility.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+namespace FastSimDesign {
+namespace {
+// Sprite sheets hold frames of the same size, row by row.
+struct ClipDefinition
+{
+  Textures::ID texture;
+  int frame_width;
+  int frame_height;
+  int columns;
+  int frame_count;
+  float duration; // In seconds, evenly shared by the frames.
+  bool repeat;
+};
+
+constexpr ClipDefinition Clip_Definitions[]{
+    {Textures::ID::EXPLOSION, 256, 256, 4, 16, 1.f, false},
+    {Textures::ID::MINION_HIT, 32, 32, 4, 4, 0.4f, false},
+    {Textures::ID::MINION_WALK, 32, 32, 6, 6, 0.6f, true},
+    {Textures::ID::MUSCLE_HIT, 32, 32, 4, 4, 0.4f, false},
+    {Textures::ID::MUSCLE_WALK, 32, 32, 6, 6, 0.6f, true},
+    {Textures::ID::NURSE_IDLE, 32, 32, 1, 1, 1.f, true},
+    {Textures::ID::NURSE_WALK, 32, 32, 6, 6, 0.6f, true},
+    {Textures::ID::RANGER_IDLE, 32, 32, 1, 1, 1.f, true},
+    {Textures::ID::RANGER_WALK, 32, 32, 6, 6, 0.6f, true}};
+static_assert(
+    std::size(Clip_Definitions) ==
+        toUnderlyingType(Animations::ID::ANIMATION_COUNT),
+    "Clip_Definitions must have one entry per Animations::ID.");
+
+AnimationClip makeClip(ClipDefinition const& definition)
+{
+  std::vector<sf::IntRect> frames{};
+  for (int i = 0; i < definition.frame_count; ++i)
+  {
+    frames.push_back(sf::IntRect{
+        (i % definition.columns) * definition.frame_width,
+        (i / definition.columns) * definition.frame_height,
+        definition.frame_width,
+        definition.frame_height});
+  }
+  std::vector<float> durations(
+      frames.size(),
+      definition.duration / static_cast<float>(definition.frame_count));
+  return AnimationClip{
+      definition.texture,
+      std::move(frames),
+      std::move(durations),
+      definition.repeat};
+}
+
+std::vector<AnimationClip> makeClips()
+{
+  std::vector<AnimationClip> clips{};
+  for (ClipDefinition const& definition : Clip_Definitions)
+    clips.push_back(makeClip(definition));
+  return clips;
+}
+
+std::vector<AnimationClip> const& getClips()
+{
+  static std::vector<AnimationClip> const clips = makeClips();
+  return clips;
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+AnimationClip const& AnimationClip::get(Animations::ID id) noexcept
+{
+  std::vector<AnimationClip> const& clips = getClips();
+  assert(toUnderlyingType(id) < clips.size());
+  return clips[toUnderlyingType(id)];
+}
+
+void AnimationClip::advance(
+    ECS::AnimationState* states, std::size_t count, float dt) noexcept
+{
+  std::vector<AnimationClip> const& clips = getClips();
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    ECS::AnimationState& state = states[i];
+    AnimationClip const& clip = clips[state.clip];
+
+    state.elapsed += dt;
+    if (clip.m_repeat && state.elapsed >= clip.getDuration())
+      state.elapsed = std::fmod(state.elapsed, clip.getDuration());
+    state.frame = clip.getFrameIndex(state.elapsed);
+  }
+}
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+AnimationClip::AnimationClip(
+    Textures::ID texture,
+    std::vector<sf::IntRect> frames,
+    std::vector<float> frame_durations,
+    bool repeat)
+  : m_texture{texture}
+  , m_frames{std::move(frames)}
+  , m_repeat{repeat}
+{
+  assert(!m_frames.empty() && m_frames.size() == frame_durations.size());
+
+  float end = 0.f;
+  for (float duration : frame_durations)
+  {
+    end += duration;
+    m_frame_ends.push_back(end);
+  }
+
+  bool const is_uniform = std::all_of(
+      frame_durations.begin(), frame_durations.end(), [&](float duration) {
+        return duration == frame_durations.front();
+      });
+  if (is_uniform && frame_durations.front() > 0.f)
+    m_frame_duration = frame_durations.front();
+}
+
+std::uint16_t AnimationClip::getFrameIndex(float elapsed) const noexcept
+{
+  if (m_frame_duration > 0.f)
+  {
+    float const index = std::floor(std::max(elapsed, 0.f) / m_frame_duration);
+    return static_cast<std::uint16_t>(
+        std::min(index, static_cast<float>(m_frames.size())));
+  }
+
+  auto end =
+      std::upper_bound(m_frame_ends.begin(), m_frame_ends.end(), elapsed);
+  return static_cast<std::uint16_t>(end - m_frame_ends.begin());
+}
+
+sf::IntRect const& AnimationClip::getFrame(std::size_t index) const noexcept
+{
+  return m_frames[std::min(index, m_frames.size() - 1)];
+}
+
+std::size_t AnimationClip::getFrameCount() const noexcept
+{
+  return m_frames.size();
+}
+
+sf::Vector2i AnimationClip::getFrameSize() const noexcept
+{
+  return sf::Vector2i{m_frames.front().width, m_frames.front().height};
+}
+
+float AnimationClip::getDuration() const noexcept
+{
+  return m_frame_ends.back();
+}
+
+bool AnimationClip::isRepeating() const noexcept
+{
+  return m_repeat;
+}
+
+Textures::ID AnimationClip::getTexture() const noexcept
+{
+  return m_texture;
+}
+
+} // namespace FastSimDesign
\ No newline at end of file
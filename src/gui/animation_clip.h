@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_ANIMATION_CLIP_H
+#define FAST_SIM_DESIGN_ANIMATION_CLIP_H
+
+#include "../core/resource_identifiers.h"
+#include "../ecs/components.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FastSimDesign {
+namespace Animations {
+enum class ID : uint16_t
+{
+  EXPLOSION,
+  MINION_HIT,
+  MINION_WALK,
+  MUSCLE_HIT,
+  MUSCLE_WALK,
+  NURSE_IDLE,
+  NURSE_WALK,
+  RANGER_IDLE,
+  RANGER_WALK,
+  ANIMATION_COUNT
+};
+}
+
+/// Frames of an animation, computed once from its sprite sheet and shared by
+/// every animation playing it. An elapsed time maps to its frame with a
+/// division when all frames last the same time, else with a binary search in
+/// the tabulated end time of each frame.
+class AnimationClip final
+{
+public:
+  explicit AnimationClip(
+      Textures::ID texture,
+      std::vector<sf::IntRect> frames,
+      std::vector<float> frame_durations,
+      bool repeat);
+  AnimationClip(AnimationClip const&) = default;
+  AnimationClip(AnimationClip&&) = default;
+  AnimationClip& operator=(AnimationClip const&) = default;
+  AnimationClip& operator=(AnimationClip&&) = default;
+  virtual ~AnimationClip() = default;
+
+  static AnimationClip const& get(Animations::ID id) noexcept;
+
+  // Advance `count` animations by `dt` seconds and update their frame, in one
+  // pass over the states of a chunk.
+  static void advance(
+      ECS::AnimationState* states, std::size_t count, float dt) noexcept;
+
+  // Frame displayed after `elapsed` seconds, getFrameCount() once a clip
+  // that does not repeat is over.
+  std::uint16_t getFrameIndex(float elapsed) const noexcept;
+  // Clamped to the last frame.
+  sf::IntRect const& getFrame(std::size_t index) const noexcept;
+  std::size_t getFrameCount() const noexcept;
+  sf::Vector2i getFrameSize() const noexcept;
+  float getDuration() const noexcept;
+  bool isRepeating() const noexcept;
+  Textures::ID getTexture() const noexcept;
+
+private:
+  Textures::ID m_texture{};
+  std::vector<sf::IntRect> m_frames{};
+  std::vector<float> m_frame_ends{};
+  float m_frame_duration{0.f}; // Zero unless all frames last the same time.
+  bool m_repeat{false};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,278 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "bitmap_font.h"
+
+#include "../core/resource_exception.h"
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace FastSimDesign {
+namespace {
+using LibraryPtr = std::unique_ptr<
+    std::remove_pointer_t<FT_Library>,
+    decltype(&FT_Done_FreeType)>;
+using FacePtr =
+    std::unique_ptr<std::remove_pointer_t<FT_Face>, decltype(&FT_Done_Face)>;
+
+// Coverage of the pixel (x, y) of a rendered glyph, in [0, 255].
+std::uint8_t getCoverage(FT_Bitmap const& bitmap, unsigned x, unsigned y)
+{
+  unsigned char const* row =
+      bitmap.buffer + static_cast<std::ptrdiff_t>(y) * bitmap.pitch;
+  if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+    return (row[x / 8] & (0x80 >> (x % 8))) != 0 ? 255 : 0;
+  return row[x];
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+std::size_t BitmapFont::getGlyphIndex(char character) noexcept
+{
+  char32_t const code = static_cast<unsigned char>(character);
+  if (code < First_Character || code > Last_Character)
+    return static_cast<std::size_t>(U'?' - First_Character);
+  return static_cast<std::size_t>(code - First_Character);
+}
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+BitmapFont::BitmapFont(
+    std::string const& file_path, unsigned character_size, bool is_headless)
+  : m_character_size{character_size}
+  , m_kernings(Glyph_Count * Glyph_Count)
+{
+  FT_Library library_handle = nullptr;
+  if (FT_Init_FreeType(&library_handle) != 0)
+    throw ResourceException{"Failed to initialize FreeType"};
+  LibraryPtr const library{library_handle, &FT_Done_FreeType};
+
+  FT_Face face_handle = nullptr;
+  if (FT_New_Face(library.get(), file_path.c_str(), 0, &face_handle) != 0)
+    throw ResourceException{"Failed to load the font " + file_path};
+  FacePtr const face{face_handle, &FT_Done_Face};
+  if (FT_Set_Pixel_Sizes(face.get(), 0, character_size) != 0)
+    throw ResourceException{"Failed to set the size of the font " + file_path};
+  m_line_spacing = static_cast<float>(face->size->metrics.height) / 64.f;
+
+  // Render every glyph and place it on the shelves of the atlas, the image is
+  // filled once its height is known.
+  unsigned const atlas_width = std::max(256u, character_size * 16);
+  std::vector<std::vector<std::uint8_t>> coverages(Glyph_Count);
+  unsigned x = Atlas_Padding;
+  unsigned y = Atlas_Padding;
+  unsigned shelf_height = 0;
+  for (std::size_t i = 0; i < Glyph_Count; ++i)
+  {
+    if (FT_Load_Char(
+            face.get(),
+            First_Character + i,
+            FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT) !=
+        0)
+      throw ResourceException{"Failed to render a glyph of " + file_path};
+
+    FT_GlyphSlot const slot = face->glyph;
+    FT_Bitmap const& bitmap = slot->bitmap;
+    unsigned const width = bitmap.width;
+    unsigned const height = bitmap.rows;
+    if (x + width + Atlas_Padding > atlas_width)
+    {
+      x = Atlas_Padding;
+      y += shelf_height + Atlas_Padding;
+      shelf_height = 0;
+    }
+    m_glyphs[i] = Glyph{
+        sf::FloatRect{
+            static_cast<float>(slot->bitmap_left),
+            -static_cast<float>(slot->bitmap_top),
+            static_cast<float>(width),
+            static_cast<float>(height)},
+        sf::FloatRect{
+            static_cast<float>(x),
+            static_cast<float>(y),
+            static_cast<float>(width),
+            static_cast<float>(height)},
+        static_cast<float>(slot->advance.x / 64)};
+
+    std::vector<std::uint8_t>& coverage = coverages[i];
+    coverage.resize(static_cast<std::size_t>(width) * height);
+    for (unsigned row = 0; row < height; ++row)
+    {
+      for (unsigned column = 0; column < width; ++column)
+        coverage[row * width + column] = getCoverage(bitmap, column, row);
+    }
+    x += width + Atlas_Padding;
+    shelf_height = std::max(shelf_height, height);
+  }
+
+  // Glyphs are white, their coverage in the alpha channel.
+  m_image.create(
+      atlas_width,
+      y + shelf_height + Atlas_Padding,
+      sf::Color{255, 255, 255, 0});
+  for (std::size_t i = 0; i < Glyph_Count; ++i)
+  {
+    sf::FloatRect const& rect = m_glyphs[i].texture_rect;
+    unsigned const left = static_cast<unsigned>(rect.left);
+    unsigned const top = static_cast<unsigned>(rect.top);
+    unsigned const width = static_cast<unsigned>(rect.width);
+    for (std::size_t pixel = 0; pixel < coverages[i].size(); ++pixel)
+    {
+      m_image.setPixel(
+          left + static_cast<unsigned>(pixel % width),
+          top + static_cast<unsigned>(pixel / width),
+          sf::Color{255, 255, 255, coverages[i][pixel]});
+    }
+  }
+  if (!is_headless && !m_texture.loadFromImage(m_image))
+    throw ResourceException{"Failed to create the glyph atlas of a font"};
+
+  if (!FT_HAS_KERNING(face.get()))
+    return;
+  std::array<FT_UInt, Glyph_Count> indices{};
+  for (std::size_t i = 0; i < Glyph_Count; ++i)
+    indices[i] = FT_Get_Char_Index(face.get(), First_Character + i);
+  for (std::size_t previous = 0; previous < Glyph_Count; ++previous)
+  {
+    for (std::size_t current = 0; current < Glyph_Count; ++current)
+    {
+      FT_Vector kerning{};
+      FT_Get_Kerning(
+          face.get(),
+          indices[previous],
+          indices[current],
+          FT_KERNING_DEFAULT,
+          &kerning);
+      m_kernings[previous * Glyph_Count + current] =
+          static_cast<float>(kerning.x) / 64.f;
+    }
+  }
+}
+
+std::shared_ptr<TextLayout const> BitmapFont::getLayout(
+    std::string const& text) const
+{
+  auto found = m_layouts.find(text);
+  if (found != m_layouts.end())
+    return found->second;
+
+  if (m_layouts.size() >= Max_Cached_Layouts)
+    m_layouts.clear();
+
+  auto layout = std::make_shared<TextLayout>();
+  shape(text, *layout);
+  return m_layouts.emplace(text, std::move(layout)).first->second;
+}
+
+sf::Texture const& BitmapFont::getTexture() const noexcept
+{
+  return m_texture;
+}
+
+sf::Image const& BitmapFont::getImage() const noexcept
+{
+  return m_image;
+}
+
+unsigned BitmapFont::getCharacterSize() const noexcept
+{
+  return m_character_size;
+}
+
+float BitmapFont::getLineSpacing() const noexcept
+{
+  return m_line_spacing;
+}
+
+void BitmapFont::shape(std::string const& text, TextLayout& layout) const
+{
+  float const whitespace_width = m_glyphs[getGlyphIndex(' ')].advance;
+  float min_x = std::numeric_limits<float>::max();
+  float min_y = std::numeric_limits<float>::max();
+  float max_x = std::numeric_limits<float>::lowest();
+  float max_y = std::numeric_limits<float>::lowest();
+
+  layout.vertices.reserve(text.size() * 4);
+  float x = 0.f;
+  float y = static_cast<float>(m_character_size);
+  std::size_t previous = Glyph_Count; // None.
+  for (char const character : text)
+  {
+    if (character == '\n')
+    {
+      x = 0.f;
+      y += m_line_spacing;
+      previous = Glyph_Count;
+      continue;
+    }
+    if (character == '\t')
+    {
+      x += whitespace_width * 4.f;
+      previous = Glyph_Count;
+      continue;
+    }
+
+    std::size_t const index = getGlyphIndex(character);
+    if (previous < Glyph_Count)
+      x += m_kernings[previous * Glyph_Count + index];
+    previous = index;
+
+    Glyph const& glyph = m_glyphs[index];
+    if (character != ' ')
+    {
+      float const left = x + glyph.bounds.left;
+      float const top = y + glyph.bounds.top;
+      float const right = left + glyph.bounds.width;
+      float const bottom = top + glyph.bounds.height;
+      float const u = glyph.texture_rect.left;
+      float const v = glyph.texture_rect.top;
+      float const u_end = u + glyph.texture_rect.width;
+      float const v_end = v + glyph.texture_rect.height;
+
+      layout.vertices.emplace_back(
+          sf::Vector2f{left, top}, sf::Color::White, sf::Vector2f{u, v});
+      layout.vertices.emplace_back(
+          sf::Vector2f{right, top}, sf::Color::White, sf::Vector2f{u_end, v});
+      layout.vertices.emplace_back(
+          sf::Vector2f{right, bottom},
+          sf::Color::White,
+          sf::Vector2f{u_end, v_end});
+      layout.vertices.emplace_back(
+          sf::Vector2f{left, bottom},
+          sf::Color::White,
+          sf::Vector2f{u, v_end});
+
+      min_x = std::min(min_x, left);
+      min_y = std::min(min_y, top);
+      max_x = std::max(max_x, right);
+      max_y = std::max(max_y, bottom);
+    }
+    x += glyph.advance;
+  }
+
+  if (!layout.vertices.empty())
+    layout.bounds = sf::FloatRect{min_x, min_y, max_x - min_x, max_y - min_y};
+}
+} // namespace FastSimDesign
\ No newline at end of file
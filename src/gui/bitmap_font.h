@@ -0,0 +1,99 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_BITMAP_FONT_H
+#define FAST_SIM_DESIGN_BITMAP_FONT_H
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace FastSimDesign {
+/// Quads of a shaped string, in local coordinates with the baseline of the
+/// first line at the character size, as sf::Text. Vertices are white.
+struct TextLayout
+{
+  std::vector<sf::Vertex> vertices{};
+  sf::FloatRect bounds{};
+};
+
+/// Font of one character size whose printable ASCII glyphs are baked once in
+/// an atlas, with their kernings. Shaped strings are cached, so setting a
+/// text to a string seen before costs a lookup.
+///
+/// Glyphs are rasterized with FreeType into the image of the atlas, the
+/// texture is only made from it, so that a headless font needs no OpenGL
+/// context. Characters outside of the baked range are drawn as '?'.
+class BitmapFont final : private sf::NonCopyable
+{
+public:
+  static constexpr char32_t First_Character = 32; // Space.
+  static constexpr char32_t Last_Character = 126; // Tilde.
+  static constexpr std::size_t Glyph_Count =
+      Last_Character - First_Character + 1;
+  // The cache is emptied when it reaches this size, layouts still used by
+  // texts are kept alive by them.
+  static constexpr std::size_t Max_Cached_Layouts = 4096;
+
+public:
+  static constexpr unsigned Atlas_Padding = 1; // Around glyphs, in pixels.
+
+public:
+  // Bitmap fonts are owned by the FontHolder of their font, see
+  // `FontHolder::getBitmapFont()`. A headless font has no texture.
+  explicit BitmapFont(
+      std::string const& file_path,
+      unsigned character_size,
+      bool is_headless = false);
+  virtual ~BitmapFont() = default;
+
+  std::shared_ptr<TextLayout const> getLayout(std::string const& text) const;
+  // Not created when headless.
+  sf::Texture const& getTexture() const noexcept;
+  // Pixels of the atlas, for software rendering.
+  sf::Image const& getImage() const noexcept;
+  unsigned getCharacterSize() const noexcept;
+  float getLineSpacing() const noexcept;
+
+private:
+  struct Glyph
+  {
+    sf::FloatRect bounds{};
+    sf::FloatRect texture_rect{};
+    float advance{0.f};
+  };
+
+private:
+  static std::size_t getGlyphIndex(char character) noexcept;
+  void shape(std::string const& text, TextLayout& layout) const;
+
+private:
+  sf::Image m_image{};
+  sf::Texture m_texture{};
+  unsigned m_character_size{0};
+  float m_line_spacing{0.f};
+  std::array<Glyph, Glyph_Count> m_glyphs{};
+  // Kerning between each pair of glyphs, indexed by [previous][current].
+  std::vector<float> m_kernings{};
+  mutable std::unordered_map<std::string, std::shared_ptr<TextLayout const>>
+      m_layouts{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
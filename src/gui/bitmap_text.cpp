@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "bitmap_text.h"
+
+#include <utility>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+BitmapText::BitmapText(std::string text, BitmapFont const& font)
+  : m_font{&font}
+  , m_string{std::move(text)}
+{
+  updateLayout();
+}
+
+void BitmapText::setFont(BitmapFont const& font)
+{
+  if (m_font == &font)
+    return;
+  m_font = &font;
+  updateLayout();
+}
+
+void BitmapText::setString(std::string text)
+{
+  if (m_string == text)
+    return;
+  m_string = std::move(text);
+  updateLayout();
+}
+
+void BitmapText::setFillColor(sf::Color color) noexcept
+{
+  if (m_fill_color == color)
+    return;
+  m_fill_color = color;
+  m_needs_vertex_update = true;
+}
+
+BitmapFont const* BitmapText::getFont() const noexcept
+{
+  return m_font;
+}
+
+std::string const& BitmapText::getString() const noexcept
+{
+  return m_string;
+}
+
+sf::Color BitmapText::getFillColor() const noexcept
+{
+  return m_fill_color;
+}
+
+TextLayout const* BitmapText::getLayout() const noexcept
+{
+  return m_layout.get();
+}
+
+sf::FloatRect BitmapText::getLocalBounds() const noexcept
+{
+  return m_layout ? m_layout->bounds : sf::FloatRect{};
+}
+
+sf::FloatRect BitmapText::getGlobalBounds() const noexcept
+{
+  return getTransform().transformRect(getLocalBounds());
+}
+
+void BitmapText::draw(sf::RenderTarget& target, sf::RenderStates states) const
+{
+  if (!m_layout || m_layout->vertices.empty())
+    return;
+
+  if (m_needs_vertex_update)
+  {
+    m_vertices = m_layout->vertices;
+    for (sf::Vertex& vertex : m_vertices)
+      vertex.color = m_fill_color;
+    m_needs_vertex_update = false;
+  }
+
+  states.transform *= getTransform();
+  states.texture = &m_font->getTexture();
+  target.draw(m_vertices.data(), m_vertices.size(), sf::Quads, states);
+}
+
+void BitmapText::updateLayout()
+{
+  m_layout = m_font ? m_font->getLayout(m_string) : nullptr;
+  m_needs_vertex_update = true;
+}
+} // namespace FastSimDesign
\ No newline at end of file
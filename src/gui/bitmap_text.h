@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_BITMAP_TEXT_H
+#define FAST_SIM_DESIGN_BITMAP_TEXT_H
+
+#include "bitmap_font.h"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace FastSimDesign {
+/// Text drawn from the atlas of a bitmap font, in place of sf::Text. Its
+/// layout is shared with every text of the same string and font, and only
+/// looked up again when the string changes.
+class BitmapText final
+  : public sf::Drawable
+  , public sf::Transformable
+{
+public:
+  explicit BitmapText() = default;
+  explicit BitmapText(std::string text, BitmapFont const& font);
+  BitmapText(BitmapText const&) = default;
+  BitmapText(BitmapText&&) = default;
+  BitmapText& operator=(BitmapText const&) = default;
+  BitmapText& operator=(BitmapText&&) = default;
+  virtual ~BitmapText() = default;
+
+  void setFont(BitmapFont const& font);
+  void setString(std::string text);
+  void setFillColor(sf::Color color) noexcept;
+  BitmapFont const* getFont() const noexcept;
+  std::string const& getString() const noexcept;
+  sf::Color getFillColor() const noexcept;
+  // Null until the text has a font.
+  TextLayout const* getLayout() const noexcept;
+  sf::FloatRect getLocalBounds() const noexcept;
+  sf::FloatRect getGlobalBounds() const noexcept;
+
+private:
+  virtual void draw(
+      sf::RenderTarget& target, sf::RenderStates states) const override;
+
+  void updateLayout();
+
+private:
+  BitmapFont const* m_font{nullptr};
+  std::string m_string{};
+  sf::Color m_fill_color{sf::Color::White};
+  std::shared_ptr<TextLayout const> m_layout{};
+  // Colored copy of the layout, only filled when the text is drawn alone.
+  mutable std::vector<sf::Vertex> m_vertices{};
+  mutable bool m_needs_vertex_update{true};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -10,6 +10,8 @@
 
 #include "bloom_effect.h"
 
+#include "render_target_pool.h"
+
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/System/Vector2.hpp>
 
@@ -42,42 +44,31 @@ BloomEffet::BloomEffet() noexcept
       "../assets/shaders/guassian_blur.frag");
 }
 
-void BloomEffet::apply(sf::RenderTexture const& input, sf::RenderTarget& output)
-{
-  prepareTextures(input.getSize());
-
-  filterBright(input, m_brightness_texture);
-
-  downsample(m_brightness_texture, m_first_pass_textures[0]);
-  blurMultipass(m_first_pass_textures);
-
-  downsample(m_first_pass_textures[0], m_second_pass_textures[0]);
-  blurMultipass(m_second_pass_textures);
-
-  add(m_first_pass_textures[0],
-      m_second_pass_textures[0],
-      m_first_pass_textures[1]);
-  m_first_pass_textures[1].display();
-  add(input, m_first_pass_textures[1], output);
-}
-
-void BloomEffet::prepareTextures(sf::Vector2u const& size)
+void BloomEffet::apply(
+    sf::RenderTexture const& input,
+    sf::RenderTarget& output,
+    RenderTargetPool& targets)
 {
-  if (m_brightness_texture.getSize() != size)
-  {
-    m_brightness_texture.create(size.x, size.y);
-    m_brightness_texture.setSmooth(true);
-
-    m_first_pass_textures[0].create(size.x / 2, size.y / 2);
-    m_first_pass_textures[0].setSmooth(true);
-    m_first_pass_textures[1].create(size.x / 2, size.y / 2);
-    m_first_pass_textures[1].setSmooth(true);
-
-    m_second_pass_textures[0].create(size.x / 4, size.y / 4);
-    m_second_pass_textures[0].setSmooth(true);
-    m_second_pass_textures[1].create(size.x / 4, size.y / 4);
-    m_second_pass_textures[1].setSmooth(true);
-  }
+  sf::Vector2u const size = input.getSize();
+  RenderTargetPool::Lease brightness_texture = targets.acquire(size);
+  RenderTargetPool::Lease first_pass_textures[2]{
+      targets.acquire(size / 2u), targets.acquire(size / 2u)};
+  RenderTargetPool::Lease second_pass_textures[2]{
+      targets.acquire(size / 4u), targets.acquire(size / 4u)};
+
+  filterBright(input, *brightness_texture);
+
+  downsample(*brightness_texture, *first_pass_textures[0]);
+  blurMultipass(*first_pass_textures[0], *first_pass_textures[1]);
+
+  downsample(*first_pass_textures[0], *second_pass_textures[0]);
+  blurMultipass(*second_pass_textures[0], *second_pass_textures[1]);
+
+  add(*first_pass_textures[0],
+      *second_pass_textures[0],
+      *first_pass_textures[1]);
+  first_pass_textures[1]->display();
+  add(input, *first_pass_textures[1], output);
 }
 
 void BloomEffet::filterBright(
@@ -90,19 +81,20 @@ void BloomEffet::filterBright(
   output.display();
 }
 
-void BloomEffet::blurMultipass(RenderTextureArray& render_textures)
+void BloomEffet::blurMultipass(
+    sf::RenderTexture& first, sf::RenderTexture& second)
 {
-  sf::Vector2u texture_size = render_textures[0].getSize();
+  sf::Vector2u texture_size = first.getSize();
 
   for (std::size_t count = 0; count < 2; ++count)
   {
     blur(
-        render_textures[0],
-        render_textures[1],
+        first,
+        second,
         sf::Vector2f{0.f, 1.f / static_cast<float>(texture_size.y)});
     blur(
-        render_textures[1],
-        render_textures[0],
+        second,
+        first,
         sf::Vector2f{1.f / static_cast<float>(texture_size.x), 0.f});
   }
 }
@@ -19,27 +19,24 @@
 #include <SFML/Graphics/RenderTexture.hpp>
 #include <SFML/System/Vector2.hpp>
 
-#include <array>
-
 namespace FastSimDesign {
 class BloomEffet : public PostEffect
 {
 private:
   using Parent = PostEffect;
-  using RenderTextureArray = std::array<sf::RenderTexture, 2>;
 
 public:
   explicit BloomEffet() noexcept;
   virtual ~BloomEffet() = default;
 
   virtual void apply(
-      sf::RenderTexture const& input, sf::RenderTarget& output) override;
+      sf::RenderTexture const& input,
+      sf::RenderTarget& output,
+      RenderTargetPool& targets) override;
 
 private:
-  void prepareTextures(sf::Vector2u const& size);
-
   void filterBright(sf::RenderTexture const& input, sf::RenderTexture& output);
-  void blurMultipass(RenderTextureArray& render_textures);
+  void blurMultipass(sf::RenderTexture& first, sf::RenderTexture& second);
   void blur(
       sf::RenderTexture const& input,
       sf::RenderTexture& output,
@@ -52,10 +49,6 @@ private:
 
 private:
   ShaderHolder m_shaders{};
-
-  sf::RenderTexture m_brightness_texture{};
-  RenderTextureArray m_first_pass_textures{};
-  RenderTextureArray m_second_pass_textures{};
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -10,8 +10,9 @@
 
 #include "button.h"
 
-#include "../core/resource_identifiers.h"
+#include "../core/font_holder.h"
 #include "../core/sound_player.h"
+#include "../core/texture_holder.h"
 #include "../state_machine/state.h"
 #include "../utils/generic_utility.h"
 #include "../utils/sfml_util.h"
@@ -29,7 +30,7 @@ namespace GUI {
 ////////////////////////////////////////////////////////////
 Button::Button(State::Context context)
   : m_sprite{context.textures->get(Textures::ID::BUTTONS)}
-  , m_text{"", context.fonts->get(Fonts::ID::MAIN), 16}
+  , m_text{"", context.fonts->getBitmapFont(Fonts::ID::MAIN, 16)}
   , m_is_toggle{false}
   , m_sounds{context.sounds}
 {
@@ -14,12 +14,12 @@
 #define FAST_SIM_DESIGN_BUTTON_H
 
 #include "../state_machine/state.h"
+#include "bitmap_text.h"
 #include "component.h"
 
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Sprite.hpp>
-#include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include <cstdint>
@@ -72,7 +72,7 @@ private:
 private:
   Button::Callback m_callback{};
   sf::Sprite m_sprite{};
-  sf::Text m_text{};
+  BitmapText m_text{};
   bool m_is_toggle{false};
   SoundPlayer* m_sounds{nullptr};
 };
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "cached_layer_node.h"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+
+namespace FastSimDesign {
+namespace {
+bool containsRect(sf::FloatRect const& outer, sf::FloatRect const& inner)
+{
+  return inner.left >= outer.left && inner.top >= outer.top &&
+         inner.left + inner.width <= outer.left + outer.width &&
+         inner.top + inner.height <= outer.top + outer.height;
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+CachedLayerNode::CachedLayerNode(Category::Type category, float margin)
+  : Parent{category}
+  , m_margin{margin}
+{
+  auto content = std::make_unique<SceneNode>();
+  m_content = content.get();
+  attachChild(std::move(content));
+}
+
+SceneNode& CachedLayerNode::getContent() noexcept
+{
+  return *m_content;
+}
+
+void CachedLayerNode::invalidate() noexcept
+{
+  m_is_valid = false;
+}
+
+void CachedLayerNode::setCacheEnabled(bool flag) noexcept
+{
+  m_is_cache_enabled = flag;
+  m_is_valid = false;
+}
+
+bool CachedLayerNode::isCacheEnabled() const noexcept
+{
+  return m_is_cache_enabled;
+}
+
+void CachedLayerNode::onDescendantsChanged() noexcept
+{
+  m_is_valid = false;
+}
+
+void CachedLayerNode::draw(
+    sf::RenderTarget& target, sf::RenderStates states) const
+{
+  // The states hold the transform of the parents only: the texture is cached
+  // in their coordinates with the transform of this node applied, so that
+  // the parents can move without rendering it again.
+  sf::RenderStates content_states = states;
+  content_states.transform *= getTransform();
+
+  sf::View const& view = target.getView();
+  sf::FloatRect const view_bounds = states.transform.getInverse().transformRect(
+      sf::FloatRect{view.getCenter() - view.getSize() / 2.f, view.getSize()});
+  sf::IntRect const viewport = target.getViewport(view);
+  sf::Vector2f const scale{
+      static_cast<float>(viewport.width) / view_bounds.width,
+      static_cast<float>(viewport.height) / view_bounds.height};
+
+  if (m_is_cache_enabled && haveContentTransformsChanged())
+    m_is_valid = false;
+
+  bool is_cached = m_is_cache_enabled && m_is_valid &&
+                   scale == m_cached_scale &&
+                   getTransform() == m_cached_transform &&
+                   containsRect(m_cached_area, view_bounds);
+  if (m_is_cache_enabled && !is_cached)
+    is_cached = render(view_bounds, scale, states);
+  if (!is_cached)
+  {
+    target.draw(*m_content, content_states);
+    return;
+  }
+
+  states.texture = &m_texture.getTexture();
+  target.draw(m_quad.data(), m_quad.size(), sf::Quads, states);
+}
+
+bool CachedLayerNode::render(
+    sf::FloatRect const& view,
+    sf::Vector2f scale,
+    sf::RenderStates const& states) const
+{
+  // The cached area is aligned on texture pixels, so that the quad maps them
+  // one to one on the target.
+  sf::FloatRect area{
+      std::floor((view.left - m_margin) * scale.x) / scale.x,
+      std::floor((view.top - m_margin) * scale.y) / scale.y,
+      0.f,
+      0.f};
+  sf::Vector2u const texture_size{
+      static_cast<unsigned>(std::ceil((view.width + 2.f * m_margin) * scale.x)),
+      static_cast<unsigned>(
+          std::ceil((view.height + 2.f * m_margin) * scale.y))};
+  area.width = static_cast<float>(texture_size.x) / scale.x;
+  area.height = static_cast<float>(texture_size.y) / scale.y;
+
+  unsigned const max_size = sf::Texture::getMaximumSize();
+  if (texture_size.x == 0 || texture_size.y == 0 ||
+      texture_size.x > max_size || texture_size.y > max_size)
+    return false;
+  if (m_texture.getSize() != texture_size &&
+      !m_texture.create(texture_size.x, texture_size.y))
+    return false;
+
+  sf::RenderStates content_states = states;
+  content_states.transform = getTransform();
+  m_texture.clear(sf::Color::Transparent);
+  m_texture.setView(sf::View{area});
+  m_texture.draw(*m_content, content_states);
+  m_texture.display();
+
+  float const right = area.left + area.width;
+  float const bottom = area.top + area.height;
+  float const texture_width = static_cast<float>(texture_size.x);
+  float const texture_height = static_cast<float>(texture_size.y);
+  m_quad[0] = sf::Vertex{sf::Vector2f{area.left, area.top}, sf::Vector2f{}};
+  m_quad[1] = sf::Vertex{
+      sf::Vector2f{right, area.top}, sf::Vector2f{texture_width, 0.f}};
+  m_quad[2] = sf::Vertex{
+      sf::Vector2f{right, bottom},
+      sf::Vector2f{texture_width, texture_height}};
+  m_quad[3] = sf::Vertex{
+      sf::Vector2f{area.left, bottom}, sf::Vector2f{0.f, texture_height}};
+
+  m_cached_area = area;
+  m_cached_scale = scale;
+  m_cached_transform = getTransform();
+  m_is_valid = true;
+  return true;
+}
+
+bool CachedLayerNode::haveContentTransformsChanged() const
+{
+  std::size_t index = 0;
+  bool has_changed = false;
+  m_content->visit([&](SceneNode const& node) {
+    if (index == m_content_transforms.size())
+    {
+      m_content_transforms.push_back(node.getTransform());
+      has_changed = true;
+    }
+    else if (m_content_transforms[index] != node.getTransform())
+    {
+      m_content_transforms[index] = node.getTransform();
+      has_changed = true;
+    }
+    ++index;
+  });
+
+  if (index != m_content_transforms.size())
+  {
+    m_content_transforms.resize(index);
+    has_changed = true;
+  }
+  return has_changed;
+}
+} // namespace FastSimDesign
\ No newline at end of file
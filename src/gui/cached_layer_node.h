@@ -0,0 +1,90 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_CACHED_LAYER_NODE_H
+#define FAST_SIM_DESIGN_CACHED_LAYER_NODE_H
+
+#include "scene_node.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <vector>
+
+namespace FastSimDesign {
+/// Layer of static nodes drawn from an offscreen texture.
+///
+/// The content is rendered once in a texture covering the view plus a margin
+/// on each side, then drawn as one quad. It is rendered again only when the
+/// view leaves the cached area or changes scale, when a node is attached
+/// under this one or detached from it, when the transform of this node or of
+/// a node of the content changes, or after invalidate().
+///
+/// The cache is disabled until setCacheEnabled() is called, for layers known
+/// to be static.
+class CachedLayerNode final : public SceneNode
+{
+private:
+  using Parent = SceneNode;
+
+public:
+  static constexpr float Default_Margin = 256.f; // In world units.
+
+public:
+  explicit CachedLayerNode(
+      Category::Type category = Category::Type::NONE,
+      float margin = Default_Margin);
+  virtual ~CachedLayerNode() = default;
+
+  // Node to attach the static nodes to, the only child of this node. It is
+  // part of the scene graph for commands, collisions and the monitor, but it
+  // is drawn only through the cached texture.
+  SceneNode& getContent() noexcept;
+  // For changes of the look of the content other than its nodes and their
+  // transforms, e.g. a texture.
+  void invalidate() noexcept;
+  // When disabled, the content is drawn directly each frame.
+  void setCacheEnabled(bool flag) noexcept;
+  bool isCacheEnabled() const noexcept;
+
+private:
+  virtual void onDescendantsChanged() noexcept override;
+  virtual void draw(
+      sf::RenderTarget& target, sf::RenderStates states) const override;
+
+  bool render(
+      sf::FloatRect const& view,
+      sf::Vector2f scale,
+      sf::RenderStates const& states) const;
+  // Compare the transforms of the content nodes with the cached ones, and
+  // store them.
+  bool haveContentTransformsChanged() const;
+
+private:
+  SceneNode* m_content{nullptr};
+  float m_margin{Default_Margin};
+  bool m_is_cache_enabled{false};
+
+  mutable sf::RenderTexture m_texture{};
+  mutable sf::FloatRect m_cached_area{};
+  mutable sf::Vector2f m_cached_scale{}; // Texture pixels per parent unit.
+  mutable sf::Transform m_cached_transform{};
+  mutable std::vector<sf::Transform> m_content_transforms{}; // Depth first.
+  mutable bool m_is_valid{false};
+  mutable std::array<sf::Vertex, 4> m_quad{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
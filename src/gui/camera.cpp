@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "camera.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+void Camera::setArea(
+    sf::FloatRect const& area, sf::Vector2f view_size) noexcept
+{
+  m_area = area;
+  m_max_zoom = 1.f;
+  if (view_size.x > 0.f && view_size.y > 0.f)
+  {
+    m_max_zoom = std::max(
+        {1.f, area.width / view_size.x, area.height / view_size.y});
+  }
+  setZoom(m_zoom);
+}
+
+void Camera::setZoom(float zoom) noexcept
+{
+  m_zoom = std::clamp(zoom, Min_Zoom, m_max_zoom);
+}
+
+void Camera::zoomBy(float wheel_delta) noexcept
+{
+  setZoom(m_zoom * std::pow(Wheel_Zoom_Factor, -wheel_delta));
+}
+
+float Camera::getZoom() const noexcept
+{
+  return m_zoom;
+}
+
+float Camera::getMaxZoom() const noexcept
+{
+  return m_max_zoom;
+}
+
+sf::View Camera::getView(sf::View const& followed) const
+{
+  sf::View view{followed};
+  view.setSize(followed.getSize() * m_zoom);
+  if (m_zoom > 1.f && m_max_zoom > 1.f)
+  {
+    float const progress = (m_zoom - 1.f) / (m_max_zoom - 1.f);
+    sf::Vector2f const area_center{
+        m_area.left + m_area.width / 2.f,
+        m_area.top + m_area.height / 2.f};
+    view.setCenter(
+        followed.getCenter() +
+        (area_center - followed.getCenter()) * progress);
+  }
+  return view;
+}
+
+sf::FloatRect Camera::getViewBounds(sf::View const& followed) const
+{
+  sf::View const view = getView(followed);
+  return sf::FloatRect{
+      view.getCenter() - view.getSize() / 2.f, view.getSize()};
+}
+} // namespace FastSimDesign
\ No newline at end of file
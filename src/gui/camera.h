@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_CAMERA_H
+#define FAST_SIM_DESIGN_CAMERA_H
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/Vector2.hpp>
+
+namespace FastSimDesign {
+/// Zoom of the view the world is drawn with, around the view followed by the
+/// simulation, which keeps its own size.
+///
+/// A zoom above one shows more of the world. Zooming out also slides the
+/// camera towards the center of its area, so that the whole area is visible
+/// at the maximum zoom.
+class Camera final
+{
+public:
+  static constexpr float Min_Zoom = 0.5f;
+  static constexpr float Wheel_Zoom_Factor = 1.25f; // Per notch.
+
+public:
+  explicit Camera() = default;
+  Camera(Camera const&) = default;
+  Camera(Camera&&) = default;
+  Camera& operator=(Camera const&) = default;
+  Camera& operator=(Camera&&) = default;
+  virtual ~Camera() = default;
+
+  // Area visible at the maximum zoom, through followed views of `view_size`.
+  void setArea(sf::FloatRect const& area, sf::Vector2f view_size) noexcept;
+  // Clamped to [Min_Zoom, getMaxZoom()].
+  void setZoom(float zoom) noexcept;
+  // Zoom in for a positive `delta` of the mouse wheel, out otherwise.
+  void zoomBy(float wheel_delta) noexcept;
+  float getZoom() const noexcept;
+  float getMaxZoom() const noexcept;
+
+  sf::View getView(sf::View const& followed) const;
+  sf::FloatRect getViewBounds(sf::View const& followed) const;
+
+private:
+  sf::FloatRect m_area{};
+  float m_zoom{1.f};
+  float m_max_zoom{1.f};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
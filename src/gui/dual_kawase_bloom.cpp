@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "dual_kawase_bloom.h"
+
+#include "render_target_pool.h"
+
+#include <SFML/Graphics/Shader.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+DualKawaseBloom::Settings DualKawaseBloom::getPreset(
+    Configuration::BloomQuality quality) noexcept
+{
+  switch (quality)
+  {
+    case Configuration::BloomQuality::LOW:
+      return Settings{3, 0.25f, 1.f};
+    case Configuration::BloomQuality::HIGH:
+      return Settings{5, 1.f, 1.f};
+    case Configuration::BloomQuality::MEDIUM:
+    default:
+      return Settings{};
+  }
+}
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+DualKawaseBloom::DualKawaseBloom(Settings const& settings)
+  : Parent{}
+{
+  setSettings(settings);
+  m_shaders.load(
+      Shaders::ID::BRIGHTNESS_PASS,
+      "../assets/shaders/fullpass.vert",
+      "../assets/shaders/brightness.frag");
+  m_shaders.load(
+      Shaders::ID::KAWASE_DOWN_PASS,
+      "../assets/shaders/fullpass.vert",
+      "../assets/shaders/kawase_down.frag");
+  m_shaders.load(
+      Shaders::ID::KAWASE_UP_PASS,
+      "../assets/shaders/fullpass.vert",
+      "../assets/shaders/kawase_up.frag");
+  m_shaders.load(
+      Shaders::ID::ADD_PASS,
+      "../assets/shaders/fullpass.vert",
+      "../assets/shaders/add.frag");
+}
+
+void DualKawaseBloom::apply(
+    sf::RenderTexture const& input,
+    sf::RenderTarget& output,
+    RenderTargetPool& targets)
+{
+  auto scale = [this](unsigned length) {
+    float const scaled =
+        std::round(static_cast<float>(length) * m_settings.render_scale);
+    return std::max(1u, static_cast<unsigned>(scaled));
+  };
+
+  // Each mip is half the size of the previous one.
+  std::size_t const mip_count = m_settings.mip_count;
+  std::array<RenderTargetPool::Lease, Max_Mip_Count> mips{};
+  sf::Vector2u mip_size{scale(input.getSize().x), scale(input.getSize().y)};
+  for (std::size_t i = 0; i < mip_count; ++i)
+  {
+    mips[i] = targets.acquire(mip_size);
+    mip_size.x = std::max(1u, mip_size.x / 2);
+    mip_size.y = std::max(1u, mip_size.y / 2);
+  }
+
+  filterBright(input, *mips[0]);
+  for (std::size_t i = 1; i < mip_count; ++i)
+    resample(Shaders::ID::KAWASE_DOWN_PASS, *mips[i - 1], *mips[i]);
+  // Downsampled mips are not read again, each one is overwritten by the
+  // upsampling of the next one.
+  for (std::size_t i = mip_count - 1; i > 0; --i)
+    resample(Shaders::ID::KAWASE_UP_PASS, *mips[i], *mips[i - 1]);
+
+  add(input, *mips[0], output);
+}
+
+void DualKawaseBloom::setSettings(Settings const& settings) noexcept
+{
+  m_settings = settings;
+  m_settings.mip_count = std::clamp<std::size_t>(
+      m_settings.mip_count, 2, Max_Mip_Count);
+  m_settings.render_scale = std::clamp(m_settings.render_scale, 0.05f, 1.f);
+}
+
+DualKawaseBloom::Settings const& DualKawaseBloom::getSettings()
+    const noexcept
+{
+  return m_settings;
+}
+
+void DualKawaseBloom::filterBright(
+    sf::RenderTexture const& input, sf::RenderTexture& output)
+{
+  sf::Shader& brightness = m_shaders.get(Shaders::ID::BRIGHTNESS_PASS);
+  brightness.setUniform("source", input.getTexture());
+  applyShader(brightness, output);
+  output.display();
+}
+
+void DualKawaseBloom::resample(
+    Shaders::ID shader_id,
+    sf::RenderTexture const& input,
+    sf::RenderTexture& output)
+{
+  sf::Vector2f const input_size{input.getSize()};
+  sf::Shader& resampler = m_shaders.get(shader_id);
+  resampler.setUniform("source", input.getTexture());
+  resampler.setUniform(
+      "halfPixel", sf::Vector2f{0.5f / input_size.x, 0.5f / input_size.y});
+  resampler.setUniform("offset", m_settings.offset);
+  applyShader(resampler, output);
+  output.display();
+}
+
+void DualKawaseBloom::add(
+    sf::RenderTexture const& source,
+    sf::RenderTexture const& bloom,
+    sf::RenderTarget& target)
+{
+  sf::Shader& adder = m_shaders.get(Shaders::ID::ADD_PASS);
+  adder.setUniform("source", source.getTexture());
+  adder.setUniform("bloom", bloom.getTexture());
+  applyShader(adder, target);
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,78 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_DUAL_KAWASE_BLOOM_H
+#define FAST_SIM_DESIGN_DUAL_KAWASE_BLOOM_H
+
+#include "../core/configuration.h"
+#include "../core/resource_identifiers.h"
+#include "post_effect.h"
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+
+namespace FastSimDesign {
+/// Bloom blurred by a dual filter (Kawase) chain: the bright parts are
+/// downsampled mip after mip, then upsampled back to the first mip, and added
+/// to the input.
+///
+/// With n mips it costs 2n passes, all but the last one at the internal
+/// render scale or below.
+class DualKawaseBloom final : public PostEffect
+{
+private:
+  using Parent = PostEffect;
+
+public:
+  static constexpr std::size_t Max_Mip_Count = 8;
+
+  struct Settings
+  {
+    std::size_t mip_count{4}; // From 2 to Max_Mip_Count.
+    float render_scale{0.5f}; // Size of the first mip relative to the input.
+    float offset{1.f}; // Spread of the taps, in half texels.
+  };
+
+public:
+  // Settings of a dual filter preset, CLASSIC has the default ones.
+  static Settings getPreset(Configuration::BloomQuality quality) noexcept;
+
+public:
+  explicit DualKawaseBloom(Settings const& settings);
+  virtual ~DualKawaseBloom() = default;
+
+  virtual void apply(
+      sf::RenderTexture const& input,
+      sf::RenderTarget& output,
+      RenderTargetPool& targets) override;
+  void setSettings(Settings const& settings) noexcept;
+  Settings const& getSettings() const noexcept;
+
+private:
+  void filterBright(sf::RenderTexture const& input, sf::RenderTexture& output);
+  void resample(
+      Shaders::ID shader_id,
+      sf::RenderTexture const& input,
+      sf::RenderTexture& output);
+  void add(
+      sf::RenderTexture const& source,
+      sf::RenderTexture const& bloom,
+      sf::RenderTarget& target);
+
+private:
+  ShaderHolder m_shaders{};
+  Settings m_settings{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,424 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "frame_capture.h"
+
+#include "../core/log.h"
+#include "../core/resource_exception.h"
+
+#include <zlib.h>
+
+#include <SFML/OpenGL.hpp>
+#include <SFML/Window/Context.hpp>
+#include <SFML/Window/Window.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+
+namespace FastSimDesign {
+namespace {
+constexpr std::size_t Frame_Index_Digits = 6;
+// Leads the raw frames, followed by the width and height in little endian.
+constexpr std::array<char, 4> Raw_Magic{'F', 'S', 'D', 'R'};
+
+// Of OpenGL 2.1, missing from the OpenGL 1.1 headers of some platforms.
+constexpr GLenum Gl_Pixel_Pack_Buffer = 0x88EB;
+constexpr GLenum Gl_Pixel_Pack_Buffer_Binding = 0x88ED;
+constexpr GLenum Gl_Stream_Read = 0x88E1;
+constexpr GLenum Gl_Read_Only = 0x88B8;
+
+// Entry points of OpenGL used for the readback, loaded through SFML so that
+// the build does not link OpenGL itself.
+struct GlFunctions
+{
+  using GenBuffers = void(APIENTRY*)(GLsizei, GLuint*);
+  using DeleteBuffers = void(APIENTRY*)(GLsizei, GLuint const*);
+  using BindBuffer = void(APIENTRY*)(GLenum, GLuint);
+  using BufferData =
+      void(APIENTRY*)(GLenum, std::ptrdiff_t, void const*, GLenum);
+  using MapBuffer = void*(APIENTRY*)(GLenum, GLenum);
+  using UnmapBuffer = GLboolean(APIENTRY*)(GLenum);
+  using BindTexture = void(APIENTRY*)(GLenum, GLuint);
+  using GetIntegerv = void(APIENTRY*)(GLenum, GLint*);
+  using GetTexLevelParameteriv = void(APIENTRY*)(GLenum, GLint, GLenum, GLint*);
+  using GetTexImage = void(APIENTRY*)(GLenum, GLint, GLenum, GLenum, void*);
+
+  GenBuffers gen_buffers{nullptr};
+  DeleteBuffers delete_buffers{nullptr};
+  BindBuffer bind_buffer{nullptr};
+  BufferData buffer_data{nullptr};
+  MapBuffer map_buffer{nullptr};
+  UnmapBuffer unmap_buffer{nullptr};
+  BindTexture bind_texture{nullptr};
+  GetIntegerv get_integerv{nullptr};
+  GetTexLevelParameteriv get_tex_level_parameteriv{nullptr};
+  GetTexImage get_tex_image{nullptr};
+
+  bool isComplete() const noexcept
+  {
+    return gen_buffers && delete_buffers && bind_buffer && buffer_data &&
+           map_buffer && unmap_buffer && bind_texture && get_integerv &&
+           get_tex_level_parameteriv && get_tex_image;
+  }
+};
+
+template<typename Function>
+void loadFunction(Function& function, char const* name)
+{
+  function = reinterpret_cast<Function>(sf::Context::getFunction(name));
+}
+
+// Loaded once, from the first context asking for them. Null when pixel
+// buffer objects are not supported, e.g. on OpenGL ES.
+GlFunctions const* getGlFunctions()
+{
+  static std::optional<GlFunctions> const functions = []() {
+    GlFunctions loaded{};
+    loadFunction(loaded.gen_buffers, "glGenBuffers");
+    loadFunction(loaded.delete_buffers, "glDeleteBuffers");
+    loadFunction(loaded.bind_buffer, "glBindBuffer");
+    loadFunction(loaded.buffer_data, "glBufferData");
+    loadFunction(loaded.map_buffer, "glMapBuffer");
+    loadFunction(loaded.unmap_buffer, "glUnmapBuffer");
+    loadFunction(loaded.bind_texture, "glBindTexture");
+    loadFunction(loaded.get_integerv, "glGetIntegerv");
+    loadFunction(
+        loaded.get_tex_level_parameteriv, "glGetTexLevelParameteriv");
+    loadFunction(loaded.get_tex_image, "glGetTexImage");
+    return loaded.isComplete() ? std::optional<GlFunctions>{loaded}
+                               : std::nullopt;
+  }();
+  return functions ? &*functions : nullptr;
+}
+
+// Raw OpenGL calls need an active context, SFML only activates one for its
+// own calls.
+class ContextGuard final
+{
+public:
+  explicit ContextGuard()
+  {
+    if (!sf::Context::getActiveContext())
+      m_context.emplace();
+  }
+
+private:
+  std::optional<sf::Context> m_context{};
+};
+
+void writeUint32(std::ofstream& stream, std::uint32_t value)
+{
+  std::array<char, 4> const bytes{
+      static_cast<char>(value & 0xFF),
+      static_cast<char>((value >> 8) & 0xFF),
+      static_cast<char>((value >> 16) & 0xFF),
+      static_cast<char>((value >> 24) & 0xFF)};
+  stream.write(bytes.data(), bytes.size());
+}
+
+bool writeRawZlib(
+    sf::Image const& image,
+    std::filesystem::path const& path,
+    int compression_level)
+{
+  sf::Vector2u const size = image.getSize();
+  uLong const source_size = static_cast<uLong>(size.x) * size.y * 4;
+  uLongf compressed_size = compressBound(source_size);
+  std::vector<Bytef> compressed(compressed_size);
+  if (compress2(
+          compressed.data(),
+          &compressed_size,
+          image.getPixelsPtr(),
+          source_size,
+          compression_level) != Z_OK)
+  {
+    return false;
+  }
+
+  std::ofstream stream{path, std::ios::binary | std::ios::trunc};
+  stream.write(Raw_Magic.data(), Raw_Magic.size());
+  writeUint32(stream, size.x);
+  writeUint32(stream, size.y);
+  stream.write(
+      reinterpret_cast<char const*>(compressed.data()),
+      static_cast<std::streamsize>(compressed_size));
+  return static_cast<bool>(stream);
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+FrameCapture::FrameCapture(FrameCaptureSettings settings)
+  : m_settings{std::move(settings)}
+  , m_slots(std::max<std::size_t>(m_settings.readback_delay, 1))
+  , m_encoders{std::max<std::size_t>(m_settings.encoder_count, 1)}
+{
+  m_settings.max_queued_frames =
+      std::max<std::size_t>(m_settings.max_queued_frames, 1);
+
+  std::error_code error{};
+  std::filesystem::create_directories(m_settings.directory, error);
+  if (error)
+  {
+    throw ResourceException{
+        "Failed to create the capture directory " +
+        m_settings.directory.string()};
+  }
+}
+
+FrameCapture::~FrameCapture()
+{
+  flush();
+  if (GlFunctions const* gl = getGlFunctions())
+  {
+    ContextGuard const context{};
+    for (Slot const& slot : m_slots)
+    {
+      if (slot.pixel_buffer != 0)
+        gl->delete_buffers(1, &slot.pixel_buffer);
+    }
+  }
+
+  Statistics const statistics = getStatistics();
+  LOG_INFO(
+      "Frame capture ended: {} frames written, {} dropped, {} failed.",
+      statistics.written_count,
+      statistics.dropped_count,
+      statistics.failed_count);
+}
+
+void FrameCapture::capture(sf::Texture const& frame)
+{
+  Slot& slot = nextSlot(frame.getSize());
+  slot.texture.update(frame);
+  startReadBack(slot);
+}
+
+void FrameCapture::capture(sf::Window const& window)
+{
+  Slot& slot = nextSlot(window.getSize());
+  slot.texture.update(window);
+  startReadBack(slot);
+}
+
+void FrameCapture::capture(sf::Image frame)
+{
+  std::size_t const frame_index = m_next_frame++;
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    ++m_statistics.captured_count;
+  }
+  enqueue(std::make_shared<sf::Image>(std::move(frame)), frame_index);
+}
+
+void FrameCapture::flush()
+{
+  // Oldest frames first, to keep the files in order of completion.
+  for (std::size_t i = 0; i < m_slots.size(); ++i)
+  {
+    Slot& slot = m_slots[(m_next_frame + i) % m_slots.size()];
+    if (slot.is_pending)
+      readBack(slot);
+  }
+  m_encoders.wait(m_tasks);
+}
+
+FrameCapture::Statistics FrameCapture::getStatistics() const
+{
+  std::lock_guard<std::mutex> lock{m_mutex};
+  return m_statistics;
+}
+
+FrameCapture::Slot& FrameCapture::nextSlot(sf::Vector2u size)
+{
+  // The slot of this frame holds the one captured readback_delay frames ago.
+  Slot& slot = m_slots[m_next_frame % m_slots.size()];
+  if (slot.is_pending)
+    readBack(slot);
+
+  if (slot.texture.getSize() != size &&
+      !slot.texture.create(size.x, size.y))
+    throw ResourceException{"Failed to create a frame capture texture"};
+  slot.frame_index = m_next_frame++;
+  slot.is_pending = true;
+
+  std::lock_guard<std::mutex> lock{m_mutex};
+  ++m_statistics.captured_count;
+  return slot;
+}
+
+void FrameCapture::startReadBack(Slot& slot)
+{
+  GlFunctions const* gl = getGlFunctions();
+  if (!gl)
+    return;
+
+  // Bindings are restored, SFML caches them.
+  ContextGuard const context{};
+  GLint previous_buffer = 0;
+  GLint previous_texture = 0;
+  gl->get_integerv(Gl_Pixel_Pack_Buffer_Binding, &previous_buffer);
+  gl->get_integerv(GL_TEXTURE_BINDING_2D, &previous_texture);
+
+  // The texture may be allocated larger than the frame.
+  gl->bind_texture(GL_TEXTURE_2D, slot.texture.getNativeHandle());
+  GLint width = 0;
+  GLint height = 0;
+  gl->get_tex_level_parameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_WIDTH, &width);
+  gl->get_tex_level_parameteriv(GL_TEXTURE_2D, 0, GL_TEXTURE_HEIGHT, &height);
+  sf::Vector2u const buffer_size{
+      static_cast<unsigned>(width), static_cast<unsigned>(height)};
+
+  if (slot.pixel_buffer == 0)
+    gl->gen_buffers(1, &slot.pixel_buffer);
+  gl->bind_buffer(Gl_Pixel_Pack_Buffer, slot.pixel_buffer);
+  if (slot.buffer_size != buffer_size)
+  {
+    gl->buffer_data(
+        Gl_Pixel_Pack_Buffer,
+        static_cast<std::ptrdiff_t>(buffer_size.x) * buffer_size.y * 4,
+        nullptr,
+        Gl_Stream_Read);
+    slot.buffer_size = buffer_size;
+  }
+  // With a pack buffer bound, the pixels are written at offset zero of it
+  // without waiting for the GPU.
+  gl->get_tex_image(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+  gl->bind_buffer(Gl_Pixel_Pack_Buffer, static_cast<GLuint>(previous_buffer));
+  gl->bind_texture(GL_TEXTURE_2D, static_cast<GLuint>(previous_texture));
+}
+
+void FrameCapture::readBack(Slot& slot)
+{
+  slot.is_pending = false;
+  GlFunctions const* gl = getGlFunctions();
+  if (!gl || slot.pixel_buffer == 0)
+  {
+    enqueue(
+        std::make_shared<sf::Image>(slot.texture.copyToImage()),
+        slot.frame_index);
+    return;
+  }
+
+  ContextGuard const context{};
+  GLint previous_buffer = 0;
+  gl->get_integerv(Gl_Pixel_Pack_Buffer_Binding, &previous_buffer);
+  gl->bind_buffer(Gl_Pixel_Pack_Buffer, slot.pixel_buffer);
+  auto const* pixels = static_cast<std::uint8_t const*>(
+      gl->map_buffer(Gl_Pixel_Pack_Buffer, Gl_Read_Only));
+
+  // Keep the frame rows of the allocated texture, compacted first when it is
+  // wider than the frame.
+  std::shared_ptr<sf::Image> image{};
+  if (pixels)
+  {
+    sf::Vector2u const size = slot.texture.getSize();
+    std::size_t const row_size = static_cast<std::size_t>(size.x) * 4;
+    std::size_t const stride =
+        static_cast<std::size_t>(slot.buffer_size.x) * 4;
+    std::vector<std::uint8_t> rows{};
+    if (stride != row_size)
+    {
+      rows.resize(row_size * size.y);
+      for (unsigned y = 0; y < size.y; ++y)
+        std::memcpy(rows.data() + y * row_size, pixels + y * stride, row_size);
+    }
+
+    image = std::make_shared<sf::Image>();
+    image->create(size.x, size.y, rows.empty() ? pixels : rows.data());
+    gl->unmap_buffer(Gl_Pixel_Pack_Buffer);
+  }
+  gl->bind_buffer(Gl_Pixel_Pack_Buffer, static_cast<GLuint>(previous_buffer));
+
+  if (!image)
+  {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    ++m_statistics.failed_count;
+    return;
+  }
+  enqueue(std::move(image), slot.frame_index);
+}
+
+void FrameCapture::enqueue(
+    std::shared_ptr<sf::Image> image, std::size_t frame_index)
+{
+  {
+    std::unique_lock<std::mutex> lock{m_mutex};
+    if (m_queued_count >= m_settings.max_queued_frames)
+    {
+      if (m_settings.overflow == FrameCaptureSettings::Overflow::DROP)
+      {
+        ++m_statistics.dropped_count;
+        return;
+      }
+      m_frame_written.wait(lock, [this]() {
+        return m_queued_count < m_settings.max_queued_frames;
+      });
+    }
+    ++m_queued_count;
+  }
+
+  m_encoders.submit(m_tasks, [this, image, frame_index]() {
+    bool const is_written = encode(*image, frame_index);
+    {
+      std::lock_guard<std::mutex> lock{m_mutex};
+      --m_queued_count;
+      if (is_written)
+        ++m_statistics.written_count;
+      else
+        ++m_statistics.failed_count;
+    }
+    m_frame_written.notify_one();
+  });
+}
+
+bool FrameCapture::encode(
+    sf::Image const& image, std::size_t frame_index) const
+{
+  std::filesystem::path const path = getFramePath(frame_index);
+  bool is_written = false;
+  switch (m_settings.format)
+  {
+    case FrameCaptureSettings::Format::RAW_ZLIB:
+      is_written =
+          writeRawZlib(image, path, m_settings.compression_level);
+      break;
+    case FrameCaptureSettings::Format::PNG:
+    default:
+      is_written = image.saveToFile(path.string());
+      break;
+  }
+  if (!is_written)
+    LOG_WARN("Captured frame {} could not be written.", path.string());
+  return is_written;
+}
+
+std::filesystem::path FrameCapture::getFramePath(
+    std::size_t frame_index) const
+{
+  std::string name = std::to_string(frame_index);
+  if (name.size() < Frame_Index_Digits)
+    name.insert(0, Frame_Index_Digits - name.size(), '0');
+  name.insert(0, "frame_");
+  name += m_settings.format == FrameCaptureSettings::Format::RAW_ZLIB
+              ? ".rgba.z"
+              : ".png";
+  return m_settings.directory / name;
+}
+} // namespace FastSimDesign
\ No newline at end of file
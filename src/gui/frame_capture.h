@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_FRAME_CAPTURE_H
+#define FAST_SIM_DESIGN_FRAME_CAPTURE_H
+
+#include "../core/worker_pool.h"
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace sf {
+class Window;
+} // namespace sf
+
+namespace FastSimDesign {
+/// Settings of a frame capture.
+struct FrameCaptureSettings
+{
+  enum class Format : uint16_t
+  {
+    PNG,
+    // Header of the size then zlib compressed RGBA rows, much faster to
+    // encode than PNG.
+    RAW_ZLIB,
+    FORMAT_COUNT,
+  };
+
+  // What happens to a frame read back while the encoding queue is full.
+  enum class Overflow : uint16_t
+  {
+    DROP, // The frame is skipped, the simulation is never slowed down.
+    BLOCK, // The simulation waits for an encoder, no frame is lost.
+    OVERFLOW_COUNT,
+  };
+
+  std::filesystem::path directory{"captures"};
+  Format format{Format::PNG};
+  Overflow overflow{Overflow::DROP};
+  std::size_t readback_delay{3}; // In frames, at least one.
+  std::size_t max_queued_frames{8}; // Read back and not yet written.
+  std::size_t encoder_count{2};
+  int compression_level{1}; // Of zlib, from 1 (fastest) to 9.
+};
+
+/// Records a sequence of frames to numbered files, off the simulation thread.
+///
+/// Each captured frame is copied on the GPU into a ring of textures, whose
+/// pixels are transferred asynchronously into pixel buffer objects. A buffer
+/// is mapped readback_delay frames later, once the GPU is done with it, so
+/// that neither the transfer nor the mapping stalls the frame. Without pixel
+/// buffer objects, the textures are read back when mapped. The images are then
+/// encoded and written by a dedicated pool of encoder threads, through a
+/// queue bounded by max_queued_frames. Frames already in memory, such as
+/// those of the software render target, are queued right away.
+class FrameCapture final : private sf::NonCopyable
+{
+public:
+  struct Statistics
+  {
+    std::size_t captured_count{0};
+    std::size_t written_count{0};
+    std::size_t dropped_count{0};
+    std::size_t failed_count{0};
+  };
+
+public:
+  explicit FrameCapture(FrameCaptureSettings settings);
+  // Write the frames still in flight.
+  virtual ~FrameCapture();
+
+  // Capture `frame`, the texture of a render texture already displayed.
+  void capture(sf::Texture const& frame);
+  // Capture the content of `window` drawn so far, before it is displayed.
+  void capture(sf::Window const& window);
+  // Capture `frame`, already in memory, which is queued without readback.
+  void capture(sf::Image frame);
+  // Read back the delayed frames and wait for all of them to be written.
+  void flush();
+  Statistics getStatistics() const;
+
+private:
+  struct Slot
+  {
+    sf::Texture texture{};
+    // OpenGL pixel buffer the texture is transferred to, zero without pixel
+    // buffer objects.
+    unsigned pixel_buffer{0};
+    sf::Vector2u buffer_size{}; // In pixels, of the texture as allocated.
+    std::size_t frame_index{0};
+    bool is_pending{false}; // Holds a frame not read back yet.
+  };
+
+private:
+  Slot& nextSlot(sf::Vector2u size);
+  // Start the transfer of the texture of `slot` into its pixel buffer.
+  void startReadBack(Slot& slot);
+  void readBack(Slot& slot);
+  void enqueue(std::shared_ptr<sf::Image> image, std::size_t frame_index);
+  bool encode(sf::Image const& image, std::size_t frame_index) const;
+  std::filesystem::path getFramePath(std::size_t frame_index) const;
+
+private:
+  FrameCaptureSettings m_settings;
+  std::vector<Slot> m_slots{};
+  std::size_t m_next_frame{0};
+
+  WorkerPool m_encoders;
+  TaskGroup m_tasks{};
+  mutable std::mutex m_mutex{};
+  std::condition_variable m_frame_written{};
+  std::size_t m_queued_count{0}; // Guarded by m_mutex.
+  Statistics m_statistics{}; // Guarded by m_mutex.
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
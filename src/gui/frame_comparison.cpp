@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "frame_comparison.h"
+
+#include "../core/resource_exception.h"
+
+#include <SFML/Graphics/Color.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+
+namespace FastSimDesign {
+FrameDifference compareFrames(
+    sf::Image const& actual,
+    sf::Image const& expected,
+    unsigned tolerance,
+    sf::Image* difference)
+{
+  sf::Vector2u const size = expected.getSize();
+  FrameDifference result{};
+  result.pixel_count = static_cast<std::size_t>(size.x) * size.y;
+  if (actual.getSize() != size)
+  {
+    result.different_pixel_count = result.pixel_count;
+    result.max_channel_difference = 255;
+    if (difference)
+      difference->create(size.x, size.y, sf::Color::Red);
+    return result;
+  }
+
+  if (difference)
+    difference->create(size.x, size.y);
+  std::uint8_t const* actual_pixels = actual.getPixelsPtr();
+  std::uint8_t const* expected_pixels = expected.getPixelsPtr();
+  for (std::size_t i = 0; i < result.pixel_count; ++i)
+  {
+    unsigned pixel_difference = 0;
+    for (std::size_t channel = 0; channel < 4; ++channel)
+    {
+      int const delta = static_cast<int>(actual_pixels[i * 4 + channel]) -
+                        static_cast<int>(expected_pixels[i * 4 + channel]);
+      pixel_difference =
+          std::max(pixel_difference, static_cast<unsigned>(std::abs(delta)));
+    }
+    result.max_channel_difference =
+        std::max(result.max_channel_difference, pixel_difference);
+    bool const is_different = pixel_difference > tolerance;
+    if (is_different)
+      ++result.different_pixel_count;
+
+    if (difference)
+    {
+      unsigned const x = static_cast<unsigned>(i % size.x);
+      unsigned const y = static_cast<unsigned>(i / size.x);
+      std::uint8_t const* pixel = expected_pixels + i * 4;
+      sf::Color const dimmed{
+          static_cast<std::uint8_t>(pixel[0] / 4),
+          static_cast<std::uint8_t>(pixel[1] / 4),
+          static_cast<std::uint8_t>(pixel[2] / 4)};
+      difference->setPixel(x, y, is_different ? sf::Color::Red : dimmed);
+    }
+  }
+  return result;
+}
+
+FrameDifference compareToGoldenFrame(
+    sf::Image const& actual,
+    std::filesystem::path const& path,
+    GoldenFrameMode mode,
+    unsigned tolerance)
+{
+  if (mode == GoldenFrameMode::RECORD)
+  {
+    if (!actual.saveToFile(path.string()))
+    {
+      throw ResourceException{
+          "Failed to save the golden frame " + path.string()};
+    }
+    FrameDifference result{};
+    result.pixel_count =
+        static_cast<std::size_t>(actual.getSize().x) * actual.getSize().y;
+    result.is_recorded = true;
+    return result;
+  }
+
+  if (!std::filesystem::exists(path))
+  {
+    throw ResourceException{
+        "Missing golden frame " + path.string() + ", record it first"};
+  }
+
+  sf::Image expected{};
+  if (!expected.loadFromFile(path.string()))
+  {
+    throw ResourceException{
+        "Failed to load the golden frame " + path.string()};
+  }
+  return compareFrames(actual, expected, tolerance);
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_FRAME_COMPARISON_H
+#define FAST_SIM_DESIGN_FRAME_COMPARISON_H
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace FastSimDesign {
+/// Pixel comparison of rendered frames against golden frames, for visual
+/// regression checks of the software render target.
+struct FrameDifference
+{
+  std::size_t pixel_count{0};
+  // Pixels with a channel differing by more than the tolerance.
+  std::size_t different_pixel_count{0};
+  unsigned max_channel_difference{0};
+  bool is_recorded{false}; // Saved as the golden frame, not compared.
+
+  bool matches() const noexcept { return different_pixel_count == 0; }
+};
+
+// Frames of different sizes differ on every pixel. `difference`, when given,
+// receives the expected frame dimmed, with the different pixels in red.
+FrameDifference compareFrames(
+    sf::Image const& actual,
+    sf::Image const& expected,
+    unsigned tolerance = 0,
+    sf::Image* difference = nullptr);
+
+enum class GoldenFrameMode : uint16_t
+{
+  COMPARE, // A missing golden frame is an error.
+  RECORD, // The frame is saved as the golden frame, replacing it.
+  GOLDEN_FRAME_MODE_COUNT,
+};
+
+// Compare to the golden frame saved at `path`, or record `actual` in its
+// place in RECORD mode.
+FrameDifference compareToGoldenFrame(
+    sf::Image const& actual,
+    std::filesystem::path const& path,
+    GoldenFrameMode mode = GoldenFrameMode::COMPARE,
+    unsigned tolerance = 0);
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -10,6 +10,8 @@
 
 #include "label.h"
 
+#include "../core/font_holder.h"
+
 namespace FastSimDesign {
 namespace GUI {
 ////////////////////////////////////////////////////////////
@@ -20,7 +22,7 @@ namespace GUI {
 /// Methods
 ////////////////////////////////////////////////////////////
 Label::Label(std::string text, FontHolder const& fonts) noexcept
-  : m_text{std::move(text), fonts.get(Fonts::ID::MAIN), 16}
+  : m_text{std::move(text), fonts.getBitmapFont(Fonts::ID::MAIN, 16)}
 {
 }
 
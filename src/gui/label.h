@@ -13,11 +13,11 @@
 #define FAST_SIM_DESIGN_LABEL_H
 
 #include "../core/resource_identifiers.h"
+#include "bitmap_text.h"
 #include "component.h"
 
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
-#include <SFML/Graphics/Text.hpp>
 
 #include <memory>
 
@@ -44,7 +44,7 @@ private:
       sf::RenderTarget& target, sf::RenderStates states) const override;
 
 private:
-  sf::Text m_text{};
+  BitmapText m_text{};
 };
 } // namespace GUI
 } // namespace FastSimDesign
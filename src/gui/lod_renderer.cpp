@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "lod_renderer.h"
+
+#include "../core/service_registry.h"
+#include "software_render_target.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+float LodRenderer::getPixelScale(sf::RenderTarget const& target)
+{
+  sf::View const& view = target.getView();
+  float const view_height = std::abs(view.getSize().y);
+  if (view_height <= 0.f)
+    return 1.f;
+  return static_cast<float>(target.getViewport(view).height) / view_height;
+}
+
+float LodRenderer::getPixelScale(SoftwareRenderTarget const& target)
+{
+  sf::View const& view = target.getView();
+  float const view_height = std::abs(view.getSize().y);
+  if (view_height <= 0.f)
+    return 1.f;
+  float const viewport_height = std::round(
+      view.getViewport().height * static_cast<float>(target.getSize().y));
+  return viewport_height / view_height;
+}
+
+sf::Color LodRenderer::getColor(BitFlags<Category::Type> category) noexcept
+{
+  if (category.isSet(Category::Type::PLAYER_AIRCRAFT))
+    return sf::Color{80, 160, 255};
+  if (category.isSet(Category::Type::ALLIED_AIRCRAFT))
+    return sf::Color{80, 220, 120};
+  if (category.isSet(Category::Type::ENEMY_AIRCRAFT))
+    return sf::Color{240, 70, 60};
+  if (category.isSet(Category::Type::PICKUP))
+    return sf::Color{250, 250, 250};
+  if (category.isSet(Category::Type::ENEMY_PROJECTILE))
+    return sf::Color{255, 150, 40};
+  return sf::Color{255, 230, 80};
+}
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+LodRenderer::Tier LodRenderer::getTier(
+    sf::FloatRect const& bounds, float pixel_scale) const noexcept
+{
+  float const size = std::max(bounds.width, bounds.height) * pixel_scale;
+  if (size < Point_Pixel_Size)
+    return Tier::POINT;
+  if (size < Quad_Pixel_Size)
+    return Tier::QUAD;
+  return Tier::FULL;
+}
+
+void LodRenderer::append(
+    Tier tier, sf::FloatRect const& bounds, sf::Color color) const
+{
+  switch (tier)
+  {
+    case Tier::QUAD:
+    {
+      float const right = bounds.left + bounds.width;
+      float const bottom = bounds.top + bounds.height;
+      m_quads.emplace_back(sf::Vector2f{bounds.left, bounds.top}, color);
+      m_quads.emplace_back(sf::Vector2f{right, bounds.top}, color);
+      m_quads.emplace_back(sf::Vector2f{right, bottom}, color);
+      m_quads.emplace_back(sf::Vector2f{bounds.left, bottom}, color);
+      break;
+    }
+    case Tier::POINT:
+      m_points.emplace_back(
+          sf::Vector2f{
+              bounds.left + bounds.width / 2.f,
+              bounds.top + bounds.height / 2.f},
+          color);
+      break;
+    default:
+      break;
+  }
+}
+
+LodRenderer::Statistics LodRenderer::getStatistics() const noexcept
+{
+  return m_statistics;
+}
+
+void LodRenderer::onServicesBound(ServiceRegistry& services) noexcept
+{
+  services.provide<LodRenderer>(*this);
+}
+
+void LodRenderer::onServicesUnbound(ServiceRegistry& services) noexcept
+{
+  services.revoke<LodRenderer>(*this);
+}
+
+void LodRenderer::drawCurrent(
+    sf::RenderTarget& target, sf::RenderStates states) const
+{
+  m_statistics = Statistics{m_quads.size() / 4, m_points.size()};
+
+  // Vertices are already in the coordinates of the scene.
+  states.transform = sf::Transform::Identity;
+  states.texture = nullptr;
+  if (!m_quads.empty())
+    target.draw(m_quads.data(), m_quads.size(), sf::Quads, states);
+  if (!m_points.empty())
+    target.draw(m_points.data(), m_points.size(), sf::Points, states);
+  m_quads.clear();
+  m_points.clear();
+}
+
+void LodRenderer::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  m_statistics = Statistics{m_quads.size() / 4, m_points.size()};
+
+  float const half_pixel = 0.5f / getPixelScale(target);
+  for (sf::Vertex const& point : m_points)
+  {
+    sf::Vector2f const position = point.position;
+    m_quads.emplace_back(
+        position + sf::Vector2f{-half_pixel, -half_pixel}, point.color);
+    m_quads.emplace_back(
+        position + sf::Vector2f{half_pixel, -half_pixel}, point.color);
+    m_quads.emplace_back(
+        position + sf::Vector2f{half_pixel, half_pixel}, point.color);
+    m_quads.emplace_back(
+        position + sf::Vector2f{-half_pixel, half_pixel}, point.color);
+  }
+
+  // Vertices are already in the coordinates of the scene.
+  states.transform = sf::Transform::Identity;
+  if (!m_quads.empty())
+    target.draw(m_quads.data(), m_quads.size(), sf::Quads, states);
+  m_quads.clear();
+  m_points.clear();
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_LOD_RENDERER_H
+#define FAST_SIM_DESIGN_LOD_RENDERER_H
+
+#include "../entity/category.h"
+#include "../utils/bit_flags.h"
+#include "scene_node.h"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sf {
+class RenderTarget;
+}
+
+namespace FastSimDesign {
+class SoftwareRenderTarget;
+/// Draws the entities too small on screen to be worth their sprite, as
+/// single color quads, or as points under a few pixels, in one batch.
+///
+/// Entities find it in the services, select their tier from their size on
+/// screen and append their marker instead of drawing their sprite. The
+/// batch is drawn, then emptied, when the renderer itself is drawn, so it
+/// must be attached after them in drawing order.
+class LodRenderer final : public SceneNode
+{
+private:
+  using Parent = SceneNode;
+
+public:
+  enum class Tier : uint16_t
+  {
+    FULL,
+    QUAD,
+    POINT,
+    TIER_COUNT,
+  };
+
+  // Largest side on screen, in pixels, under which an entity is drawn as a
+  // quad, then as a point.
+  static constexpr float Quad_Pixel_Size = 12.f;
+  static constexpr float Point_Pixel_Size = 3.f;
+
+  struct Statistics
+  {
+    std::size_t quad_count{0};
+    std::size_t point_count{0};
+  };
+
+public:
+  explicit LodRenderer() = default;
+  virtual ~LodRenderer() = default;
+
+  // Pixels per unit of the scene on `target`, through its current view.
+  static float getPixelScale(sf::RenderTarget const& target);
+  static float getPixelScale(SoftwareRenderTarget const& target);
+  static sf::Color getColor(BitFlags<Category::Type> category) noexcept;
+
+  // `bounds` in the coordinates of the scene.
+  Tier getTier(sf::FloatRect const& bounds, float pixel_scale) const noexcept;
+  void append(Tier tier, sf::FloatRect const& bounds, sf::Color color) const;
+  // Markers drawn in the last frame.
+  Statistics getStatistics() const noexcept;
+
+private:
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept override;
+  virtual void drawCurrent(
+      sf::RenderTarget& target, sf::RenderStates states) const override;
+  // Points are drawn as quads of one pixel, the software target ignoring
+  // points.
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
+
+private:
+  // Vertices are kept allocated from one frame to the next.
+  mutable std::vector<sf::Vertex> m_quads{};
+  mutable std::vector<sf::Vertex> m_points{};
+  mutable Statistics m_statistics{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
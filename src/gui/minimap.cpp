@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "minimap.h"
+
+#include "../core/resource_exception.h"
+#include "../entity/aircraft.h"
+#include "../entity/projectile.h"
+#include "../utils/generic_utility.h"
+#include "lod_renderer.h"
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace FastSimDesign {
+namespace {
+// Same colors as the levels of detail of the world.
+sf::Color getColor(Category::Type category) noexcept
+{
+  return LodRenderer::getColor(BitFlags<Category::Type>{category});
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+Minimap::Minimap(sf::FloatRect const& area, float refresh_rate)
+  : m_area{area}
+  , m_refresh_period{sf::seconds(1.f / std::max(refresh_rate, 0.1f))}
+  , m_elapsed{m_refresh_period}
+{
+  // The largest side of the area spans Max_Size pixels.
+  float const scale =
+      static_cast<float>(Max_Size) / std::max({area.width, area.height, 1.f});
+  sf::Vector2u const size{
+      std::max(1u, static_cast<unsigned>(std::round(area.width * scale))),
+      std::max(1u, static_cast<unsigned>(std::round(area.height * scale)))};
+  m_scale = sf::Vector2f{
+      static_cast<float>(size.x) / area.width,
+      static_cast<float>(size.y) / area.height};
+
+  if (!m_texture.create(size.x, size.y) ||
+      !m_static_layers.create(size.x * 2, size.y * 2))
+    throw ResourceException{"Failed to create the minimap textures"};
+  m_static_layers.setSmooth(true);
+}
+
+void Minimap::invalidate() noexcept
+{
+  m_needs_static_layers = true;
+}
+
+void Minimap::update(
+    sf::Time const& dt,
+    SceneNode const& static_layers,
+    ECS::Registry& registry,
+    sf::FloatRect const& view)
+{
+  m_elapsed += dt;
+  if (m_elapsed < m_refresh_period)
+    return;
+  m_elapsed = sf::Time::Zero;
+
+  if (m_needs_static_layers)
+  {
+    renderStaticLayers(static_layers);
+    m_needs_static_layers = false;
+  }
+
+  m_dots.clear();
+  m_outline.clear();
+  appendAgents(registry);
+  appendOutline(view);
+
+  // Static image scaled down by half, then the dots and the view outline,
+  // all in minimap pixels.
+  m_texture.setView(m_texture.getDefaultView());
+  m_texture.clear();
+  sf::Sprite background{m_static_layers.getTexture()};
+  background.setScale(0.5f, 0.5f);
+  m_texture.draw(background);
+  if (!m_dots.empty())
+    m_texture.draw(m_dots.data(), m_dots.size(), sf::Quads);
+  m_texture.draw(m_outline.data(), m_outline.size(), sf::LineStrip);
+  m_texture.display();
+}
+
+sf::RenderTexture const& Minimap::getTexture() const noexcept
+{
+  return m_texture;
+}
+
+void Minimap::renderStaticLayers(SceneNode const& static_layers)
+{
+  m_static_layers.setView(sf::View{m_area});
+  m_static_layers.clear();
+  m_static_layers.draw(static_layers);
+  m_static_layers.display();
+}
+
+void Minimap::appendAgents(ECS::Registry& registry)
+{
+  sf::Color const allied_color = getColor(Category::Type::ALLIED_AIRCRAFT);
+  sf::Color const enemy_color = getColor(Category::Type::ENEMY_AIRCRAFT);
+  registry.query<ECS::Position, ECS::AircraftInfo>()
+      .eachChunk<ECS::Position, ECS::AircraftInfo>(
+          [&](std::size_t count,
+              ECS::Position* positions,
+              ECS::AircraftInfo* infos) {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+              bool const is_allied =
+                  infos[i].type == toUnderlyingType(Aircraft::Type::EAGLE);
+              appendDot(
+                  positions[i].x,
+                  positions[i].y,
+                  is_allied ? allied_color : enemy_color);
+            }
+          });
+
+  sf::Color const allied_projectile_color =
+      getColor(Category::Type::ALLIED_PROJECTILE);
+  sf::Color const enemy_projectile_color =
+      getColor(Category::Type::ENEMY_PROJECTILE);
+  registry.query<ECS::Position, ECS::ProjectileInfo>()
+      .eachChunk<ECS::Position, ECS::ProjectileInfo>(
+          [&](std::size_t count,
+              ECS::Position* positions,
+              ECS::ProjectileInfo* infos) {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+              bool const is_enemy =
+                  infos[i].type ==
+                  toUnderlyingType(Projectile::Type::ENEMY_BULLET);
+              appendDot(
+                  positions[i].x,
+                  positions[i].y,
+                  is_enemy ? enemy_projectile_color : allied_projectile_color);
+            }
+          });
+
+  sf::Color const pickup_color = getColor(Category::Type::PICKUP);
+  registry.query<ECS::Position, ECS::PickupInfo>()
+      .eachChunk<ECS::Position>([&](std::size_t count,
+                                    ECS::Position* positions) {
+        for (std::size_t i = 0; i < count; ++i)
+          appendDot(positions[i].x, positions[i].y, pickup_color);
+      });
+}
+
+void Minimap::appendDot(float x, float y, sf::Color color)
+{
+  float const left = (x - m_area.left) * m_scale.x - Dot_Size / 2.f;
+  float const top = (y - m_area.top) * m_scale.y - Dot_Size / 2.f;
+  float const right = left + Dot_Size;
+  float const bottom = top + Dot_Size;
+  m_dots.emplace_back(sf::Vector2f{left, top}, color);
+  m_dots.emplace_back(sf::Vector2f{right, top}, color);
+  m_dots.emplace_back(sf::Vector2f{right, bottom}, color);
+  m_dots.emplace_back(sf::Vector2f{left, bottom}, color);
+}
+
+void Minimap::appendOutline(sf::FloatRect const& bounds)
+{
+  float const left = (bounds.left - m_area.left) * m_scale.x;
+  float const top = (bounds.top - m_area.top) * m_scale.y;
+  float const right = left + bounds.width * m_scale.x;
+  float const bottom = top + bounds.height * m_scale.y;
+  sf::Color const color = sf::Color::White;
+  m_outline.emplace_back(sf::Vector2f{left, top}, color);
+  m_outline.emplace_back(sf::Vector2f{right, top}, color);
+  m_outline.emplace_back(sf::Vector2f{right, bottom}, color);
+  m_outline.emplace_back(sf::Vector2f{left, bottom}, color);
+  m_outline.emplace_back(sf::Vector2f{left, top}, color);
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,76 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_MINIMAP_H
+#define FAST_SIM_DESIGN_MINIMAP_H
+
+#include "../ecs/registry.h"
+#include "scene_node.h"
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Time.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <vector>
+
+namespace FastSimDesign {
+/// Low resolution overview of a whole area of the world, for the monitor.
+///
+/// Static layers are rendered once into a cached image, at twice the size of
+/// the minimap and downsampled by bilinear filtering, and rendered again
+/// only after invalidate(). Each refresh, at a lower rate than the frame
+/// rate, composes that image with the agents of the registry as one batch
+/// of dots and the outline of the view.
+class Minimap final : private sf::NonCopyable
+{
+public:
+  static constexpr unsigned Max_Size = 512; // Largest side, in pixels.
+  static constexpr float Dot_Size = 3.f; // In pixels.
+
+public:
+  explicit Minimap(sf::FloatRect const& area, float refresh_rate);
+  virtual ~Minimap() = default;
+
+  // Render the static layers again on the next refresh, after they changed.
+  void invalidate() noexcept;
+  // Refresh when the refresh period elapsed since the last one.
+  void update(
+      sf::Time const& dt,
+      SceneNode const& static_layers,
+      ECS::Registry& registry,
+      sf::FloatRect const& view);
+  sf::RenderTexture const& getTexture() const noexcept;
+
+private:
+  void renderStaticLayers(SceneNode const& static_layers);
+  void appendAgents(ECS::Registry& registry);
+  void appendDot(float x, float y, sf::Color color);
+  void appendOutline(sf::FloatRect const& bounds);
+
+private:
+  sf::FloatRect m_area{};
+  sf::Time m_refresh_period{};
+  sf::Time m_elapsed{};
+  bool m_needs_static_layers{true};
+
+  sf::RenderTexture m_static_layers{};
+  sf::RenderTexture m_texture{};
+  sf::Vector2f m_scale{}; // Minimap pixels per world unit.
+  std::vector<sf::Vertex> m_dots{}; // Kept allocated between refreshes.
+  std::vector<sf::Vertex> m_outline{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -14,9 +14,11 @@
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/Shader.hpp>
-#include <SFML/Graphics/VertexArray.hpp>
+#include <SFML/Graphics/Vertex.hpp>
 #include <SFML/System/Vector2.hpp>
 
+#include <array>
+
 namespace FastSimDesign {
 ////////////////////////////////////////////////////////////
 /// Statics
@@ -29,19 +31,24 @@ bool PostEffect::isSupported() noexcept
 void PostEffect::applyShader(
     sf::Shader const& shader, sf::RenderTarget& output) noexcept
 {
+  // Unit quad shared by every pass, scaled to the output.
+  static std::array<sf::Vertex, 4> const full_screen_quad{
+      sf::Vertex{sf::Vector2f{0, 0}, sf::Vector2f{0, 1}},
+      sf::Vertex{sf::Vector2f{1, 0}, sf::Vector2f{1, 1}},
+      sf::Vertex{sf::Vector2f{0, 1}, sf::Vector2f{0, 0}},
+      sf::Vertex{sf::Vector2f{1, 1}, sf::Vector2f{1, 0}}};
   sf::Vector2f outside_size = static_cast<sf::Vector2f>(output.getSize());
 
-  sf::VertexArray vertices{sf::TrianglesStrip, 4};
-  vertices[0] = sf::Vertex{sf::Vector2f{0, 0}, sf::Vector2f{0, 1}};
-  vertices[1] = sf::Vertex{sf::Vector2f{outside_size.x, 0}, sf::Vector2f{1, 1}};
-  vertices[2] = sf::Vertex{sf::Vector2f{0, outside_size.y}, sf::Vector2f{0, 0}};
-  vertices[3] = sf::Vertex{sf::Vector2f{outside_size}, sf::Vector2f{1, 0}};
-
   sf::RenderStates states;
   states.shader = &shader;
   states.blendMode = sf::BlendNone;
+  states.transform.scale(outside_size);
 
-  output.draw(vertices, states);
+  output.draw(
+      full_screen_quad.data(),
+      full_screen_quad.size(),
+      sf::TrianglesStrip,
+      states);
 }
 
 ////////////////////////////////////////////////////////////
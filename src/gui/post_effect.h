@@ -22,6 +22,10 @@ class RenderTexture;
 } // namespace sf
 
 namespace FastSimDesign {
+class RenderTargetPool;
+
+/// Pass of a post-processing chain. Intermediate render textures are leased
+/// from the pool of the chain rather than owned.
 class PostEffect : public sf::NonCopyable
 {
 public:
@@ -36,7 +40,9 @@ public:
   virtual ~PostEffect() = default;
 
   virtual void apply(
-      const sf::RenderTexture& input, sf::RenderTarget& output) = 0;
+      sf::RenderTexture const& input,
+      sf::RenderTarget& output,
+      RenderTargetPool& targets) = 0;
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -0,0 +1,73 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "post_process_chain.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+
+#include <cassert>
+#include <utility>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+void PostProcessChain::addEffect(std::unique_ptr<PostEffect> effect)
+{
+  assert(effect);
+  m_effects.push_back(std::move(effect));
+}
+
+void PostProcessChain::clearEffects() noexcept
+{
+  m_effects.clear();
+}
+
+std::size_t PostProcessChain::getEffectCount() const noexcept
+{
+  return m_effects.size();
+}
+
+RenderTargetPool const& PostProcessChain::getTargetPool() const noexcept
+{
+  return m_targets;
+}
+
+void PostProcessChain::apply(
+    sf::RenderTexture const& input, sf::RenderTarget& output)
+{
+  if (m_effects.empty())
+  {
+    output.draw(sf::Sprite{input.getTexture()});
+    m_targets.endFrame();
+    return;
+  }
+
+  // The result of an effect is held until the next one has read it.
+  sf::RenderTexture const* source = &input;
+  RenderTargetPool::Lease result{};
+  for (std::size_t i = 0; i + 1 < m_effects.size(); ++i)
+  {
+    RenderTargetPool::Lease next = m_targets.acquire(input.getSize());
+    m_effects[i]->apply(*source, *next, m_targets);
+    next->display();
+    result = std::move(next);
+    source = &*result;
+  }
+  m_effects.back()->apply(*source, output, m_targets);
+  m_targets.endFrame();
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_POST_PROCESS_CHAIN_H
+#define FAST_SIM_DESIGN_POST_PROCESS_CHAIN_H
+
+#include "post_effect.h"
+#include "render_target_pool.h"
+
+#include <SFML/System/NonCopyable.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace FastSimDesign {
+/// Ordered post effects applied to a rendered scene. Each effect reads the
+/// output of the previous one; intermediate results and the textures of the
+/// effects all come from one pool, reused from an effect and a frame to the
+/// next.
+class PostProcessChain final : private sf::NonCopyable
+{
+public:
+  explicit PostProcessChain() = default;
+  virtual ~PostProcessChain() = default;
+
+  // Effects are applied in the order they are added.
+  void addEffect(std::unique_ptr<PostEffect> effect);
+  void clearEffects() noexcept;
+  std::size_t getEffectCount() const noexcept;
+  RenderTargetPool const& getTargetPool() const noexcept;
+
+  // Apply the effects to `input` and draw the result to `output`, or draw
+  // `input` as is without effect.
+  void apply(sf::RenderTexture const& input, sf::RenderTarget& output);
+
+private:
+  std::vector<std::unique_ptr<PostEffect>> m_effects{};
+  RenderTargetPool m_targets{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "render_target_pool.h"
+
+#include "../core/resource_exception.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Lease::Methods
+////////////////////////////////////////////////////////////
+RenderTargetPool::Lease::Lease(Entry& entry) noexcept
+  : m_entry{&entry}
+{
+  m_entry->is_leased = true;
+}
+
+RenderTargetPool::Lease::Lease(Lease&& other) noexcept
+  : m_entry{std::exchange(other.m_entry, nullptr)}
+{
+}
+
+RenderTargetPool::Lease& RenderTargetPool::Lease::operator=(
+    Lease&& other) noexcept
+{
+  if (this != &other)
+  {
+    release();
+    m_entry = std::exchange(other.m_entry, nullptr);
+  }
+  return *this;
+}
+
+RenderTargetPool::Lease::~Lease()
+{
+  release();
+}
+
+sf::RenderTexture& RenderTargetPool::Lease::operator*() const noexcept
+{
+  assert(m_entry);
+  return m_entry->texture;
+}
+
+sf::RenderTexture* RenderTargetPool::Lease::operator->() const noexcept
+{
+  assert(m_entry);
+  return &m_entry->texture;
+}
+
+void RenderTargetPool::Lease::release() noexcept
+{
+  if (m_entry)
+    m_entry->is_leased = false;
+  m_entry = nullptr;
+}
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+RenderTargetPool::Lease RenderTargetPool::acquire(
+    sf::Vector2u size, RenderTargetFormat format)
+{
+  for (std::unique_ptr<Entry> const& entry : m_entries)
+  {
+    if (!entry->is_leased && entry->size == size && entry->format == format)
+    {
+      entry->last_frame = m_frame;
+      return Lease{*entry};
+    }
+  }
+
+  auto entry = std::make_unique<Entry>();
+  if (!entry->texture.create(size.x, size.y))
+    throw ResourceException{"Failed to create a pooled render texture"};
+  entry->texture.setSmooth(format.is_smooth);
+  entry->size = size;
+  entry->format = format;
+  entry->last_frame = m_frame;
+  return Lease{*m_entries.emplace_back(std::move(entry))};
+}
+
+void RenderTargetPool::endFrame() noexcept
+{
+  ++m_frame;
+  std::erase_if(m_entries, [this](std::unique_ptr<Entry> const& entry) {
+    return !entry->is_leased && m_frame - entry->last_frame > Max_Idle_Frames;
+  });
+}
+
+std::size_t RenderTargetPool::getTargetCount() const noexcept
+{
+  return m_entries.size();
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_RENDER_TARGET_POOL_H
+#define FAST_SIM_DESIGN_RENDER_TARGET_POOL_H
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace FastSimDesign {
+/// Format of the render textures of a pool. Textures of different formats
+/// are never shared.
+struct RenderTargetFormat
+{
+  bool is_smooth{true}; // Linear filtering when sampled.
+
+  bool operator==(RenderTargetFormat const& other) const noexcept = default;
+};
+
+/// Intermediate render textures shared by post effects, keyed by size and
+/// format. A texture is leased for the passes that write and read it, then
+/// returned to the pool to be reused by the next effect or frame. Textures
+/// left unused for Max_Idle_Frames frames are destroyed.
+class RenderTargetPool final : private sf::NonCopyable
+{
+public:
+  static constexpr std::size_t Max_Idle_Frames = 120;
+
+private:
+  struct Entry
+  {
+    sf::RenderTexture texture{};
+    sf::Vector2u size{};
+    RenderTargetFormat format{};
+    bool is_leased{false};
+    std::size_t last_frame{0}; // Last leased in.
+  };
+
+public:
+  /// Render texture held until the lease is destroyed.
+  class Lease final
+  {
+  public:
+    Lease() = default;
+    Lease(Lease const&) = delete;
+    Lease(Lease&& other) noexcept;
+    Lease& operator=(Lease const&) = delete;
+    Lease& operator=(Lease&& other) noexcept;
+    ~Lease();
+
+    sf::RenderTexture& operator*() const noexcept;
+    sf::RenderTexture* operator->() const noexcept;
+    void release() noexcept;
+
+  private:
+    friend class RenderTargetPool;
+    explicit Lease(Entry& entry) noexcept;
+
+  private:
+    Entry* m_entry{nullptr};
+  };
+
+public:
+  explicit RenderTargetPool() = default;
+  virtual ~RenderTargetPool() = default;
+
+  // The content of the texture is undefined, passes must clear or cover it.
+  Lease acquire(
+      sf::Vector2u size, RenderTargetFormat format = RenderTargetFormat{});
+  // Destroy the textures left idle for too long, once per frame.
+  void endFrame() noexcept;
+  std::size_t getTargetCount() const noexcept;
+
+private:
+  std::vector<std::unique_ptr<Entry>> m_entries{};
+  std::size_t m_frame{0};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
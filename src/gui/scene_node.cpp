@@ -44,10 +44,22 @@ SceneNode::SceneNode(Category::Type category) noexcept
 {
 }
 
+SceneNode::SceneNode(SceneNode const& prototype) noexcept
+  : sf::Transformable{prototype}
+  , sf::Drawable{}
+  , sf::NonCopyable{}
+  , SimMonitor::Monitorable{}
+  , m_default_category{prototype.m_default_category}
+{
+}
+
 void SceneNode::attachChild(Ptr child) noexcept
 {
   child->m_parent = this;
+  if (m_services)
+    child->bindServices(*m_services);
   m_children.push_back(std::move(child));
+  notifyDescendantsChanged();
 }
 
 SceneNode::Ptr SceneNode::detachChild(SceneNode const& node)
@@ -60,7 +72,9 @@ SceneNode::Ptr SceneNode::detachChild(SceneNode const& node)
 
   Ptr result = std::move(*found);
   result->m_parent = nullptr;
+  result->unbindServices();
   m_children.erase(found);
+  notifyDescendantsChanged();
   return result;
 }
 
@@ -70,6 +84,46 @@ void SceneNode::update(sf::Time const& dt, CommandQueue& commands)
   updateChildren(dt, commands);
 }
 
+void SceneNode::bindServices(ServiceRegistry& services) noexcept
+{
+  assert(m_services == nullptr || m_services == &services);
+  if (m_services == nullptr)
+  {
+    m_services = &services;
+    if (auto* nodes = services.find<HandleTable<SceneNode>>())
+      m_handle = nodes->insert(*this);
+    onServicesBound(services);
+  }
+
+  for (Ptr const& child : m_children)
+    child->bindServices(services);
+}
+
+void SceneNode::unbindServices() noexcept
+{
+  for (Ptr const& child : m_children)
+    child->unbindServices();
+
+  if (m_services)
+  {
+    onServicesUnbound(*m_services);
+    if (auto* nodes = m_services->find<HandleTable<SceneNode>>())
+      nodes->release(m_handle);
+    m_handle = Handle{};
+    m_services = nullptr;
+  }
+}
+
+ServiceRegistry* SceneNode::getServices() const noexcept
+{
+  return m_services;
+}
+
+Handle SceneNode::getHandle() const noexcept
+{
+  return m_handle;
+}
+
 void SceneNode::monitorState(
     SimMonitor::Monitor& monitor,
     SimMonitor::Frame::SceneNode& frame_object) const
@@ -77,6 +131,8 @@ void SceneNode::monitorState(
   // Current node.
   frame_object.category = Category::toString(getCategory());
   frame_object.type = typeid(*this).name();
+  frame_object.handle_index = m_handle.index;
+  frame_object.handle_generation = m_handle.generation;
 
   // Children node.
   for (auto const& child : m_children)
@@ -155,14 +211,23 @@ void SceneNode::checkNodeCollision(
 
 void SceneNode::removeWrecks() noexcept
 {
-  // Remove all children which request so.
-  auto erase_begin = std::remove_if(
-      std::begin(m_children),
-      std::end(m_children),
-      [](Ptr const& child) {
-        return child->isMarkedForRemoval();
-      });
-  m_children.erase(erase_begin, std::end(m_children));
+  NodeRecycler* recycler =
+      m_services ? m_services->find<NodeRecycler>() : nullptr;
+
+  // Remove all children which request so, handing them to the recycler.
+  for (Ptr& child : m_children)
+  {
+    if (!child->isMarkedForRemoval())
+      continue;
+
+    child->unbindServices();
+    child->m_parent = nullptr;
+    if (recycler)
+      recycler->recycle(std::move(child));
+    child.reset();
+  }
+  if (std::erase(m_children, nullptr) > 0)
+    notifyDescendantsChanged();
 
   // Call function recursively for all remaining children.
   std::for_each(
@@ -173,6 +238,27 @@ void SceneNode::removeWrecks() noexcept
       });
 }
 
+void SceneNode::onServicesBound(ServiceRegistry&) noexcept
+{
+  // Do nothing by default.
+}
+
+void SceneNode::onServicesUnbound(ServiceRegistry&) noexcept
+{
+  // Do nothing by default.
+}
+
+void SceneNode::onDescendantsChanged() noexcept
+{
+  // Do nothing by default.
+}
+
+void SceneNode::notifyDescendantsChanged() noexcept
+{
+  for (SceneNode* node = this; node != nullptr; node = node->m_parent)
+    node->onDescendantsChanged();
+}
+
 void SceneNode::updateCurrent(sf::Time const&, CommandQueue&)
 {
   // Do nothing by default.
@@ -224,4 +310,19 @@ void SceneNode::drawBoundingRect(
   target.draw(shape);
 }
 
+void SceneNode::rasterize(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  states.transform *= getTransform();
+
+  rasterizeCurrent(target, states);
+  for (Ptr const& child : m_children)
+    child->rasterize(target, states);
+}
+
+void SceneNode::rasterizeCurrent(SoftwareRenderTarget&, sf::RenderStates) const
+{
+  // Do nothing by default.
+}
+
 } // namespace FastSimDesign
\ No newline at end of file
@@ -13,6 +13,8 @@
 #ifndef FAST_SIM_DESIGN_SCENE_NODE_H
 #define FAST_SIM_DESIGN_SCENE_NODE_H
 
+#include "../core/handle.h"
+#include "../core/service_registry.h"
 #include "../entity/category.h"
 #include "../monitor/monitorable.h"
 
@@ -22,6 +24,7 @@
 #include <SFML/System/NonCopyable.hpp>
 #include <SFML/System/Time.hpp>
 
+#include <cassert>
 #include <memory>
 #include <set>
 #include <utility>
@@ -30,6 +33,7 @@
 namespace FastSimDesign {
 struct Command;
 class CommandQueue;
+class SoftwareRenderTarget;
 class SceneNode
   : public sf::Transformable
   , public sf::Drawable
@@ -49,6 +53,19 @@ public:
   SceneNode::Ptr detachChild(SceneNode const& node);
 
   void update(sf::Time const& dt, CommandQueue& commands);
+  // Draw the node and its children on the CPU, from the images of their
+  // textures, as draw() does on an OpenGL render target.
+  void rasterize(SoftwareRenderTarget& target, sf::RenderStates states) const;
+
+  void bindServices(ServiceRegistry& services) noexcept;
+  void unbindServices() noexcept;
+  ServiceRegistry* getServices() const noexcept;
+  Handle getHandle() const noexcept;
+  template<typename T>
+  T* resolve(Handle handle) const noexcept;
+  // Call `function(node)` on this node then on its descendants, depth first.
+  template<typename Function>
+  void visit(Function&& function) const;
 
   virtual void monitorState(
       SimMonitor::Monitor& monitor,
@@ -70,7 +87,19 @@ public:
       SceneNode& node, std::set<SceneNode::Pair>& collision_pairs) noexcept;
   void removeWrecks() noexcept;
 
+protected:
+  // Copy the transform and category of a prototype, not its place in a scene
+  // graph: the copy has no parent, children, services nor handle.
+  SceneNode(SceneNode const& prototype) noexcept;
+
 private:
+  virtual void onServicesBound(ServiceRegistry& services) noexcept;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept;
+  // Called on this node and its ancestors when a node is attached under it
+  // or detached from it.
+  virtual void onDescendantsChanged() noexcept;
+  void notifyDescendantsChanged() noexcept;
+
   virtual void updateCurrent(sf::Time const& dt, CommandQueue& commands);
   void updateChildren(sf::Time const& dt, CommandQueue& commands);
 
@@ -81,13 +110,53 @@ private:
   void drawChildren(sf::RenderTarget& target, sf::RenderStates states) const;
   void drawBoundingRect(
       sf::RenderTarget& target, sf::RenderStates states) const;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const;
 
 private:
   std::vector<Ptr> m_children{};
   SceneNode* m_parent{nullptr};
+  ServiceRegistry* m_services{nullptr};
   BitFlags<Category::Type> m_default_category{};
+  Handle m_handle{};
+};
+
+/// Takes back the wrecks removed from the scene graph so that they can be
+/// reused, provided as a service.
+class NodeRecycler
+{
+public:
+  explicit NodeRecycler() = default;
+  NodeRecycler(NodeRecycler const&) = default;
+  NodeRecycler(NodeRecycler&&) = default;
+  NodeRecycler& operator=(NodeRecycler const&) = default;
+  NodeRecycler& operator=(NodeRecycler&&) = default;
+  virtual ~NodeRecycler() = default;
+
+  // The node is detached and unbound, the recycler keeps it or lets it die.
+  virtual void recycle(SceneNode::Ptr node) noexcept = 0;
 };
 
+template<typename T>
+T* SceneNode::resolve(Handle handle) const noexcept
+{
+  if (!m_services)
+    return nullptr;
+
+  auto* nodes = m_services->find<HandleTable<SceneNode>>();
+  SceneNode* node = nodes ? nodes->resolve(handle) : nullptr;
+  assert(node == nullptr || dynamic_cast<T*>(node) != nullptr);
+  return static_cast<T*>(node);
+}
+
+template<typename Function>
+void SceneNode::visit(Function&& function) const
+{
+  function(*this);
+  for (Ptr const& child : m_children)
+    child->visit(function);
+}
+
 ////////////////////////////////////////////////////////////
 /// Outside class declarations/definitions
 ////////////////////////////////////////////////////////////
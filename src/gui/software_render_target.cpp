@@ -0,0 +1,497 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "software_render_target.h"
+
+#include "../core/worker_pool.h"
+#include "../utils/blend_util.h"
+#include "animation.h"
+#include "bitmap_text.h"
+#include "scene_node.h"
+
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/VertexArray.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace FastSimDesign {
+namespace {
+inline std::uint8_t toChannel(float value) noexcept
+{
+  return static_cast<std::uint8_t>(std::clamp(value, 0.f, 255.f) + 0.5f);
+}
+
+inline int clampTexel(int texel, unsigned size) noexcept
+{
+  return std::clamp(texel, 0, static_cast<int>(size) - 1);
+}
+
+struct Edge
+{
+  float x{0.f};
+  float y{0.f};
+  float dx{0.f};
+  float dy{0.f};
+  // Pixels centered on the edge belong to one triangle of the two sharing
+  // it: the one for which the edge is top or left.
+  bool is_top_left{false};
+
+  float evaluate(float px, float py) const noexcept
+  {
+    return dx * (py - y) - dy * (px - x);
+  }
+};
+
+Edge makeEdge(float ax, float ay, float bx, float by) noexcept
+{
+  float const dx = bx - ax;
+  float const dy = by - ay;
+  return Edge{ax, ay, dx, dy, dy < 0.f || (dy == 0.f && dx > 0.f)};
+}
+
+inline bool isInside(float value, Edge const& edge) noexcept
+{
+  return value > 0.f || (value == 0.f && edge.is_top_left);
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+SoftwareRenderTarget::Blend SoftwareRenderTarget::toBlend(
+    sf::BlendMode const& mode) noexcept
+{
+  if (mode == sf::BlendAdd)
+    return Blend::ADD;
+  if (mode == sf::BlendNone)
+    return Blend::NONE;
+  return Blend::ALPHA;
+}
+
+SoftwareRenderTarget::Sampler SoftwareRenderTarget::toSampler(
+    sf::Image const* image) noexcept
+{
+  if (image == nullptr || image->getSize().x == 0 || image->getSize().y == 0)
+    return Sampler{};
+  return Sampler{image->getPixelsPtr(), image->getSize()};
+}
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+SoftwareRenderTarget::SoftwareRenderTarget(
+    sf::Vector2u size, WorkerPool* workers)
+  : m_size{size}
+  , m_workers{workers}
+  , m_default_view{sf::FloatRect{
+        0.f, 0.f, static_cast<float>(size.x), static_cast<float>(size.y)}}
+  , m_view{m_default_view}
+  , m_pixels(static_cast<std::size_t>(size.x) * size.y * 4)
+  , m_tile_counts{
+        (size.x + Tile_Size - 1) / Tile_Size,
+        (size.y + Tile_Size - 1) / Tile_Size}
+  , m_tile_triangles(
+        static_cast<std::size_t>(m_tile_counts.x) * m_tile_counts.y)
+{
+}
+
+void SoftwareRenderTarget::clear(sf::Color color)
+{
+  m_triangles.clear();
+  std::uint8_t const pixel[4]{color.r, color.g, color.b, color.a};
+  for (std::size_t i = 0; i < m_pixels.size(); i += 4)
+    std::memcpy(m_pixels.data() + i, pixel, 4);
+}
+
+void SoftwareRenderTarget::setView(sf::View const& view) noexcept
+{
+  m_view = view;
+}
+
+sf::View const& SoftwareRenderTarget::getView() const noexcept
+{
+  return m_view;
+}
+
+sf::View const& SoftwareRenderTarget::getDefaultView() const noexcept
+{
+  return m_default_view;
+}
+
+void SoftwareRenderTarget::draw(
+    sf::Vertex const* vertices,
+    std::size_t vertex_count,
+    sf::PrimitiveType type,
+    sf::RenderStates const& states,
+    sf::Image const* image)
+{
+  drawWithSampler(vertices, vertex_count, type, states, toSampler(image));
+}
+
+void SoftwareRenderTarget::draw(
+    sf::VertexArray const& vertices,
+    sf::RenderStates const& states,
+    sf::Image const* image)
+{
+  if (vertices.getVertexCount() > 0)
+  {
+    draw(
+        &vertices[0],
+        vertices.getVertexCount(),
+        vertices.getPrimitiveType(),
+        states,
+        image);
+  }
+}
+
+void SoftwareRenderTarget::draw(
+    sf::Sprite const& sprite, sf::RenderStates states, sf::Image const* image)
+{
+  sf::FloatRect const rect{sprite.getTextureRect()};
+  float const width = std::abs(rect.width);
+  float const height = std::abs(rect.height);
+  float const right = rect.left + rect.width;
+  float const bottom = rect.top + rect.height;
+  sf::Color const color = sprite.getColor();
+  sf::Vertex const quad[4]{
+      sf::Vertex{sf::Vector2f{0.f, 0.f}, color, {rect.left, rect.top}},
+      sf::Vertex{sf::Vector2f{width, 0.f}, color, {right, rect.top}},
+      sf::Vertex{sf::Vector2f{width, height}, color, {right, bottom}},
+      sf::Vertex{sf::Vector2f{0.f, height}, color, {rect.left, bottom}}};
+
+  states.transform *= sprite.getTransform();
+  draw(quad, 4, sf::Quads, states, image);
+}
+
+void SoftwareRenderTarget::draw(
+    Animation const& animation,
+    sf::RenderStates states,
+    sf::Image const* image)
+{
+  std::array<sf::Vertex, 4> const quad = animation.getVertices();
+  states.transform *= animation.getTransform();
+  draw(quad.data(), quad.size(), sf::Quads, states, image);
+}
+
+void SoftwareRenderTarget::draw(
+    BitmapText const& text, sf::RenderStates states)
+{
+  TextLayout const* layout = text.getLayout();
+  if (!layout || layout->vertices.empty())
+    return;
+
+  // Layout vertices are white, tinted by the color of the text.
+  std::vector<sf::Vertex> vertices = layout->vertices;
+  for (sf::Vertex& vertex : vertices)
+    vertex.color = text.getFillColor();
+
+  states.transform *= text.getTransform();
+  draw(
+      vertices.data(),
+      vertices.size(),
+      sf::Quads,
+      states,
+      &text.getFont()->getImage());
+}
+
+void SoftwareRenderTarget::draw(
+    SceneNode const& node, sf::RenderStates const& states)
+{
+  node.rasterize(*this, states);
+}
+
+void SoftwareRenderTarget::display()
+{
+  for (std::vector<std::uint32_t>& triangles : m_tile_triangles)
+    triangles.clear();
+
+  // Bin the triangles by tile, keeping their draw order in each tile.
+  for (std::size_t i = 0; i < m_triangles.size(); ++i)
+  {
+    Triangle const& triangle = m_triangles[i];
+    unsigned const first_x = static_cast<unsigned>(triangle.left) / Tile_Size;
+    unsigned const first_y = static_cast<unsigned>(triangle.top) / Tile_Size;
+    unsigned const last_x =
+        static_cast<unsigned>(triangle.right - 1) / Tile_Size;
+    unsigned const last_y =
+        static_cast<unsigned>(triangle.bottom - 1) / Tile_Size;
+    for (unsigned y = first_y; y <= last_y; ++y)
+    {
+      for (unsigned x = first_x; x <= last_x; ++x)
+      {
+        m_tile_triangles[static_cast<std::size_t>(y) * m_tile_counts.x + x]
+            .push_back(static_cast<std::uint32_t>(i));
+      }
+    }
+  }
+
+  // Tiles cover disjoint pixels, they are rasterized in parallel.
+  std::size_t const tile_count = m_tile_triangles.size();
+  if (m_workers && tile_count > 1)
+  {
+    TaskGroup tasks{};
+    m_workers->submitRanges(
+        tasks,
+        tile_count,
+        m_workers->getRangeSize(tile_count, 1),
+        [this](std::size_t first, std::size_t count) {
+          for (std::size_t tile = first; tile < first + count; ++tile)
+            rasterizeTile(tile);
+        });
+    m_workers->wait(tasks);
+  }
+  else
+  {
+    for (std::size_t tile = 0; tile < tile_count; ++tile)
+      rasterizeTile(tile);
+  }
+  m_triangles.clear();
+}
+
+sf::Vector2u SoftwareRenderTarget::getSize() const noexcept
+{
+  return m_size;
+}
+
+std::uint8_t const* SoftwareRenderTarget::getPixels() const noexcept
+{
+  return m_pixels.data();
+}
+
+sf::Image SoftwareRenderTarget::copyToImage() const
+{
+  sf::Image image{};
+  image.create(m_size.x, m_size.y, m_pixels.data());
+  return image;
+}
+
+void SoftwareRenderTarget::drawWithSampler(
+    sf::Vertex const* vertices,
+    std::size_t vertex_count,
+    sf::PrimitiveType type,
+    sf::RenderStates const& states,
+    Sampler const& sampler)
+{
+  // From the coordinates of the vertices to normalized device coordinates,
+  // then to the pixels of the viewport.
+  sf::Transform const transform = m_view.getTransform() * states.transform;
+  sf::FloatRect const& viewport = m_view.getViewport();
+  float const width = static_cast<float>(m_size.x);
+  float const height = static_cast<float>(m_size.y);
+  auto toScreen = [&](sf::Vertex const& vertex) {
+    sf::Vector2f const ndc = transform.transformPoint(vertex.position);
+    return ScreenVertex{
+        (viewport.left + (ndc.x + 1.f) / 2.f * viewport.width) * width,
+        (viewport.top + (1.f - ndc.y) / 2.f * viewport.height) * height,
+        vertex.texCoords.x,
+        vertex.texCoords.y,
+        {static_cast<float>(vertex.color.r),
+         static_cast<float>(vertex.color.g),
+         static_cast<float>(vertex.color.b),
+         static_cast<float>(vertex.color.a)}};
+  };
+  Blend const blend = toBlend(states.blendMode);
+  auto queue = [&](std::size_t a, std::size_t b, std::size_t c) {
+    queueTriangle(
+        toScreen(vertices[a]),
+        toScreen(vertices[b]),
+        toScreen(vertices[c]),
+        sampler,
+        blend);
+  };
+
+  switch (type)
+  {
+    case sf::Triangles:
+      for (std::size_t i = 0; i + 3 <= vertex_count; i += 3)
+        queue(i, i + 1, i + 2);
+      break;
+    case sf::TriangleStrip:
+      for (std::size_t i = 2; i < vertex_count; ++i)
+        queue(i - 2, i - 1, i);
+      break;
+    case sf::TriangleFan:
+      for (std::size_t i = 2; i < vertex_count; ++i)
+        queue(0, i - 1, i);
+      break;
+    case sf::Quads:
+      for (std::size_t i = 0; i + 4 <= vertex_count; i += 4)
+      {
+        queue(i, i + 1, i + 2);
+        queue(i, i + 2, i + 3);
+      }
+      break;
+    default:
+      break;
+  }
+}
+
+void SoftwareRenderTarget::queueTriangle(
+    ScreenVertex const& a,
+    ScreenVertex const& b,
+    ScreenVertex const& c,
+    Sampler const& sampler,
+    Blend blend)
+{
+  // Vertices are ordered so that the area is positive.
+  float const area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+  if (area == 0.f || !std::isfinite(area))
+    return;
+
+  Triangle triangle{};
+  triangle.vertices = area > 0.f ? std::array<ScreenVertex, 3>{a, b, c}
+                                 : std::array<ScreenVertex, 3>{a, c, b};
+  triangle.sampler = sampler;
+  triangle.blend = blend;
+
+  float const min_x = std::min({a.x, b.x, c.x});
+  float const min_y = std::min({a.y, b.y, c.y});
+  float const max_x = std::max({a.x, b.x, c.x});
+  float const max_y = std::max({a.y, b.y, c.y});
+  float const width = static_cast<float>(m_size.x);
+  float const height = static_cast<float>(m_size.y);
+  triangle.left = static_cast<int>(std::clamp(std::floor(min_x), 0.f, width));
+  triangle.top = static_cast<int>(std::clamp(std::floor(min_y), 0.f, height));
+  triangle.right = static_cast<int>(std::clamp(std::ceil(max_x), 0.f, width));
+  triangle.bottom =
+      static_cast<int>(std::clamp(std::ceil(max_y), 0.f, height));
+  if (triangle.left >= triangle.right || triangle.top >= triangle.bottom)
+    return;
+
+  m_triangles.push_back(triangle);
+}
+
+void SoftwareRenderTarget::rasterizeTile(std::size_t tile) noexcept
+{
+  int const tile_x = static_cast<int>(tile % m_tile_counts.x);
+  int const tile_y = static_cast<int>(tile / m_tile_counts.x);
+  int const left = tile_x * static_cast<int>(Tile_Size);
+  int const top = tile_y * static_cast<int>(Tile_Size);
+  int const right =
+      std::min(left + static_cast<int>(Tile_Size), static_cast<int>(m_size.x));
+  int const bottom =
+      std::min(top + static_cast<int>(Tile_Size), static_cast<int>(m_size.y));
+
+  for (std::uint32_t index : m_tile_triangles[tile])
+    rasterizeTriangle(m_triangles[index], left, top, right, bottom);
+}
+
+void SoftwareRenderTarget::rasterizeTriangle(
+    Triangle const& triangle,
+    int tile_left,
+    int tile_top,
+    int tile_right,
+    int tile_bottom) noexcept
+{
+  auto const& [a, b, c] = triangle.vertices;
+  // Each edge weighs the vertex facing it.
+  Edge const edges[3]{
+      makeEdge(b.x, b.y, c.x, c.y),
+      makeEdge(c.x, c.y, a.x, a.y),
+      makeEdge(a.x, a.y, b.x, b.y)};
+  float const inverse_area = 1.f / edges[2].evaluate(c.x, c.y);
+  Sampler const& sampler = triangle.sampler;
+
+  int const first_x = std::max(triangle.left, tile_left);
+  int const last_x = std::min(triangle.right, tile_right);
+  int const first_y = std::max(triangle.top, tile_top);
+  int const last_y = std::min(triangle.bottom, tile_bottom);
+
+  std::array<std::uint8_t, Tile_Size * 4> span{};
+  for (int y = first_y; y < last_y; ++y)
+  {
+    float const py = static_cast<float>(y) + 0.5f;
+    float const px = static_cast<float>(first_x) + 0.5f;
+    float weights[3]{
+        edges[0].evaluate(px, py),
+        edges[1].evaluate(px, py),
+        edges[2].evaluate(px, py)};
+
+    // The triangle is convex, its pixels on a row are contiguous.
+    int span_start = -1;
+    int span_end = last_x;
+    for (int x = first_x; x < last_x; ++x)
+    {
+      bool const is_inside = isInside(weights[0], edges[0]) &&
+                             isInside(weights[1], edges[1]) &&
+                             isInside(weights[2], edges[2]);
+      if (is_inside)
+      {
+        if (span_start < 0)
+          span_start = x;
+
+        float const la = weights[0] * inverse_area;
+        float const lb = weights[1] * inverse_area;
+        float const lc = weights[2] * inverse_area;
+        std::uint8_t* pixel =
+            span.data() + static_cast<std::size_t>(x - span_start) * 4;
+        float color[4];
+        for (std::size_t channel = 0; channel < 4; ++channel)
+        {
+          color[channel] = la * a.color[channel] + lb * b.color[channel] +
+                           lc * c.color[channel];
+        }
+        if (sampler.pixels)
+        {
+          float const u = la * a.u + lb * b.u + lc * c.u;
+          float const v = la * a.v + lb * b.v + lc * c.v;
+          int const texel_x =
+              clampTexel(static_cast<int>(std::floor(u)), sampler.size.x);
+          int const texel_y =
+              clampTexel(static_cast<int>(std::floor(v)), sampler.size.y);
+          std::uint8_t const* texel =
+              sampler.pixels +
+              (static_cast<std::size_t>(texel_y) * sampler.size.x +
+               static_cast<std::size_t>(texel_x)) *
+                  4;
+          for (std::size_t channel = 0; channel < 4; ++channel)
+            color[channel] *= static_cast<float>(texel[channel]) / 255.f;
+        }
+        for (std::size_t channel = 0; channel < 4; ++channel)
+          pixel[channel] = toChannel(color[channel]);
+      }
+      else if (span_start >= 0)
+      {
+        span_end = x;
+        break;
+      }
+
+      for (std::size_t edge = 0; edge < 3; ++edge)
+        weights[edge] -= edges[edge].dy;
+    }
+    if (span_start < 0)
+      continue;
+
+    std::size_t const count = static_cast<std::size_t>(span_end - span_start);
+    std::uint8_t* destination =
+        m_pixels.data() +
+        (static_cast<std::size_t>(y) * m_size.x +
+         static_cast<std::size_t>(span_start)) *
+            4;
+    switch (triangle.blend)
+    {
+      case Blend::ADD:
+        PixelBlend::add(destination, span.data(), count);
+        break;
+      case Blend::NONE:
+        std::memcpy(destination, span.data(), count * 4);
+        break;
+      case Blend::ALPHA:
+      default:
+        PixelBlend::alpha(destination, span.data(), count);
+        break;
+    }
+  }
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,182 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_SOFTWARE_RENDER_TARGET_H
+#define FAST_SIM_DESIGN_SOFTWARE_RENDER_TARGET_H
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/PrimitiveType.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/NonCopyable.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sf {
+class Sprite;
+class VertexArray;
+} // namespace sf
+
+namespace FastSimDesign {
+class Animation;
+class BitmapText;
+class SceneNode;
+class WorkerPool;
+
+/// Render target rasterizing on the CPU into an RGBA buffer, for rendering
+/// without an OpenGL context, such as headless visual regression checks
+/// against golden frames (see frame_comparison.h).
+///
+/// It mirrors the draw API of sf::RenderTarget for triangles, strips, fans
+/// and quads; points and lines are ignored. Draws are queued and rasterized
+/// by display(), one square tile of the screen per task of the worker pool,
+/// each tile applying its triangles in draw order. Spans are blended with
+/// SIMD when the CPU supports it, with the same result as the scalar path.
+///
+/// Draws sample the image given along with them instead of the texture of
+/// their states, which is ignored, so that no texture has to be created.
+/// Texture coordinates are in pixels, sampled at the nearest texel and
+/// clamped to the image. Without image, draws are filled with the colors of
+/// their vertices. Blend modes other than alpha, add and none blend as alpha.
+class SoftwareRenderTarget final : private sf::NonCopyable
+{
+public:
+  static constexpr unsigned Tile_Size = 64; // In pixels, per side.
+
+public:
+  // Rasterize on the calling thread without worker pool.
+  explicit SoftwareRenderTarget(
+      sf::Vector2u size, WorkerPool* workers = nullptr);
+  virtual ~SoftwareRenderTarget() = default;
+
+  // Drop the queued draws and fill the buffer.
+  void clear(sf::Color color = sf::Color::Black);
+  void setView(sf::View const& view) noexcept;
+  sf::View const& getView() const noexcept;
+  sf::View const& getDefaultView() const noexcept;
+
+  // The image must stay alive until display().
+  void draw(
+      sf::Vertex const* vertices,
+      std::size_t vertex_count,
+      sf::PrimitiveType type,
+      sf::RenderStates const& states = sf::RenderStates::Default,
+      sf::Image const* image = nullptr);
+  void draw(
+      sf::VertexArray const& vertices,
+      sf::RenderStates const& states = sf::RenderStates::Default,
+      sf::Image const* image = nullptr);
+  void draw(
+      sf::Sprite const& sprite,
+      sf::RenderStates states = sf::RenderStates::Default,
+      sf::Image const* image = nullptr);
+  void draw(
+      Animation const& animation,
+      sf::RenderStates states = sf::RenderStates::Default,
+      sf::Image const* image = nullptr);
+  // Sampled from the atlas image of its font, without registration.
+  void draw(
+      BitmapText const& text,
+      sf::RenderStates states = sf::RenderStates::Default);
+  // Each node draws itself with the images of its textures.
+  void draw(
+      SceneNode const& node,
+      sf::RenderStates const& states = sf::RenderStates::Default);
+
+  // Rasterize the queued draws into the buffer.
+  void display();
+  sf::Vector2u getSize() const noexcept;
+  // Rows of RGBA pixels, from the top.
+  std::uint8_t const* getPixels() const noexcept;
+  sf::Image copyToImage() const;
+
+private:
+  enum class Blend : uint16_t
+  {
+    ALPHA,
+    ADD,
+    NONE,
+    BLEND_COUNT,
+  };
+
+  struct Sampler
+  {
+    std::uint8_t const* pixels{nullptr};
+    sf::Vector2u size{};
+  };
+
+  // Vertex in pixels of the target, channels of its color in [0, 255].
+  struct ScreenVertex
+  {
+    float x{0.f};
+    float y{0.f};
+    float u{0.f};
+    float v{0.f};
+    std::array<float, 4> color{};
+  };
+
+  struct Triangle
+  {
+    std::array<ScreenVertex, 3> vertices{};
+    Sampler sampler{}; // Without pixels when untextured.
+    Blend blend{Blend::ALPHA};
+    // Covered pixels, clamped to the target.
+    int left{0};
+    int top{0};
+    int right{0}; // Exclusive.
+    int bottom{0}; // Exclusive.
+  };
+
+private:
+  static Blend toBlend(sf::BlendMode const& mode) noexcept;
+  static Sampler toSampler(sf::Image const* image) noexcept;
+
+  void drawWithSampler(
+      sf::Vertex const* vertices,
+      std::size_t vertex_count,
+      sf::PrimitiveType type,
+      sf::RenderStates const& states,
+      Sampler const& sampler);
+  void queueTriangle(
+      ScreenVertex const& a,
+      ScreenVertex const& b,
+      ScreenVertex const& c,
+      Sampler const& sampler,
+      Blend blend);
+  void rasterizeTile(std::size_t tile) noexcept;
+  void rasterizeTriangle(
+      Triangle const& triangle,
+      int tile_left,
+      int tile_top,
+      int tile_right,
+      int tile_bottom) noexcept;
+
+private:
+  sf::Vector2u m_size{};
+  WorkerPool* m_workers{nullptr};
+  sf::View m_default_view{};
+  sf::View m_view{};
+  std::vector<std::uint8_t> m_pixels{};
+
+  std::vector<Triangle> m_triangles{};
+  sf::Vector2u m_tile_counts{};
+  // Indices of the triangles overlapping each tile, in draw order.
+  std::vector<std::vector<std::uint32_t>> m_tile_triangles{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
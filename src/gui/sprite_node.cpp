@@ -10,19 +10,30 @@
 
 #include "sprite_node.h"
 
+#include "../core/texture_holder.h"
+#include "software_render_target.h"
+
 #include <SFML/Graphics/RenderTarget.hpp>
 
 namespace FastSimDesign {
-SpriteNode::SpriteNode(sf::Texture const& texture) noexcept
-  : Parent{}
-  , m_sprite{texture}
+// The rectangle comes from the image, the texture being empty when headless.
+SpriteNode::SpriteNode(TextureHolder const& textures, Textures::ID texture)
+  : SpriteNode{
+        textures,
+        texture,
+        sf::IntRect{
+            sf::Vector2i{0, 0},
+            sf::Vector2i{textures.getImage(texture).getSize()}}}
 {
 }
 
 SpriteNode::SpriteNode(
-    sf::Texture const& texture, const sf::IntRect& textureRect) noexcept
+    TextureHolder const& textures,
+    Textures::ID texture,
+    const sf::IntRect& textureRect)
   : Parent{}
-  , m_sprite{texture, textureRect}
+  , m_sprite{textures.get(texture), textureRect}
+  , m_image{&textures.getImage(texture)}
 {
 }
 
@@ -31,4 +42,10 @@ void SpriteNode::drawCurrent(
 {
   target.draw(m_sprite, states);
 }
+
+void SpriteNode::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  target.draw(m_sprite, states, m_image);
+}
 } // namespace FastSimDesign
\ No newline at end of file
@@ -13,10 +13,15 @@
 #ifndef FAST_SIM_DESIGN_SPRITE_NODE_H
 #define FAST_SIM_DESIGN_SPRITE_NODE_H
 
+#include "../core/resource_identifiers.h"
 #include "scene_node.h"
 
 #include <SFML/Graphics/Sprite.hpp>
 
+namespace sf {
+class Image;
+} // namespace sf
+
 namespace FastSimDesign {
 class SpriteNode : public SceneNode
 {
@@ -24,16 +29,21 @@ private:
   using Parent = SceneNode;
 
 public:
-  explicit SpriteNode(sf::Texture const& texture) noexcept;
+  explicit SpriteNode(TextureHolder const& textures, Textures::ID texture);
   explicit SpriteNode(
-      sf::Texture const& texture, sf::IntRect const& textureRect) noexcept;
+      TextureHolder const& textures,
+      Textures::ID texture,
+      sf::IntRect const& textureRect);
   virtual ~SpriteNode() = default;
 
   virtual void drawCurrent(
       sf::RenderTarget& target, sf::RenderStates states) const override;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
 
 private:
   sf::Sprite m_sprite{};
+  sf::Image const* m_image{nullptr};
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
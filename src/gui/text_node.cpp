@@ -10,9 +10,15 @@
 
 #include "text_node.h"
 
+#include "../core/font_holder.h"
+#include "../core/service_registry.h"
 #include "../utils/sfml_util.h"
+#include "lod_renderer.h"
+#include "software_render_target.h"
+#include "text_renderer.h"
 
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/View.hpp>
 
 namespace FastSimDesign {
 ////////////////////////////////////////////////////////////
@@ -22,23 +28,70 @@ namespace FastSimDesign {
 ////////////////////////////////////////////////////////////
 /// Methods
 ////////////////////////////////////////////////////////////
-TextNode::TextNode(FontHolder const& fonts, std::string text) noexcept
+TextNode::TextNode(FontHolder const& fonts, std::string text)
 {
-  m_text.setFont(fonts.get(Fonts::ID::MAIN));
-  m_text.setCharacterSize(20);
+  m_text.setFont(fonts.getBitmapFont(Fonts::ID::MAIN, 20));
   setString(std::move(text));
 }
 
+TextNode::TextNode(TextNode const& prototype) noexcept
+  : Parent{prototype}
+  , m_text{prototype.m_text}
+{
+}
+
 void TextNode::setString(std::string text) noexcept
 {
   m_text.setString(std::move(text));
   SFML::centerOrigin(m_text);
 }
 
+void TextNode::onServicesBound(ServiceRegistry& services) noexcept
+{
+  m_renderer = services.find<TextRenderer>();
+}
+
+void TextNode::onServicesUnbound(ServiceRegistry&) noexcept
+{
+  m_renderer = nullptr;
+}
+
 void TextNode::drawCurrent(
     sf::RenderTarget& target, sf::RenderStates states) const
 {
-  target.draw(m_text, states);
+  if (!m_renderer)
+  {
+    target.draw(m_text, states);
+    return;
+  }
+
+  sf::View const& view = target.getView();
+  sf::FloatRect const view_bounds{
+      view.getCenter() - view.getSize() / 2.f, view.getSize()};
+  m_renderer->append(
+      m_text,
+      states.transform,
+      view_bounds,
+      LodRenderer::getPixelScale(target));
+}
+
+void TextNode::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  if (!m_renderer)
+  {
+    target.draw(m_text, states);
+    return;
+  }
+
+  sf::View const& view = target.getView();
+  sf::FloatRect const view_bounds{
+      view.getCenter() - view.getSize() / 2.f, view.getSize()};
+  m_renderer->append(
+      m_text,
+      states.transform,
+      view_bounds,
+      LodRenderer::getPixelScale(target));
 }
 
 } // namespace FastSimDesign
\ No newline at end of file
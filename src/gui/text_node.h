@@ -14,28 +14,39 @@
 #define FAST_SIM_DESIGN_TEXT_NODE_H
 
 #include "../core/resource_identifiers.h"
+#include "bitmap_text.h"
 #include "scene_node.h"
 
-#include <SFML/Graphics/Text.hpp>
+#include <string>
 
 namespace FastSimDesign {
+class TextRenderer;
+
+/// Text of the scene, appended to the batch of the text renderer found in the
+/// services, or drawn alone without one.
 class TextNode : public SceneNode
 {
 private:
   using Parent = SceneNode;
 
 public:
-  explicit TextNode(FontHolder const& fonts, std::string text) noexcept;
+  explicit TextNode(FontHolder const& fonts, std::string text);
+  TextNode(TextNode const& prototype) noexcept;
   virtual ~TextNode() = default;
 
   void setString(std::string text) noexcept;
 
 private:
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept override;
   virtual void drawCurrent(
       sf::RenderTarget& target, sf::RenderStates states) const override;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
 
 private:
-  sf::Text m_text{};
+  BitmapText m_text{};
+  TextRenderer const* m_renderer{nullptr};
 };
 } // namespace FastSimDesign
 #endif
\ No newline at end of file
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "text_renderer.h"
+
+#include "../core/service_registry.h"
+#include "software_render_target.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+
+namespace FastSimDesign {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+void TextRenderer::append(
+    BitmapText const& text,
+    sf::Transform const& transform,
+    sf::FloatRect const& view,
+    float pixel_scale) const
+{
+  TextLayout const* layout = text.getLayout();
+  if (!layout || layout->vertices.empty())
+    return;
+
+  sf::Transform const combined = transform * text.getTransform();
+  sf::FloatRect const bounds = combined.transformRect(layout->bounds);
+  if (!bounds.intersects(view) ||
+      bounds.height * pixel_scale < Min_Pixel_Height)
+    return;
+
+  std::vector<sf::Vertex>& vertices = getBatch(*text.getFont()).vertices;
+  sf::Color const color = text.getFillColor();
+  for (sf::Vertex const& vertex : layout->vertices)
+  {
+    vertices.emplace_back(
+        combined.transformPoint(vertex.position), color, vertex.texCoords);
+  }
+}
+
+void TextRenderer::onServicesBound(ServiceRegistry& services) noexcept
+{
+  services.provide<TextRenderer>(*this);
+}
+
+void TextRenderer::onServicesUnbound(ServiceRegistry& services) noexcept
+{
+  services.revoke<TextRenderer>(*this);
+}
+
+void TextRenderer::drawCurrent(
+    sf::RenderTarget& target, sf::RenderStates states) const
+{
+  // Vertices are already in the coordinates of the scene.
+  states.transform = sf::Transform::Identity;
+  for (Batch& batch : m_batches)
+  {
+    if (batch.vertices.empty())
+      continue;
+
+    states.texture = &batch.font->getTexture();
+    target.draw(
+        batch.vertices.data(), batch.vertices.size(), sf::Quads, states);
+    batch.vertices.clear();
+  }
+}
+
+void TextRenderer::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  // Vertices are already in the coordinates of the scene.
+  states.transform = sf::Transform::Identity;
+  for (Batch& batch : m_batches)
+  {
+    if (batch.vertices.empty())
+      continue;
+
+    target.draw(
+        batch.vertices.data(),
+        batch.vertices.size(),
+        sf::Quads,
+        states,
+        &batch.font->getImage());
+    batch.vertices.clear();
+  }
+}
+
+TextRenderer::Batch& TextRenderer::getBatch(BitmapFont const& font) const
+{
+  // Few fonts are used, a linear search is enough.
+  for (Batch& batch : m_batches)
+  {
+    if (batch.font == &font)
+      return batch;
+  }
+  return m_batches.emplace_back(Batch{&font, {}});
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,75 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_TEXT_RENDERER_H
+#define FAST_SIM_DESIGN_TEXT_RENDERER_H
+
+#include "bitmap_font.h"
+#include "bitmap_text.h"
+#include "scene_node.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+
+#include <vector>
+
+namespace FastSimDesign {
+/// Draws the texts of the scene in one batch per bitmap font.
+///
+/// Text nodes found it in the services and append their quads when they are
+/// drawn. The batch is drawn, then emptied, when the renderer itself is
+/// drawn, so it must be attached after them in drawing order.
+class TextRenderer final : public SceneNode
+{
+private:
+  using Parent = SceneNode;
+
+public:
+  // Texts shorter on screen are not drawn.
+  static constexpr float Min_Pixel_Height = 8.f;
+
+public:
+  explicit TextRenderer() = default;
+  virtual ~TextRenderer() = default;
+
+  // Append the quads of `text` placed by `transform`, skipped when outside of
+  // `view` or too small at `pixel_scale` pixels per unit of the scene.
+  void append(
+      BitmapText const& text,
+      sf::Transform const& transform,
+      sf::FloatRect const& view,
+      float pixel_scale) const;
+
+private:
+  struct Batch
+  {
+    BitmapFont const* font{nullptr};
+    std::vector<sf::Vertex> vertices{};
+  };
+
+private:
+  virtual void onServicesBound(ServiceRegistry& services) noexcept override;
+  virtual void onServicesUnbound(ServiceRegistry& services) noexcept override;
+  virtual void drawCurrent(
+      sf::RenderTarget& target, sf::RenderStates states) const override;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
+
+  Batch& getBatch(BitmapFont const& font) const;
+
+private:
+  // Vertices are kept allocated from one frame to the next.
+  mutable std::vector<Batch> m_batches{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "tile_layer_node.h"
+
+#include "software_render_target.h"
+
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/View.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+namespace FastSimDesign {
+namespace {
+// Tileset holding `gid`, among tilesets sorted by first global id.
+Tileset const* findTileset(
+    std::vector<Tileset> const& tilesets, std::uint32_t gid) noexcept
+{
+  auto next = std::upper_bound(
+      tilesets.begin(),
+      tilesets.end(),
+      gid,
+      [](std::uint32_t id, Tileset const& tileset) {
+        return id < tileset.first_gid;
+      });
+  if (next == tilesets.begin())
+    return nullptr;
+
+  Tileset const& tileset = *std::prev(next);
+  if (tileset.texture == nullptr && tileset.pixels == nullptr)
+    return nullptr;
+  if (tileset.tile_count != 0 && gid - tileset.first_gid >= tileset.tile_count)
+    return nullptr;
+  return &tileset;
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+TileLayerNode::TileLayerNode(
+    TileLayer const& layer, TileMap const& map, bool is_headless)
+  : m_chunk_counts{
+        (layer.size.x + Chunk_Size - 1) / Chunk_Size,
+        (layer.size.y + Chunk_Size - 1) / Chunk_Size}
+  , m_chunk_size{
+        static_cast<float>(map.tile_size.x * Chunk_Size),
+        static_cast<float>(map.tile_size.y * Chunk_Size)}
+  , m_uses_vertex_buffers{!is_headless && sf::VertexBuffer::isAvailable()}
+  , m_chunks(static_cast<std::size_t>(m_chunk_counts.x) * m_chunk_counts.y)
+{
+  assert(layer.getGids().size() ==
+         static_cast<std::size_t>(layer.size.x) * layer.size.y);
+
+  for (Tileset const& tileset : map.tilesets)
+  {
+    m_tile_overflow.x = std::max(
+        m_tile_overflow.x,
+        static_cast<float>(tileset.tile_size.x) -
+            static_cast<float>(map.tile_size.x));
+    m_tile_overflow.y = std::max(
+        m_tile_overflow.y,
+        static_cast<float>(tileset.tile_size.y) -
+            static_cast<float>(map.tile_size.y));
+  }
+
+  for (unsigned y = 0; y < m_chunk_counts.y; ++y)
+  {
+    for (unsigned x = 0; x < m_chunk_counts.x; ++x)
+    {
+      buildChunk(
+          layer,
+          map,
+          sf::Vector2u{x, y},
+          m_chunks[static_cast<std::size_t>(y) * m_chunk_counts.x + x]);
+    }
+  }
+  if (m_uses_vertex_buffers)
+    uploadChunks();
+}
+
+std::size_t TileLayerNode::getChunkCount() const noexcept
+{
+  return m_chunks.size();
+}
+
+void TileLayerNode::drawCurrent(
+    sf::RenderTarget& target, sf::RenderStates states) const
+{
+  sf::Vector2u first{};
+  sf::Vector2u last{};
+  if (!findVisibleChunks(target.getView(), states.transform, first, last))
+    return;
+
+  for (unsigned y = first.y; y <= last.y; ++y)
+  {
+    for (unsigned x = first.x; x <= last.x; ++x)
+    {
+      Chunk const& chunk =
+          m_chunks[static_cast<std::size_t>(y) * m_chunk_counts.x + x];
+      for (Batch const& batch : chunk.batches)
+      {
+        states.texture = batch.texture;
+        if (m_uses_vertex_buffers)
+          target.draw(batch.buffer, states);
+        else
+        {
+          target.draw(
+              batch.vertices.data(),
+              batch.vertices.size(),
+              sf::Quads,
+              states);
+        }
+      }
+    }
+  }
+}
+
+void TileLayerNode::rasterizeCurrent(
+    SoftwareRenderTarget& target, sf::RenderStates states) const
+{
+  // Quads uploaded to vertex buffers are no longer in memory.
+  sf::Vector2u first{};
+  sf::Vector2u last{};
+  if (m_uses_vertex_buffers ||
+      !findVisibleChunks(target.getView(), states.transform, first, last))
+    return;
+
+  for (unsigned y = first.y; y <= last.y; ++y)
+  {
+    for (unsigned x = first.x; x <= last.x; ++x)
+    {
+      Chunk const& chunk =
+          m_chunks[static_cast<std::size_t>(y) * m_chunk_counts.x + x];
+      for (Batch const& batch : chunk.batches)
+      {
+        target.draw(
+            batch.vertices.data(),
+            batch.vertices.size(),
+            sf::Quads,
+            states,
+            batch.pixels);
+      }
+    }
+  }
+}
+
+bool TileLayerNode::findVisibleChunks(
+    sf::View const& view,
+    sf::Transform const& transform,
+    sf::Vector2u& first,
+    sf::Vector2u& last) const
+{
+  if (m_chunks.empty())
+    return false;
+
+  // View in the coordinates of the layer, grown by the overflow of large
+  // tiles which may come from the chunks around it.
+  sf::FloatRect bounds = transform.getInverse().transformRect(
+      sf::FloatRect{view.getCenter() - view.getSize() / 2.f, view.getSize()});
+  bounds.left -= m_tile_overflow.x;
+  bounds.width += m_tile_overflow.x;
+  bounds.height += m_tile_overflow.y;
+
+  float const right = bounds.left + bounds.width;
+  float const bottom = bounds.top + bounds.height;
+  if (right < 0.f || bottom < 0.f)
+    return false;
+  if (bounds.left >= m_chunk_size.x * static_cast<float>(m_chunk_counts.x) ||
+      bounds.top >= m_chunk_size.y * static_cast<float>(m_chunk_counts.y))
+    return false;
+
+  // Index of the chunk holding `position`, clamped to the last one.
+  auto toChunk = [](float position, float chunk_size, unsigned count) {
+    float const index = std::floor(position / chunk_size);
+    return static_cast<unsigned>(
+        std::clamp(index, 0.f, static_cast<float>(count - 1)));
+  };
+  first = sf::Vector2u{
+      toChunk(bounds.left, m_chunk_size.x, m_chunk_counts.x),
+      toChunk(bounds.top, m_chunk_size.y, m_chunk_counts.y)};
+  last = sf::Vector2u{
+      toChunk(right, m_chunk_size.x, m_chunk_counts.x),
+      toChunk(bottom, m_chunk_size.y, m_chunk_counts.y)};
+  return true;
+}
+
+void TileLayerNode::buildChunk(
+    TileLayer const& layer,
+    TileMap const& map,
+    sf::Vector2u chunk_position,
+    Chunk& chunk)
+{
+  unsigned const first_x = chunk_position.x * Chunk_Size;
+  unsigned const first_y = chunk_position.y * Chunk_Size;
+  unsigned const last_x = std::min(first_x + Chunk_Size, layer.size.x);
+  unsigned const last_y = std::min(first_y + Chunk_Size, layer.size.y);
+  std::span<std::uint32_t const> const gids = layer.getGids();
+  for (unsigned y = first_y; y < last_y; ++y)
+  {
+    for (unsigned x = first_x; x < last_x; ++x)
+    {
+      std::uint32_t const gid =
+          gids[static_cast<std::size_t>(y) * layer.size.x + x];
+      if ((gid & TileLayer::Gid_Mask) == 0)
+        continue;
+
+      sf::Vector2f const cell_position{
+          static_cast<float>(x * map.tile_size.x),
+          static_cast<float>(y * map.tile_size.y)};
+      appendTile(gid, map, cell_position, chunk);
+    }
+  }
+}
+
+void TileLayerNode::uploadChunks()
+{
+  // All quads are uploaded before any is freed: if one upload fails, the
+  // whole layer is drawn from memory.
+  for (Chunk& chunk : m_chunks)
+  {
+    for (Batch& batch : chunk.batches)
+    {
+      if (!batch.buffer.create(batch.vertices.size()) ||
+          !batch.buffer.update(batch.vertices.data()))
+      {
+        m_uses_vertex_buffers = false;
+        return;
+      }
+    }
+  }
+
+  for (Chunk& chunk : m_chunks)
+  {
+    for (Batch& batch : chunk.batches)
+    {
+      batch.vertices.clear();
+      batch.vertices.shrink_to_fit();
+    }
+  }
+}
+
+void TileLayerNode::appendTile(
+    std::uint32_t gid,
+    TileMap const& map,
+    sf::Vector2f cell_position,
+    Chunk& chunk) const
+{
+  Tileset const* tileset =
+      findTileset(map.tilesets, gid & TileLayer::Gid_Mask);
+  if (tileset == nullptr)
+    return;
+
+  auto batch = std::find_if(
+      chunk.batches.begin(), chunk.batches.end(), [&](Batch const& candidate) {
+        return candidate.texture == tileset->texture &&
+               candidate.pixels == tileset->pixels;
+      });
+  if (batch == chunk.batches.end())
+  {
+    chunk.batches.emplace_back();
+    batch = std::prev(chunk.batches.end());
+    batch->texture = tileset->texture;
+    batch->pixels = tileset->pixels;
+  }
+
+  std::uint32_t const id = (gid & TileLayer::Gid_Mask) - tileset->first_gid;
+  std::uint32_t const column = id % std::max(tileset->columns, 1u);
+  std::uint32_t const row = id / std::max(tileset->columns, 1u);
+  sf::Vector2f const tile_size{tileset->tile_size};
+  sf::Vector2f const texture_position{
+      static_cast<float>(
+          tileset->margin + column * (tileset->tile_size.x + tileset->spacing)),
+      static_cast<float>(
+          tileset->margin + row * (tileset->tile_size.y + tileset->spacing))};
+
+  // Tiles are anchored at the bottom left of their cell.
+  sf::Vector2f const position{
+      cell_position.x,
+      cell_position.y + static_cast<float>(map.tile_size.y) - tile_size.y};
+
+  // Each corner samples the tile at the inverse of the flips, which Tiled
+  // applies diagonally first, then horizontally, then vertically.
+  static sf::Vector2f const Corners[4]{
+      {0.f, 0.f}, {1.f, 0.f}, {1.f, 1.f}, {0.f, 1.f}};
+  for (sf::Vector2f const& corner : Corners)
+  {
+    sf::Vector2f sample = corner;
+    if (gid & TileLayer::Flipped_Vertically)
+      sample.y = 1.f - sample.y;
+    if (gid & TileLayer::Flipped_Horizontally)
+      sample.x = 1.f - sample.x;
+    if (gid & TileLayer::Flipped_Diagonally)
+      std::swap(sample.x, sample.y);
+
+    batch->vertices.emplace_back(
+        sf::Vector2f{
+            position.x + corner.x * tile_size.x,
+            position.y + corner.y * tile_size.y},
+        sf::Vector2f{
+            texture_position.x + sample.x * tile_size.x,
+            texture_position.y + sample.y * tile_size.y});
+  }
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,105 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_TILE_LAYER_NODE_H
+#define FAST_SIM_DESIGN_TILE_LAYER_NODE_H
+
+#include "scene_node.h"
+#include "tile_map.h"
+
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/VertexBuffer.hpp>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace FastSimDesign {
+/// Static tile layer of a map, split in square chunks of tiles.
+///
+/// Quads of a chunk are built once, at construction, and uploaded to one
+/// vertex buffer per tileset used by the chunk. Only the chunks overlapping
+/// the view are drawn. Without vertex buffer support, quads stay in memory
+/// and are drawn from there.
+///
+/// Headless, no vertex buffer is made so that no OpenGL context is needed,
+/// and the quads in memory are drawn by the software render target from the
+/// pixels of the tilesets.
+class TileLayerNode final : public SceneNode
+{
+private:
+  using Parent = SceneNode;
+
+public:
+  static constexpr unsigned Chunk_Size = 32; // In tiles, per side.
+
+public:
+  explicit TileLayerNode(
+      TileLayer const& layer, TileMap const& map, bool is_headless = false);
+  virtual ~TileLayerNode() = default;
+
+  std::size_t getChunkCount() const noexcept;
+
+private:
+  // Quads of a chunk drawn from one tileset.
+  struct Batch
+  {
+    sf::Texture const* texture{nullptr};
+    sf::Image const* pixels{nullptr};
+    sf::VertexBuffer buffer{sf::Quads, sf::VertexBuffer::Static};
+    // Emptied once the quads of all chunks are uploaded.
+    std::vector<sf::Vertex> vertices{};
+  };
+
+  struct Chunk
+  {
+    std::vector<Batch> batches{};
+  };
+
+private:
+  virtual void drawCurrent(
+      sf::RenderTarget& target, sf::RenderStates states) const override;
+  virtual void rasterizeCurrent(
+      SoftwareRenderTarget& target, sf::RenderStates states) const override;
+  // Range of the chunks overlapping `view`, last included, false when none
+  // does.
+  bool findVisibleChunks(
+      sf::View const& view,
+      sf::Transform const& transform,
+      sf::Vector2u& first,
+      sf::Vector2u& last) const;
+
+  void buildChunk(
+      TileLayer const& layer,
+      TileMap const& map,
+      sf::Vector2u chunk_position,
+      Chunk& chunk);
+  void appendTile(
+      std::uint32_t gid,
+      TileMap const& map,
+      sf::Vector2f cell_position,
+      Chunk& chunk) const;
+  void uploadChunks();
+
+private:
+  sf::Vector2u m_chunk_counts{};
+  sf::Vector2f m_chunk_size{}; // In pixels.
+  // Tiles larger than the cells of the grid overflow up and right of them.
+  sf::Vector2f m_tile_overflow{};
+  bool m_uses_vertex_buffers{false};
+  std::vector<Chunk> m_chunks{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
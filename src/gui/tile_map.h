@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_TILE_MAP_H
+#define FAST_SIM_DESIGN_TILE_MAP_H
+
+#include <SFML/Graphics/Image.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace FastSimDesign {
+/// Custom property of a map element, as in Tiled. Values are kept as written
+/// in the file, e.g. "true" for booleans or "#ff00ff00" for colors.
+struct Property
+{
+  enum class Type : uint16_t
+  {
+    STRING,
+    INT,
+    FLOAT,
+    BOOL,
+    COLOR,
+    FILE,
+    OBJECT,
+    CLASS,
+    TYPE_COUNT
+  };
+
+  std::string name{};
+  Type type{Type::STRING};
+  std::string value{};
+};
+
+/// Image of tiles of a map, as in Tiled. Its tiles are numbered by global ids
+/// from `first_gid`, row by row.
+struct Tileset
+{
+  sf::Texture const* texture{nullptr};
+  sf::Image const* pixels{nullptr}; // Drawn by the software render target.
+  std::uint32_t first_gid{1};
+  sf::Vector2u tile_size{};
+  std::uint32_t columns{1};
+  std::uint32_t tile_count{0};
+  std::uint32_t spacing{0}; // Between tiles, in pixels.
+  std::uint32_t margin{0}; // Around the tiles, in pixels.
+  std::string name{};
+  // Image file of the tiles, the texture and pixels are loaded from it by
+  // the owner of the map.
+  std::filesystem::path image{};
+  std::filesystem::path source{}; // TSX file, empty if embedded in the map.
+  std::vector<Property> properties{};
+};
+
+/// Grid of global tile ids, row by row. Id 0 is an empty cell, the high bits
+/// of an id flip the tile, as in Tiled.
+struct TileLayer
+{
+  static constexpr std::uint32_t Flipped_Horizontally = 0x80000000u;
+  static constexpr std::uint32_t Flipped_Vertically = 0x40000000u;
+  static constexpr std::uint32_t Flipped_Diagonally = 0x20000000u;
+  static constexpr std::uint32_t Gid_Mask = 0x1FFFFFFFu;
+
+  std::string name{};
+  sf::Vector2u size{}; // In tiles.
+  std::vector<std::uint32_t> gids{};
+  float opacity{1.f};
+  bool visible{true};
+  std::vector<Property> properties{};
+  // Ids used in place from a mapped map cache, when `gids` is empty.
+  std::span<std::uint32_t const> mapped_gids{};
+
+  std::span<std::uint32_t const> getGids() const noexcept
+  {
+    if (gids.empty())
+      return mapped_gids;
+    return gids;
+  }
+};
+
+/// Shape placed on a map, e.g. a spawn point or a trigger area. Tile objects
+/// have a non null global id.
+struct MapObject
+{
+  enum class Shape : uint16_t
+  {
+    RECTANGLE,
+    ELLIPSE,
+    POINT,
+    POLYGON,
+    POLYLINE,
+    SHAPE_COUNT
+  };
+
+  std::uint32_t id{0};
+  std::string name{};
+  std::string type{};
+  std::uint32_t gid{0};
+  sf::Vector2f position{}; // In pixels.
+  sf::Vector2f size{}; // In pixels.
+  float rotation{0.f}; // In degrees, clockwise.
+  bool visible{true};
+  Shape shape{Shape::RECTANGLE};
+  std::vector<sf::Vector2f> points{}; // Of polygons, from the position.
+  std::vector<Property> properties{};
+};
+
+/// Named set of objects of a map, in drawing order.
+struct ObjectGroup
+{
+  std::string name{};
+  std::vector<MapObject> objects{};
+  std::vector<Property> properties{};
+};
+
+/// Orthogonal map of tile layers drawn from a set of tilesets, sorted by
+/// first global id.
+struct TileMap
+{
+  sf::Vector2u size{}; // In tiles.
+  sf::Vector2u tile_size{}; // Of the grid, in pixels.
+  std::vector<Tileset> tilesets{};
+  std::vector<TileLayer> layers{};
+  std::vector<ObjectGroup> object_groups{};
+  std::vector<Property> properties{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
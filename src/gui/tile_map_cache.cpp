@@ -0,0 +1,755 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "tile_map_cache.h"
+
+#include "../core/log.h"
+#include "../core/resource_exception.h"
+#include "../utils/generic_utility.h"
+#include "tile_map_loader.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace FastSimDesign {
+namespace {
+constexpr std::array<char, 8> Cache_Magic{
+    'F', 'S', 'D', 'T', 'M', 'A', 'P', '\0'};
+constexpr std::size_t Section_Alignment = 16;
+constexpr std::size_t Tile_Alignment = 64; // Tile arrays start on cache lines.
+
+enum class Section : uint16_t
+{
+  TILESETS,
+  LAYERS,
+  TILES,
+  OBJECT_GROUPS,
+  OBJECTS,
+  POINTS,
+  PROPERTIES,
+  DEPENDENCIES,
+  STRINGS,
+  SECTION_COUNT
+};
+
+struct CacheSection
+{
+  std::uint64_t offset{0};
+  std::uint64_t count{0};
+};
+
+// Size and content hash of a file the cache was compiled from.
+struct SourceStamp
+{
+  std::uint64_t size{0};
+  std::uint64_t hash{0};
+};
+
+// Characters of the string section.
+struct StringRef
+{
+  std::uint32_t offset{0};
+  std::uint32_t size{0};
+};
+
+// Records of another section.
+struct RecordRange
+{
+  std::uint32_t first{0};
+  std::uint32_t count{0};
+};
+
+struct CacheHeader
+{
+  std::array<char, 8> magic{};
+  std::uint32_t version{0};
+  std::uint32_t width{0}; // In tiles.
+  std::uint32_t height{0};
+  std::uint32_t tile_width{0};
+  std::uint32_t tile_height{0};
+  RecordRange properties{};
+  std::uint64_t size{0};
+  SourceStamp source{};
+  std::array<CacheSection, toUnderlyingType(Section::SECTION_COUNT)>
+      sections{};
+};
+
+struct TilesetRecord
+{
+  StringRef name{};
+  StringRef image{}; // From the directory of the map.
+  StringRef source{}; // From the directory of the map, empty if embedded.
+  std::uint32_t first_gid{0};
+  std::uint32_t tile_width{0};
+  std::uint32_t tile_height{0};
+  std::uint32_t columns{0};
+  std::uint32_t tile_count{0};
+  std::uint32_t spacing{0};
+  std::uint32_t margin{0};
+  RecordRange properties{};
+};
+
+struct LayerRecord
+{
+  StringRef name{};
+  std::uint32_t width{0};
+  std::uint32_t height{0};
+  std::uint64_t first_tile{0}; // In the tile section.
+  float opacity{1.f};
+  std::uint32_t visible{1};
+  RecordRange properties{};
+};
+
+struct ObjectGroupRecord
+{
+  StringRef name{};
+  RecordRange objects{};
+  RecordRange properties{};
+};
+
+struct ObjectRecord
+{
+  std::uint32_t id{0};
+  std::uint32_t gid{0};
+  StringRef name{};
+  StringRef type{};
+  float x{0.f};
+  float y{0.f};
+  float width{0.f};
+  float height{0.f};
+  float rotation{0.f};
+  std::uint32_t visible{1};
+  std::uint32_t shape{0};
+  RecordRange points{};
+  RecordRange properties{};
+};
+
+struct PointRecord
+{
+  float x{0.f};
+  float y{0.f};
+};
+
+struct PropertyRecord
+{
+  StringRef name{};
+  StringRef value{};
+  std::uint32_t type{0};
+};
+
+// External tileset of the map.
+struct DependencyRecord
+{
+  StringRef path{}; // From the directory of the map.
+  SourceStamp stamp{};
+};
+
+////////////////////////////////////////////////////////////
+/// Sources
+////////////////////////////////////////////////////////////
+// FNV-1a, enough to tell an edited file from an untouched one.
+std::uint64_t hashBytes(std::span<std::byte const> bytes) noexcept
+{
+  std::uint64_t hash = 0xCBF29CE484222325u;
+  for (std::byte byte : bytes)
+  {
+    hash ^= static_cast<std::uint64_t>(byte);
+    hash *= 0x100000001B3u;
+  }
+  return hash;
+}
+
+std::optional<std::uint64_t> hashFile(std::filesystem::path const& path)
+{
+  MappedFile file{};
+  if (!file.open(path))
+    return std::nullopt;
+  return hashBytes(file.getBytes());
+}
+
+std::optional<SourceStamp> stampFile(std::filesystem::path const& path)
+{
+  MappedFile file{};
+  if (!file.open(path))
+    return std::nullopt;
+  return SourceStamp{file.getBytes().size(), hashBytes(file.getBytes())};
+}
+
+// The write time is not trusted either way: a file checked out again has a
+// new one but the same content, and an edit can keep the old one, e.g.
+// within its resolution. The size rejects most edits without reading the
+// file, the content hash decides otherwise. It costs one pass over the
+// sources on every load, far less than parsing them.
+bool isUnchanged(
+    SourceStamp const& stamp, std::filesystem::path const& path)
+{
+  std::error_code error;
+  std::uint64_t const size = std::filesystem::file_size(path, error);
+  if (error || size != stamp.size)
+    return false;
+  return hashFile(path) == stamp.hash;
+}
+
+// Paths are kept from the directory of the map, so that the cache does not
+// depend on the working directory.
+std::string toCachedPath(
+    std::filesystem::path const& path, std::filesystem::path const& directory)
+{
+  std::filesystem::path relative = path.lexically_relative(directory);
+  return (relative.empty() ? path : relative).generic_string();
+}
+
+std::filesystem::path fromCachedPath(
+    std::string_view path, std::filesystem::path const& directory)
+{
+  if (path.empty())
+    return {};
+  return (directory / std::filesystem::path{path}).lexically_normal();
+}
+
+////////////////////////////////////////////////////////////
+/// Compilation
+////////////////////////////////////////////////////////////
+/// Flattens a map into the tables of the cache. Records refer to each other
+/// by index ranges and to their strings by offsets in one pool.
+class CacheCompiler final
+{
+public:
+  explicit CacheCompiler(std::filesystem::path const& source) noexcept
+    : m_directory{source.parent_path()}
+  {
+  }
+
+  std::vector<std::byte> compile(TileMap const& map, SourceStamp stamp)
+  {
+    CacheHeader header{};
+    header.magic = Cache_Magic;
+    header.version = TileMapCache::Cache_Version;
+    header.width = map.size.x;
+    header.height = map.size.y;
+    header.tile_width = map.tile_size.x;
+    header.tile_height = map.tile_size.y;
+    header.properties = addProperties(map.properties);
+    header.source = stamp;
+
+    for (Tileset const& tileset : map.tilesets)
+      addTileset(tileset);
+    for (ObjectGroup const& group : map.object_groups)
+      addObjectGroup(group);
+
+    // Tile arrays are laid out first so that layers know where they start.
+    std::uint64_t tile_count = 0;
+    std::size_t const tiles_per_line = Tile_Alignment / sizeof(std::uint32_t);
+    for (TileLayer const& layer : map.layers)
+    {
+      tile_count = (tile_count + tiles_per_line - 1) / tiles_per_line *
+                   tiles_per_line;
+      addLayer(layer, tile_count);
+      tile_count += layer.getGids().size();
+    }
+
+    std::vector<std::byte> blob(sizeof(CacheHeader));
+    appendSection(blob, header, Section::TILESETS, m_tilesets);
+    appendSection(blob, header, Section::LAYERS, m_layers);
+    appendSection(blob, header, Section::OBJECT_GROUPS, m_object_groups);
+    appendSection(blob, header, Section::OBJECTS, m_objects);
+    appendSection(blob, header, Section::POINTS, m_points);
+    appendSection(blob, header, Section::PROPERTIES, m_properties);
+    appendSection(blob, header, Section::DEPENDENCIES, m_dependencies);
+    appendSection(blob, header, Section::STRINGS, m_strings);
+
+    std::size_t const tiles = reserveSection(
+        blob,
+        header,
+        Section::TILES,
+        tile_count,
+        sizeof(std::uint32_t),
+        Tile_Alignment);
+    for (std::size_t i = 0; i < map.layers.size(); ++i)
+    {
+      std::span<std::uint32_t const> gids = map.layers[i].getGids();
+      if (!gids.empty())
+        std::memcpy(
+            blob.data() + tiles + m_layers[i].first_tile * sizeof(gids[0]),
+            gids.data(),
+            gids.size_bytes());
+    }
+
+    header.size = blob.size();
+    std::memcpy(blob.data(), &header, sizeof(CacheHeader));
+    return blob;
+  }
+
+private:
+  // Reserve `count` elements of `size` bytes at the end of `blob` and return
+  // their offset.
+  static std::size_t reserveSection(
+      std::vector<std::byte>& blob,
+      CacheHeader& header,
+      Section section,
+      std::size_t count,
+      std::size_t size,
+      std::size_t alignment = Section_Alignment)
+  {
+    std::size_t const offset =
+        (blob.size() + alignment - 1) / alignment * alignment;
+    blob.resize(offset + count * size);
+    header.sections[toUnderlyingType(section)] = CacheSection{offset, count};
+    return offset;
+  }
+
+  template<typename Records>
+  static void appendSection(
+      std::vector<std::byte>& blob,
+      CacheHeader& header,
+      Section section,
+      Records const& records)
+  {
+    std::size_t const offset = reserveSection(
+        blob, header, section, records.size(), sizeof(records[0]));
+    if (!records.empty())
+      std::memcpy(
+          blob.data() + offset,
+          records.data(),
+          records.size() * sizeof(records[0]));
+  }
+
+  static std::uint32_t toIndex(std::size_t index)
+  {
+    if (index > UINT32_MAX)
+      throw ResourceException{"Tile map is too large to be cached"};
+    return static_cast<std::uint32_t>(index);
+  }
+
+  StringRef addString(std::string_view text)
+  {
+    StringRef const string{toIndex(m_strings.size()), toIndex(text.size())};
+    m_strings += text;
+    return string;
+  }
+
+  RecordRange addProperties(std::vector<Property> const& properties)
+  {
+    RecordRange const range{
+        toIndex(m_properties.size()), toIndex(properties.size())};
+    for (Property const& property : properties)
+    {
+      m_properties.push_back(PropertyRecord{
+          addString(property.name),
+          addString(property.value),
+          toUnderlyingType(property.type)});
+    }
+    return range;
+  }
+
+  void addTileset(Tileset const& tileset)
+  {
+    TilesetRecord record{};
+    record.name = addString(tileset.name);
+    record.image = addString(toCachedPath(tileset.image, m_directory));
+    record.first_gid = tileset.first_gid;
+    record.tile_width = tileset.tile_size.x;
+    record.tile_height = tileset.tile_size.y;
+    record.columns = tileset.columns;
+    record.tile_count = tileset.tile_count;
+    record.spacing = tileset.spacing;
+    record.margin = tileset.margin;
+    record.properties = addProperties(tileset.properties);
+
+    if (!tileset.source.empty())
+    {
+      std::string const source = toCachedPath(tileset.source, m_directory);
+      std::optional<SourceStamp> stamp = stampFile(tileset.source);
+      if (!stamp)
+        throw ResourceException{
+            "Failed to read the tileset " + tileset.source.string()};
+      record.source = addString(source);
+      m_dependencies.push_back(DependencyRecord{record.source, *stamp});
+    }
+    m_tilesets.push_back(record);
+  }
+
+  void addLayer(TileLayer const& layer, std::uint64_t first_tile)
+  {
+    LayerRecord record{};
+    record.name = addString(layer.name);
+    record.width = layer.size.x;
+    record.height = layer.size.y;
+    record.first_tile = first_tile;
+    record.opacity = layer.opacity;
+    record.visible = layer.visible ? 1 : 0;
+    record.properties = addProperties(layer.properties);
+    m_layers.push_back(record);
+  }
+
+  void addObjectGroup(ObjectGroup const& group)
+  {
+    ObjectGroupRecord record{};
+    record.name = addString(group.name);
+    record.objects =
+        RecordRange{toIndex(m_objects.size()), toIndex(group.objects.size())};
+    record.properties = addProperties(group.properties);
+    m_object_groups.push_back(record);
+
+    for (MapObject const& object : group.objects)
+    {
+      ObjectRecord object_record{};
+      object_record.id = object.id;
+      object_record.gid = object.gid;
+      object_record.name = addString(object.name);
+      object_record.type = addString(object.type);
+      object_record.x = object.position.x;
+      object_record.y = object.position.y;
+      object_record.width = object.size.x;
+      object_record.height = object.size.y;
+      object_record.rotation = object.rotation;
+      object_record.visible = object.visible ? 1 : 0;
+      object_record.shape = toUnderlyingType(object.shape);
+      object_record.points =
+          RecordRange{toIndex(m_points.size()), toIndex(object.points.size())};
+      for (sf::Vector2f const& point : object.points)
+        m_points.push_back(PointRecord{point.x, point.y});
+      object_record.properties = addProperties(object.properties);
+      m_objects.push_back(object_record);
+    }
+  }
+
+private:
+  std::filesystem::path m_directory;
+  std::vector<TilesetRecord> m_tilesets{};
+  std::vector<LayerRecord> m_layers{};
+  std::vector<ObjectGroupRecord> m_object_groups{};
+  std::vector<ObjectRecord> m_objects{};
+  std::vector<PointRecord> m_points{};
+  std::vector<PropertyRecord> m_properties{};
+  std::vector<DependencyRecord> m_dependencies{};
+  std::string m_strings{};
+};
+
+////////////////////////////////////////////////////////////
+/// Reading
+////////////////////////////////////////////////////////////
+bool readHeader(
+    std::span<std::byte const> blob, CacheHeader& header) noexcept
+{
+  if (blob.size() < sizeof(CacheHeader))
+    return false;
+  std::memcpy(&header, blob.data(), sizeof(CacheHeader));
+  return header.magic == Cache_Magic &&
+         header.version == TileMapCache::Cache_Version &&
+         header.size == blob.size();
+}
+
+// Return an empty span if the section does not fit in the blob.
+template<typename Data>
+std::span<Data const> viewSection(
+    std::span<std::byte const> blob,
+    CacheHeader const& header,
+    Section section) noexcept
+{
+  CacheSection const& range = header.sections[toUnderlyingType(section)];
+  if (range.offset % alignof(Data) != 0 || range.offset > blob.size() ||
+      range.count > (blob.size() - range.offset) / sizeof(Data))
+    return {};
+
+  return {
+      reinterpret_cast<Data const*>(blob.data() + range.offset),
+      static_cast<std::size_t>(range.count)};
+}
+
+/// Rebuilds the map from the tables of a cache, checking every reference so
+/// that a corrupted cache is rebuilt instead of read out of bounds.
+class CacheReader final
+{
+public:
+  explicit CacheReader(
+      std::span<std::byte const> blob,
+      CacheHeader const& header,
+      std::filesystem::path const& source) noexcept
+    : m_header{header}
+    , m_directory{source.parent_path()}
+    , m_tilesets{viewSection<TilesetRecord>(blob, header, Section::TILESETS)}
+    , m_layers{viewSection<LayerRecord>(blob, header, Section::LAYERS)}
+    , m_tiles{viewSection<std::uint32_t>(blob, header, Section::TILES)}
+    , m_object_groups{viewSection<ObjectGroupRecord>(
+          blob, header, Section::OBJECT_GROUPS)}
+    , m_objects{viewSection<ObjectRecord>(blob, header, Section::OBJECTS)}
+    , m_points{viewSection<PointRecord>(blob, header, Section::POINTS)}
+    , m_properties{
+          viewSection<PropertyRecord>(blob, header, Section::PROPERTIES)}
+    , m_strings{viewSection<char>(blob, header, Section::STRINGS)}
+  {
+  }
+
+  std::optional<TileMap> read() const
+  {
+    TileMap map{};
+    map.size = sf::Vector2u{m_header.width, m_header.height};
+    map.tile_size = sf::Vector2u{m_header.tile_width, m_header.tile_height};
+    if (!readProperties(m_header.properties, map.properties))
+      return std::nullopt;
+
+    for (TilesetRecord const& record : m_tilesets)
+    {
+      Tileset& tileset = map.tilesets.emplace_back();
+      std::string image;
+      std::string source;
+      if (!readString(record.name, tileset.name) ||
+          !readString(record.image, image) ||
+          !readString(record.source, source) ||
+          !readProperties(record.properties, tileset.properties))
+        return std::nullopt;
+      tileset.image = fromCachedPath(image, m_directory);
+      tileset.source = fromCachedPath(source, m_directory);
+      tileset.first_gid = record.first_gid;
+      tileset.tile_size = sf::Vector2u{record.tile_width, record.tile_height};
+      tileset.columns = record.columns;
+      tileset.tile_count = record.tile_count;
+      tileset.spacing = record.spacing;
+      tileset.margin = record.margin;
+    }
+
+    for (LayerRecord const& record : m_layers)
+    {
+      TileLayer& layer = map.layers.emplace_back();
+      std::uint64_t const count =
+          static_cast<std::uint64_t>(record.width) * record.height;
+      if (record.first_tile > m_tiles.size() ||
+          count > m_tiles.size() - record.first_tile ||
+          !readString(record.name, layer.name) ||
+          !readProperties(record.properties, layer.properties))
+        return std::nullopt;
+      layer.size = sf::Vector2u{record.width, record.height};
+      layer.mapped_gids = m_tiles.subspan(
+          static_cast<std::size_t>(record.first_tile),
+          static_cast<std::size_t>(count));
+      layer.opacity = record.opacity;
+      layer.visible = record.visible != 0;
+    }
+
+    for (ObjectGroupRecord const& record : m_object_groups)
+    {
+      ObjectGroup& group = map.object_groups.emplace_back();
+      if (!isInRange(record.objects, m_objects.size()) ||
+          !readString(record.name, group.name) ||
+          !readProperties(record.properties, group.properties))
+        return std::nullopt;
+
+      group.objects.reserve(record.objects.count);
+      for (ObjectRecord const& object_record :
+           m_objects.subspan(record.objects.first, record.objects.count))
+      {
+        if (!readObject(object_record, group.objects.emplace_back()))
+          return std::nullopt;
+      }
+    }
+    return map;
+  }
+
+private:
+  static bool isInRange(RecordRange range, std::size_t size) noexcept
+  {
+    return range.first <= size && range.count <= size - range.first;
+  }
+
+  bool readString(StringRef string, std::string& text) const
+  {
+    if (string.offset > m_strings.size() ||
+        string.size > m_strings.size() - string.offset)
+      return false;
+    text.assign(m_strings.data() + string.offset, string.size);
+    return true;
+  }
+
+  bool readProperties(
+      RecordRange range, std::vector<Property>& properties) const
+  {
+    if (!isInRange(range, m_properties.size()))
+      return false;
+
+    properties.reserve(range.count);
+    for (PropertyRecord const& record :
+         m_properties.subspan(range.first, range.count))
+    {
+      Property& property = properties.emplace_back();
+      if (record.type >= toUnderlyingType(Property::Type::TYPE_COUNT) ||
+          !readString(record.name, property.name) ||
+          !readString(record.value, property.value))
+        return false;
+      property.type = static_cast<Property::Type>(record.type);
+    }
+    return true;
+  }
+
+  bool readObject(ObjectRecord const& record, MapObject& object) const
+  {
+    if (record.shape >= toUnderlyingType(MapObject::Shape::SHAPE_COUNT) ||
+        !isInRange(record.points, m_points.size()) ||
+        !readString(record.name, object.name) ||
+        !readString(record.type, object.type) ||
+        !readProperties(record.properties, object.properties))
+      return false;
+
+    object.id = record.id;
+    object.gid = record.gid;
+    object.position = sf::Vector2f{record.x, record.y};
+    object.size = sf::Vector2f{record.width, record.height};
+    object.rotation = record.rotation;
+    object.visible = record.visible != 0;
+    object.shape = static_cast<MapObject::Shape>(record.shape);
+    object.points.reserve(record.points.count);
+    for (PointRecord const& point :
+         m_points.subspan(record.points.first, record.points.count))
+      object.points.emplace_back(point.x, point.y);
+    return true;
+  }
+
+private:
+  CacheHeader const& m_header;
+  std::filesystem::path m_directory;
+  std::span<TilesetRecord const> m_tilesets;
+  std::span<LayerRecord const> m_layers;
+  std::span<std::uint32_t const> m_tiles;
+  std::span<ObjectGroupRecord const> m_object_groups;
+  std::span<ObjectRecord const> m_objects;
+  std::span<PointRecord const> m_points;
+  std::span<PropertyRecord const> m_properties;
+  std::span<char const> m_strings;
+};
+
+// Write next to the cache then rename, so that a crash never leaves a
+// truncated cache behind.
+bool writeCache(
+    std::filesystem::path const& path, std::vector<std::byte> const& blob)
+{
+  std::filesystem::path temporary = path;
+  temporary += ".tmp";
+  {
+    std::ofstream file{temporary, std::ios::binary | std::ios::trunc};
+    if (!file)
+      return false;
+
+    file.write(
+        reinterpret_cast<char const*>(blob.data()),
+        static_cast<std::streamsize>(blob.size()));
+    if (!file)
+      return false;
+  }
+
+  std::error_code error;
+  std::filesystem::rename(temporary, path, error);
+  if (error)
+    std::filesystem::remove(temporary, error);
+  return !error;
+}
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+void TileMapCache::load(
+    std::filesystem::path const& source,
+    std::filesystem::path const& cache,
+    WorkerPool* workers)
+{
+  // The map may view the previous cache.
+  m_map = TileMap{};
+  m_cache_file.close();
+
+  if (m_cache_file.open(cache) && isUpToDate(m_cache_file.getBytes(), source) &&
+      assign(m_cache_file.getBytes(), source))
+  {
+    LOG_INFO("Tile map mapped from {}.", cache.string());
+    return;
+  }
+  m_cache_file.close();
+
+  // Stamped before being read, so that an edit made meanwhile is seen as a
+  // change on the next load.
+  std::optional<SourceStamp> stamp = stampFile(source);
+  if (!stamp)
+    throw ResourceException{"Failed to read the tile map " + source.string()};
+  TileMap map = TileMapLoader{workers}.load(source);
+  std::vector<std::byte> const blob =
+      CacheCompiler{source}.compile(map, *stamp);
+
+  if (writeCache(cache, blob) && m_cache_file.open(cache) &&
+      assign(m_cache_file.getBytes(), source))
+  {
+    LOG_INFO(
+        "Tile map compiled from {} into {}.", source.string(), cache.string());
+    return;
+  }
+  m_cache_file.close();
+
+  LOG_WARN(
+      "Tile map cache {} could not be written, using the map from memory.",
+      cache.string());
+  m_map = std::move(map);
+}
+
+bool TileMapCache::isLoadedFromCache() const noexcept
+{
+  return m_cache_file.isOpen();
+}
+
+TileMap const& TileMapCache::getMap() const noexcept
+{
+  return m_map;
+}
+
+bool TileMapCache::isUpToDate(
+    std::span<std::byte const> blob, std::filesystem::path const& source) const
+{
+  // Stale or foreign cache: rebuild it.
+  CacheHeader header{};
+  if (!readHeader(blob, header) || !isUnchanged(header.source, source))
+    return false;
+
+  std::filesystem::path const directory = source.parent_path();
+  std::span<char const> const strings =
+      viewSection<char>(blob, header, Section::STRINGS);
+  for (DependencyRecord const& dependency :
+       viewSection<DependencyRecord>(blob, header, Section::DEPENDENCIES))
+  {
+    if (dependency.path.offset > strings.size() ||
+        dependency.path.size > strings.size() - dependency.path.offset)
+      return false;
+
+    std::string_view const path{
+        strings.data() + dependency.path.offset, dependency.path.size};
+    if (!isUnchanged(dependency.stamp, fromCachedPath(path, directory)))
+      return false;
+  }
+  return true;
+}
+
+bool TileMapCache::assign(
+    std::span<std::byte const> blob, std::filesystem::path const& source)
+{
+  CacheHeader header{};
+  if (!readHeader(blob, header))
+    return false;
+
+  std::optional<TileMap> map = CacheReader{blob, header, source}.read();
+  if (!map)
+    return false;
+  m_map = std::move(*map);
+  return true;
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_TILE_MAP_CACHE_H
+#define FAST_SIM_DESIGN_TILE_MAP_CACHE_H
+
+#include "../core/mapped_file.h"
+#include "../core/worker_pool.h"
+#include "tile_map.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace FastSimDesign {
+/// Tile map compiled from a TMX file into a binary cache.
+///
+/// The first load parses the map and writes the cache: tile arrays aligned
+/// to be used in place, tables of tilesets, layers, objects and properties,
+/// and a pool of their strings. Next loads map the cache as long as the map
+/// and its external tilesets are unchanged, judged by size and content hash,
+/// never by write time. Only the small tables are then read, tile arrays
+/// stay in the mapped file.
+class TileMapCache final
+{
+public:
+  // Bump when a record layout or the cache format changes.
+  static constexpr std::uint32_t Cache_Version = 2;
+
+public:
+  explicit TileMapCache() = default;
+  TileMapCache(TileMapCache const&) = delete;
+  TileMapCache(TileMapCache&&) = default;
+  TileMapCache& operator=(TileMapCache const&) = delete;
+  TileMapCache& operator=(TileMapCache&&) = default;
+  virtual ~TileMapCache() = default;
+
+  // Map the cache if it is up to date with the map, otherwise load the map,
+  // on `workers` if given, and rewrite the cache. Throw a ResourceException
+  // if the map can not be read or is invalid.
+  void load(
+      std::filesystem::path const& source,
+      std::filesystem::path const& cache,
+      WorkerPool* workers = nullptr);
+  bool isLoadedFromCache() const noexcept;
+  // Tile arrays of a mapped cache are valid until the next load.
+  TileMap const& getMap() const noexcept;
+
+private:
+  bool isUpToDate(
+      std::span<std::byte const> blob,
+      std::filesystem::path const& source) const;
+  bool assign(
+      std::span<std::byte const> blob, std::filesystem::path const& source);
+
+private:
+  MappedFile m_cache_file{};
+  TileMap m_map{};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,872 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "tile_map_loader.h"
+
+#include "../core/log.h"
+#include "../core/mapped_file.h"
+#include "../core/resource_exception.h"
+#include "../utils/base64_util.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace FastSimDesign {
+namespace {
+constexpr std::string_view Whitespaces = " \t\r\n";
+
+constexpr std::string_view Property_Type_Names[]{
+    "string", "int", "float", "bool", "color", "file", "object", "class"};
+static_assert(
+    std::size(Property_Type_Names) ==
+        static_cast<std::size_t>(Property::Type::TYPE_COUNT),
+    "Property_Type_Names must have one entry per Property::Type.");
+
+std::string_view trim(std::string_view text) noexcept
+{
+  std::size_t first = text.find_first_not_of(Whitespaces);
+  if (first == std::string_view::npos)
+    return {};
+  std::size_t last = text.find_last_not_of(Whitespaces);
+  return text.substr(first, last - first + 1);
+}
+
+////////////////////////////////////////////////////////////
+/// Decoding
+////////////////////////////////////////////////////////////
+enum class Encoding : uint16_t
+{
+  XML,
+  CSV,
+  BASE64,
+  ENCODING_COUNT
+};
+
+enum class Compression : uint16_t
+{
+  NONE,
+  ZLIB, // Also gzip, told apart by their headers.
+  COMPRESSION_COUNT
+};
+
+// Inflate zlib or gzip `input` to exactly fill `output`.
+bool inflateData(
+    std::span<std::uint8_t const> input,
+    std::span<std::uint8_t> output) noexcept
+{
+  z_stream stream{};
+  // 32 lets zlib detect a zlib or a gzip header.
+  if (inflateInit2(&stream, MAX_WBITS + 32) != Z_OK)
+    return false;
+
+  stream.next_in = const_cast<Bytef*>(input.data());
+  stream.avail_in = static_cast<uInt>(input.size());
+  stream.next_out = output.data();
+  stream.avail_out = static_cast<uInt>(output.size());
+  int const result = inflate(&stream, Z_FINISH);
+  bool const is_complete =
+      result == Z_STREAM_END && stream.total_out == output.size();
+  inflateEnd(&stream);
+  return is_complete;
+}
+
+// Parse comma separated global ids to `gids`, which must be filled exactly.
+bool parseCsv(std::string_view text, std::span<std::uint32_t> gids) noexcept
+{
+  char const* position = text.data();
+  char const* const end = text.data() + text.size();
+  std::size_t count = 0;
+  while (true)
+  {
+    while (position != end &&
+           (*position == ',' ||
+            Whitespaces.find(*position) != std::string_view::npos))
+      ++position;
+    if (position == end)
+      break;
+    if (count == gids.size())
+      return false;
+
+    auto [next, error] = std::from_chars(position, end, gids[count++]);
+    if (error != std::errc{})
+      return false;
+    position = next;
+  }
+  return count == gids.size();
+}
+
+// Tile data of a layer, decoded once the whole file is read.
+struct LayerData
+{
+  std::size_t layer{0}; // In the layers of the map.
+  std::string_view text{};
+  Encoding encoding{Encoding::BASE64};
+  Compression compression{Compression::NONE};
+};
+
+// Return an error message, empty when the data is decoded.
+std::string decodeLayer(LayerData const& data, TileLayer& layer)
+{
+  std::size_t const count =
+      static_cast<std::size_t>(layer.size.x) * layer.size.y;
+  layer.gids.resize(count);
+  std::span<std::uint8_t> bytes{
+      reinterpret_cast<std::uint8_t*>(layer.gids.data()),
+      count * sizeof(std::uint32_t)};
+
+  if (data.encoding == Encoding::CSV)
+  {
+    if (!parseCsv(data.text, layer.gids))
+      return "invalid CSV data of layer '" + layer.name + "'";
+    return {};
+  }
+
+  // Global ids are little endian 32 bit integers, compressed or not.
+  std::string_view const text = trim(data.text);
+  if (data.compression == Compression::NONE)
+  {
+    std::optional<std::size_t> size = Base64::decode(text, bytes);
+    if (!size || *size != bytes.size())
+      return "invalid base64 data of layer '" + layer.name + "'";
+  }
+  else
+  {
+    std::vector<std::uint8_t> compressed(text.size() / 4 * 3 + 3);
+    std::optional<std::size_t> size = Base64::decode(text, compressed);
+    if (!size)
+      return "invalid base64 data of layer '" + layer.name + "'";
+    if (!inflateData(std::span{compressed.data(), *size}, bytes))
+      return "invalid compressed data of layer '" + layer.name + "'";
+  }
+
+  if constexpr (std::endian::native == std::endian::big)
+  {
+    for (std::uint32_t& gid : layer.gids)
+    {
+      gid = ((gid & 0xFFu) << 24) | ((gid & 0xFF00u) << 8) |
+            ((gid >> 8) & 0xFF00u) | (gid >> 24);
+    }
+  }
+  return {};
+}
+
+////////////////////////////////////////////////////////////
+/// XML
+////////////////////////////////////////////////////////////
+/// Pull reader over a whole XML document, without copy. Each call to next()
+/// moves to the next start or end tag, an empty element tag being read as
+/// both, and keeps the text read before it. Attribute values and texts are
+/// raw: entities are decoded by decodeEntities() where they can appear.
+class XmlReader final
+{
+public:
+  enum class Node : uint16_t
+  {
+    START,
+    END,
+    DOCUMENT_END,
+    NODE_COUNT
+  };
+
+public:
+  explicit XmlReader(
+      std::string_view document, std::filesystem::path const& path) noexcept
+    : m_document{document}
+    , m_path{path}
+  {
+  }
+
+  Node next()
+  {
+    if (m_is_pending_end)
+    {
+      m_is_pending_end = false;
+      m_text = {};
+      return Node::END;
+    }
+
+    std::size_t text_start = m_position;
+    while (true)
+    {
+      std::size_t const open = m_document.find('<', m_position);
+      if (open == std::string_view::npos)
+      {
+        m_text = m_document.substr(text_start);
+        m_position = m_document.size();
+        return Node::DOCUMENT_END;
+      }
+      m_text = m_document.substr(text_start, open - text_start);
+      m_position = open + 1;
+
+      // Declarations, comments and doctypes are skipped.
+      if (skipMarkup("?", "?>") || skipMarkup("!--", "-->") ||
+          skipMarkup("![CDATA[", "]]>") || skipMarkup("!", ">"))
+      {
+        text_start = m_position;
+        continue;
+      }
+
+      if (m_document.substr(m_position, 1) == "/")
+      {
+        std::size_t const close = m_document.find('>', m_position);
+        if (close == std::string_view::npos)
+          fail("unterminated end tag");
+        m_name =
+            trim(m_document.substr(m_position + 1, close - m_position - 1));
+        m_position = close + 1;
+        return Node::END;
+      }
+      readStartTag();
+      return Node::START;
+    }
+  }
+
+  std::string_view getName() const noexcept { return m_name; }
+  // Text between the previous tag and the current one.
+  std::string_view getText() const noexcept { return m_text; }
+
+  std::optional<std::string_view> findAttribute(
+      std::string_view name) const noexcept
+  {
+    for (auto const& [key, value] : m_attributes)
+    {
+      if (key == name)
+        return value;
+    }
+    return std::nullopt;
+  }
+
+  // Skip the content of the current start tag, up to its end tag.
+  void skipElement()
+  {
+    std::size_t depth = 1;
+    while (depth > 0)
+    {
+      switch (next())
+      {
+        case Node::START:
+          ++depth;
+          break;
+        case Node::END:
+          --depth;
+          break;
+        default:
+          fail("unexpected end of document");
+      }
+    }
+  }
+
+  [[noreturn]] void fail(std::string const& message) const
+  {
+    std::string_view const read =
+        m_document.substr(0, std::min(m_position, m_document.size()));
+    std::size_t const line =
+        1 + static_cast<std::size_t>(
+                std::count(read.begin(), read.end(), '\n'));
+    throw ResourceException{
+        m_path.string() + ":" + std::to_string(line) + ": " + message};
+  }
+
+private:
+  bool skipMarkup(std::string_view open, std::string_view close)
+  {
+    if (m_document.substr(m_position, open.size()) != open)
+      return false;
+    std::size_t const end = m_document.find(close, m_position + open.size());
+    if (end == std::string_view::npos)
+      fail("unterminated markup");
+    m_position = end + close.size();
+    return true;
+  }
+
+  void skipWhitespaces() noexcept
+  {
+    while (m_position < m_document.size() &&
+           Whitespaces.find(m_document[m_position]) != std::string_view::npos)
+      ++m_position;
+  }
+
+  std::string_view readName() noexcept
+  {
+    std::size_t const start = m_position;
+    while (m_position < m_document.size() &&
+           std::string_view{" \t\r\n/>="}.find(m_document[m_position]) ==
+               std::string_view::npos)
+      ++m_position;
+    return m_document.substr(start, m_position - start);
+  }
+
+  void readStartTag()
+  {
+    m_name = readName();
+    if (m_name.empty())
+      fail("missing tag name");
+
+    m_attributes.clear();
+    while (true)
+    {
+      skipWhitespaces();
+      if (m_position >= m_document.size())
+        fail("unterminated start tag");
+
+      char const character = m_document[m_position];
+      if (character == '>')
+      {
+        ++m_position;
+        return;
+      }
+      if (character == '/')
+      {
+        if (m_document.substr(m_position, 2) != "/>")
+          fail("expected '/>'");
+        m_position += 2;
+        m_is_pending_end = true;
+        return;
+      }
+
+      std::string_view const key = readName();
+      skipWhitespaces();
+      if (key.empty() || m_document.substr(m_position, 1) != "=")
+        fail("expected an attribute in tag '" + std::string{m_name} + "'");
+      ++m_position;
+      skipWhitespaces();
+
+      char const quote =
+          m_position < m_document.size() ? m_document[m_position] : '\0';
+      if (quote != '"' && quote != '\'')
+        fail("expected a quoted attribute value");
+      std::size_t const end = m_document.find(quote, m_position + 1);
+      if (end == std::string_view::npos)
+        fail("unterminated attribute value");
+      m_attributes.emplace_back(
+          key, m_document.substr(m_position + 1, end - m_position - 1));
+      m_position = end + 1;
+    }
+  }
+
+private:
+  std::string_view m_document;
+  std::filesystem::path const& m_path;
+  std::size_t m_position{0};
+  std::string_view m_name{};
+  std::string_view m_text{};
+  // Kept allocated from tag to tag.
+  std::vector<std::pair<std::string_view, std::string_view>> m_attributes{};
+  bool m_is_pending_end{false};
+};
+
+void appendUtf8(std::string& text, std::uint32_t code_point)
+{
+  if (code_point < 0x80)
+    text += static_cast<char>(code_point);
+  else if (code_point < 0x800)
+  {
+    text += static_cast<char>(0xC0 | (code_point >> 6));
+    text += static_cast<char>(0x80 | (code_point & 0x3F));
+  }
+  else if (code_point < 0x10000)
+  {
+    text += static_cast<char>(0xE0 | (code_point >> 12));
+    text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    text += static_cast<char>(0x80 | (code_point & 0x3F));
+  }
+  else
+  {
+    text += static_cast<char>(0xF0 | (code_point >> 18));
+    text += static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+    text += static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+    text += static_cast<char>(0x80 | (code_point & 0x3F));
+  }
+}
+
+// Replace the predefined and numeric entities of `raw`. Unknown entities are
+// kept as written.
+std::string decodeEntities(std::string_view raw)
+{
+  std::string text;
+  text.reserve(raw.size());
+  while (!raw.empty())
+  {
+    std::size_t const ampersand = raw.find('&');
+    text += raw.substr(0, ampersand);
+    if (ampersand == std::string_view::npos)
+      break;
+    raw = raw.substr(ampersand);
+
+    std::size_t const semicolon = raw.find(';');
+    std::string_view const entity =
+        semicolon == std::string_view::npos ? raw.substr(0, 1)
+                                            : raw.substr(1, semicolon - 1);
+    std::uint32_t code_point = 0;
+    if (entity == "amp")
+      text += '&';
+    else if (entity == "lt")
+      text += '<';
+    else if (entity == "gt")
+      text += '>';
+    else if (entity == "quot")
+      text += '"';
+    else if (entity == "apos")
+      text += '\'';
+    else if (
+        entity.size() > 1 && entity.front() == '#' &&
+        std::from_chars(
+            entity.data() + (entity[1] == 'x' ? 2 : 1),
+            entity.data() + entity.size(),
+            code_point,
+            entity[1] == 'x' ? 16 : 10)
+                .ec == std::errc{})
+      appendUtf8(text, code_point);
+    else
+    {
+      text += '&';
+      raw = raw.substr(1);
+      continue;
+    }
+    raw = raw.substr(semicolon + 1);
+  }
+  return text;
+}
+
+////////////////////////////////////////////////////////////
+/// Parsing
+////////////////////////////////////////////////////////////
+/// Reads the elements of a TMX or a TSX file. Tile data is only located, to
+/// be decoded once the whole file is read.
+class TmxParser final
+{
+public:
+  explicit TmxParser(
+      std::string_view document, std::filesystem::path const& path)
+    : m_reader{document, path}
+    , m_path{path}
+  {
+  }
+
+  TileMap parseMap(std::vector<LayerData>& layer_data)
+  {
+    readRoot("map");
+    if (getString("orientation", "orthogonal") != "orthogonal")
+      m_reader.fail("only orthogonal maps are supported");
+    if (getNumber<int>("infinite", 0) != 0)
+      m_reader.fail("infinite maps are not supported");
+
+    TileMap map{};
+    map.size = sf::Vector2u{
+        requireNumber<unsigned>("width"), requireNumber<unsigned>("height")};
+    map.tile_size = sf::Vector2u{
+        requireNumber<unsigned>("tilewidth"),
+        requireNumber<unsigned>("tileheight")};
+    parseMapContent(map, &map.properties, layer_data);
+
+    std::stable_sort(
+        map.tilesets.begin(),
+        map.tilesets.end(),
+        [](Tileset const& left, Tileset const& right) {
+          return left.first_gid < right.first_gid;
+        });
+    return map;
+  }
+
+  Tileset parseExternalTileset(std::uint32_t first_gid)
+  {
+    readRoot("tileset");
+    Tileset tileset{};
+    parseTileset(tileset);
+    tileset.first_gid = first_gid;
+    return tileset;
+  }
+
+private:
+  void readRoot(std::string_view name)
+  {
+    if (m_reader.next() != XmlReader::Node::START ||
+        m_reader.getName() != name)
+      m_reader.fail("expected a root element '" + std::string{name} + "'");
+  }
+
+  std::string_view getString(
+      std::string_view name, std::string_view fallback = {}) const noexcept
+  {
+    return m_reader.findAttribute(name).value_or(fallback);
+  }
+
+  template<typename T>
+  T toNumber(std::string_view text) const
+  {
+    T value{};
+    auto [end, error] =
+        std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{} || end != text.data() + text.size())
+      m_reader.fail("'" + std::string{text} + "' is not a valid number");
+    return value;
+  }
+
+  template<typename T>
+  T getNumber(std::string_view name, T fallback) const
+  {
+    std::optional<std::string_view> value = m_reader.findAttribute(name);
+    return value ? toNumber<T>(*value) : fallback;
+  }
+
+  template<typename T>
+  T requireNumber(std::string_view name) const
+  {
+    std::optional<std::string_view> value = m_reader.findAttribute(name);
+    if (!value)
+      m_reader.fail("missing attribute '" + std::string{name} + "'");
+    return toNumber<T>(*value);
+  }
+
+  // Read the children of the current element up to its end tag, with
+  // `handle(name)` for each child start tag. Unhandled children are skipped.
+  template<typename Handler>
+  void forEachChild(Handler&& handle)
+  {
+    while (true)
+    {
+      switch (m_reader.next())
+      {
+        case XmlReader::Node::START:
+          if (!handle(m_reader.getName()))
+            m_reader.skipElement();
+          break;
+        case XmlReader::Node::END:
+          return;
+        default:
+          m_reader.fail("unexpected end of document");
+      }
+    }
+  }
+
+  // Layers of groups are flattened in the map, in drawing order.
+  void parseMapContent(
+      TileMap& map,
+      std::vector<Property>* properties,
+      std::vector<LayerData>& layer_data)
+  {
+    forEachChild([&](std::string_view name) {
+      if (name == "properties" && properties)
+        parseProperties(*properties);
+      else if (name == "tileset")
+        parseMapTileset(map);
+      else if (name == "layer")
+        parseLayer(map, layer_data);
+      else if (name == "objectgroup")
+        parseObjectGroup(map.object_groups.emplace_back());
+      else if (name == "group")
+        parseMapContent(map, nullptr, layer_data);
+      else
+        return false;
+      return true;
+    });
+  }
+
+  void parseProperties(std::vector<Property>& properties)
+  {
+    forEachChild([&](std::string_view name) {
+      if (name != "property")
+        return false;
+
+      Property& property = properties.emplace_back();
+      property.name = decodeEntities(getString("name"));
+      std::string_view const type = getString("type", "string");
+      auto it = std::find(
+          std::begin(Property_Type_Names), std::end(Property_Type_Names), type);
+      if (it == std::end(Property_Type_Names))
+        m_reader.fail("unknown property type '" + std::string{type} + "'");
+      property.type = static_cast<Property::Type>(
+          std::distance(std::begin(Property_Type_Names), it));
+
+      // Multiline strings are written as the text of the element.
+      std::optional<std::string_view> value = m_reader.findAttribute("value");
+      if (value)
+        property.value = decodeEntities(*value);
+      forEachChild([](std::string_view) { return false; });
+      if (!value)
+        property.value = decodeEntities(m_reader.getText());
+      return true;
+    });
+  }
+
+  void parseMapTileset(TileMap& map)
+  {
+    std::uint32_t const first_gid = requireNumber<std::uint32_t>("firstgid");
+    std::optional<std::string_view> source = m_reader.findAttribute("source");
+    if (!source)
+    {
+      Tileset& tileset = map.tilesets.emplace_back();
+      parseTileset(tileset);
+      tileset.first_gid = first_gid;
+      return;
+    }
+
+    std::filesystem::path const path =
+        (m_path.parent_path() / decodeEntities(*source)).lexically_normal();
+    m_reader.skipElement();
+
+    MappedFile file{};
+    if (!file.open(path))
+      m_reader.fail("tileset '" + path.string() + "' can not be read");
+    std::span<std::byte const> bytes = file.getBytes();
+    TmxParser parser{
+        std::string_view{
+            reinterpret_cast<char const*>(bytes.data()), bytes.size()},
+        path};
+    map.tilesets.push_back(parser.parseExternalTileset(first_gid));
+    map.tilesets.back().source = path;
+  }
+
+  void parseTileset(Tileset& tileset)
+  {
+    tileset.name = decodeEntities(getString("name"));
+    tileset.tile_size = sf::Vector2u{
+        requireNumber<unsigned>("tilewidth"),
+        requireNumber<unsigned>("tileheight")};
+    tileset.columns = getNumber<std::uint32_t>("columns", 1);
+    tileset.tile_count = getNumber<std::uint32_t>("tilecount", 0);
+    tileset.spacing = getNumber<std::uint32_t>("spacing", 0);
+    tileset.margin = getNumber<std::uint32_t>("margin", 0);
+
+    forEachChild([&](std::string_view name) {
+      if (name == "image")
+      {
+        tileset.image = (m_path.parent_path() /
+                         decodeEntities(getString("source")))
+                            .lexically_normal();
+        return false;
+      }
+      if (name != "properties")
+        return false;
+      parseProperties(tileset.properties);
+      return true;
+    });
+  }
+
+  void parseLayer(TileMap& map, std::vector<LayerData>& layer_data)
+  {
+    TileLayer& layer = map.layers.emplace_back();
+    layer.name = decodeEntities(getString("name"));
+    layer.size = sf::Vector2u{
+        getNumber<unsigned>("width", map.size.x),
+        getNumber<unsigned>("height", map.size.y)};
+    layer.opacity = getNumber<float>("opacity", 1.f);
+    layer.visible = getNumber<int>("visible", 1) != 0;
+
+    bool has_data = false;
+    forEachChild([&](std::string_view name) {
+      if (name == "properties")
+        parseProperties(layer.properties);
+      else if (name == "data")
+      {
+        parseData(map.layers.size() - 1, layer, layer_data);
+        has_data = true;
+      }
+      else
+        return false;
+      return true;
+    });
+    if (!has_data)
+      m_reader.fail("layer '" + layer.name + "' has no data");
+  }
+
+  void parseData(
+      std::size_t index, TileLayer& layer, std::vector<LayerData>& layer_data)
+  {
+    std::string_view const encoding = getString("encoding");
+    std::string_view const compression = getString("compression");
+
+    LayerData data{};
+    data.layer = index;
+    if (encoding.empty())
+      data.encoding = Encoding::XML;
+    else if (encoding == "csv")
+      data.encoding = Encoding::CSV;
+    else if (encoding == "base64")
+      data.encoding = Encoding::BASE64;
+    else
+      m_reader.fail("unknown encoding '" + std::string{encoding} + "'");
+
+    if (compression == "zlib" || compression == "gzip")
+      data.compression = Compression::ZLIB;
+    else if (!compression.empty())
+      m_reader.fail("unsupported compression '" + std::string{compression} +
+                    "'");
+
+    // Deprecated XML tiles are read right away.
+    if (data.encoding == Encoding::XML)
+    {
+      layer.gids.reserve(static_cast<std::size_t>(layer.size.x) * layer.size.y);
+      forEachChild([&](std::string_view name) {
+        if (name == "chunk")
+          m_reader.fail("infinite maps are not supported");
+        if (name == "tile")
+          layer.gids.push_back(getNumber<std::uint32_t>("gid", 0));
+        return false;
+      });
+      if (layer.gids.size() !=
+          static_cast<std::size_t>(layer.size.x) * layer.size.y)
+        m_reader.fail("wrong tile count in layer '" + layer.name + "'");
+      return;
+    }
+
+    forEachChild([&](std::string_view name) -> bool {
+      m_reader.fail("unexpected element '" + std::string{name} + "' in data");
+    });
+    data.text = m_reader.getText();
+    layer_data.push_back(data);
+  }
+
+  void parseObjectGroup(ObjectGroup& group)
+  {
+    group.name = decodeEntities(getString("name"));
+    forEachChild([&](std::string_view name) {
+      if (name == "properties")
+        parseProperties(group.properties);
+      else if (name == "object")
+        parseObject(group.objects.emplace_back());
+      else
+        return false;
+      return true;
+    });
+  }
+
+  void parseObject(MapObject& object)
+  {
+    object.id = getNumber<std::uint32_t>("id", 0);
+    object.name = decodeEntities(getString("name"));
+    // Renamed from type to class by Tiled 1.9.
+    object.type = decodeEntities(getString("type", getString("class")));
+    object.gid = getNumber<std::uint32_t>("gid", 0);
+    object.position =
+        sf::Vector2f{getNumber<float>("x", 0.f), getNumber<float>("y", 0.f)};
+    object.size = sf::Vector2f{
+        getNumber<float>("width", 0.f), getNumber<float>("height", 0.f)};
+    object.rotation = getNumber<float>("rotation", 0.f);
+    object.visible = getNumber<int>("visible", 1) != 0;
+
+    forEachChild([&](std::string_view name) {
+      if (name == "properties")
+      {
+        parseProperties(object.properties);
+        return true;
+      }
+      if (name == "ellipse")
+        object.shape = MapObject::Shape::ELLIPSE;
+      else if (name == "point")
+        object.shape = MapObject::Shape::POINT;
+      else if (name == "polygon" || name == "polyline")
+      {
+        object.shape = name == "polygon" ? MapObject::Shape::POLYGON
+                                         : MapObject::Shape::POLYLINE;
+        parsePoints(getString("points"), object.points);
+      }
+      return false;
+    });
+  }
+
+  // Points written as "x,y x,y ...".
+  void parsePoints(std::string_view text, std::vector<sf::Vector2f>& points)
+  {
+    while (!(text = trim(text)).empty())
+    {
+      std::size_t const end = text.find_first_of(Whitespaces);
+      std::string_view const point = text.substr(0, end);
+      std::size_t const comma = point.find(',');
+      if (comma == std::string_view::npos)
+        m_reader.fail("expected points as 'x,y x,y'");
+      points.emplace_back(
+          toNumber<float>(point.substr(0, comma)),
+          toNumber<float>(point.substr(comma + 1)));
+      text = end == std::string_view::npos ? std::string_view{}
+                                           : text.substr(end);
+    }
+  }
+
+private:
+  XmlReader m_reader;
+  std::filesystem::path const& m_path;
+};
+} // namespace
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+TileMapLoader::TileMapLoader(WorkerPool* workers) noexcept
+  : m_workers{workers}
+{
+}
+
+TileMap TileMapLoader::load(std::filesystem::path const& path) const
+{
+  MappedFile file{};
+  if (!file.open(path))
+    throw ResourceException{"Failed to read the tile map " + path.string()};
+  std::span<std::byte const> bytes = file.getBytes();
+
+  // Tile data points into the mapped file, which is kept open until decoded.
+  std::vector<LayerData> layer_data;
+  TmxParser parser{
+      std::string_view{
+          reinterpret_cast<char const*>(bytes.data()), bytes.size()},
+      path};
+  TileMap map = parser.parseMap(layer_data);
+
+  std::vector<std::string> errors(layer_data.size());
+  auto decode = [&](std::size_t i) noexcept {
+    try
+    {
+      errors[i] = decodeLayer(layer_data[i], map.layers[layer_data[i].layer]);
+    }
+    catch (std::exception const& exception)
+    {
+      errors[i] = exception.what();
+    }
+  };
+  if (m_workers && layer_data.size() > 1)
+  {
+    TaskGroup tasks{};
+    for (std::size_t i = 0; i < layer_data.size(); ++i)
+      m_workers->submit(tasks, [&decode, i]() { decode(i); });
+    m_workers->wait(tasks);
+  }
+  else
+  {
+    for (std::size_t i = 0; i < layer_data.size(); ++i)
+      decode(i);
+  }
+
+  for (std::string const& error : errors)
+  {
+    if (!error.empty())
+      throw ResourceException{path.string() + ": " + error};
+  }
+
+  LOG_INFO(
+      "Tile map {} loaded: {}x{} tiles, {} layers, {} object groups.",
+      path.string(),
+      map.size.x,
+      map.size.y,
+      map.layers.size(),
+      map.object_groups.size());
+  return map;
+}
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_TILE_MAP_LOADER_H
+#define FAST_SIM_DESIGN_TILE_MAP_LOADER_H
+
+#include "../core/worker_pool.h"
+#include "tile_map.h"
+
+#include <filesystem>
+
+namespace FastSimDesign {
+/// Loads maps edited with Tiled, from TMX files and the TSX files of their
+/// external tilesets. Only orthogonal and finite maps are supported.
+///
+/// The XML is read in one streaming pass over the mapped file. Tile data, as
+/// CSV or as base64 optionally compressed with zlib or gzip, is decoded
+/// afterwards, one layer per task when a worker pool is given. Textures of
+/// the tilesets are left to the caller, from their image paths.
+class TileMapLoader final
+{
+public:
+  explicit TileMapLoader(WorkerPool* workers = nullptr) noexcept;
+  TileMapLoader(TileMapLoader const&) = default;
+  TileMapLoader(TileMapLoader&&) = default;
+  TileMapLoader& operator=(TileMapLoader const&) = default;
+  TileMapLoader& operator=(TileMapLoader&&) = default;
+  virtual ~TileMapLoader() = default;
+
+  // Throw a ResourceException if the map or one of its tilesets can not be
+  // read or is invalid.
+  TileMap load(std::filesystem::path const& path) const;
+
+private:
+  WorkerPool* m_workers{nullptr};
+};
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
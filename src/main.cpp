@@ -11,20 +11,102 @@
 #include "core/application.h"
 #include "core/log.h"
 
+#include <cstddef>
+#include <cstdlib>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
 
-int main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[])
+namespace {
+using FastSimDesign::Configuration;
+using FastSimDesign::GoldenFrameMode;
+using FastSimDesign::HeadlessSettings;
+
+Configuration::CaptureFormat toCaptureFormat(std::string_view name)
+{
+  if (name == "none")
+    return Configuration::CaptureFormat::NONE;
+  if (name == "png")
+    return Configuration::CaptureFormat::PNG;
+  if (name == "raw_zlib")
+    return Configuration::CaptureFormat::RAW_ZLIB;
+  throw std::invalid_argument{"Unknown capture format " + std::string{name}};
+}
+
+// `--capture <none|png|raw_zlib>` records the world frames to
+// `--capture-directory <dir>`. `--headless <frames>`, first, simulates
+// without window: then `--record <dir>` saves a golden frame every
+// `--golden-interval <frames>` (60 by default) and `--compare <dir>` checks
+// the frames against them, within `--tolerance <value>` per channel.
+void parseArguments(
+    int argc,
+    char* argv[],
+    Configuration& config,
+    HeadlessSettings* headless_settings)
+{
+  for (int i = headless_settings ? 3 : 1; i < argc; i += 2)
+  {
+    std::string_view const option{argv[i]};
+    if (i + 1 == argc)
+      throw std::invalid_argument{"Missing value of " + std::string{option}};
+
+    char const* value = argv[i + 1];
+    if (option == "--capture")
+      config.capture_format = toCaptureFormat(value);
+    else if (option == "--capture-directory")
+      config.capture_directory = value;
+    else if (!headless_settings)
+      throw std::invalid_argument{"Unknown option " + std::string{option}};
+    else if (option == "--record" || option == "--compare")
+    {
+      headless_settings->golden_directory = value;
+      headless_settings->golden_mode = option == "--record"
+                                           ? GoldenFrameMode::RECORD
+                                           : GoldenFrameMode::COMPARE;
+    }
+    else if (option == "--golden-interval")
+      headless_settings->golden_interval =
+          static_cast<std::size_t>(std::stoull(value));
+    else if (option == "--tolerance")
+      headless_settings->tolerance = static_cast<unsigned>(std::stoul(value));
+    else
+      throw std::invalid_argument{"Unknown option " + std::string{option}};
+  }
+}
+} // namespace
+
+int main(int argc, char* argv[])
 {
+  int status = EXIT_SUCCESS;
   try
   {
     FastSimDesign::Log::init();
-    FastSimDesign::Application::launch(FastSimDesign::Application{});
+    Configuration config{};
+    if (argc >= 3 && std::string_view{argv[1]} == "--headless")
+    {
+      HeadlessSettings settings{};
+      settings.frame_count = static_cast<std::size_t>(std::stoull(argv[2]));
+      parseArguments(argc, argv, config, &settings);
+
+      // Frames differing from their golden frame fail the run.
+      if (!FastSimDesign::Application::launchHeadless(settings, config))
+        status = EXIT_FAILURE;
+    }
+    else
+    {
+      parseArguments(argc, argv, config, nullptr);
+      FastSimDesign::Application::launch(
+          FastSimDesign::Application{}, std::move(config));
+    }
     FastSimDesign::Log::shutdown();
   }
   catch (std::exception const& e)
   {
     std::cout << "\nException: " << e.what() << std::endl;
+    status = EXIT_FAILURE;
   }
 
-  return 0;
-}
+  return status;
+}
\ No newline at end of file
@@ -14,11 +14,16 @@
 #define FAST_SIM_DESIGN_FRAME_H
 
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
 
+namespace sf {
+class RenderTexture;
+}
 namespace FastSimDesign {
 namespace SimMonitor {
 struct Frame
@@ -39,6 +44,8 @@ struct Frame
 
     std::string category = "UNKNOWN";
     std::string type = "NO TYPE";
+    std::uint32_t handle_index = 0;
+    std::uint32_t handle_generation = 0;
     SceneNode* m_parent = nullptr;
     std::vector<Ptr> m_children;
 
@@ -48,6 +55,20 @@ struct Frame
 
   struct World
   {
+    std::size_t entity_count = 0;
+    std::size_t archetype_count = 0;
+    std::size_t collision_count = 0;
+    std::size_t destroyed_count = 0;
+    std::size_t collected_pickup_count = 0;
+    float camera_zoom = 1.f;
+    float camera_max_zoom = 1.f;
+    std::size_t lod_quad_count = 0;
+    std::size_t lod_point_count = 0;
+  };
+
+  struct Minimap
+  {
+    sf::RenderTexture const* texture = nullptr; // Null when not available.
   };
 
   StateMachine state_stack;
@@ -11,10 +11,13 @@
 #include "monitor.h"
 
 #include "style_spectrum.h"
+#include "window/camera_window.h"
 #include "window/controller_window.h"
 #include "window/log_window.h"
+#include "window/minimap_window.h"
 #include "window/scene_graph_window.h"
 #include "window/state_machine_window.h"
+#include "window/telemetry_window.h"
 
 #include <imgui-SFML.h>
 #include <imgui_internal.h>
@@ -32,6 +35,9 @@ Monitor::Monitor() noexcept
   createWindow<LogWindow>(Window::ID::LOG);
   createWindow<StateMachineWindow>(Window::ID::STATE_MACHINE);
   createWindow<SceneGraphWindow>(Window::ID::SCENE_GRAPH);
+  createWindow<CameraWindow>(Window::ID::CAMERA);
+  createWindow<TelemetryWindow>(Window::ID::TELEMETRY);
+  createWindow<MinimapWindow>(Window::ID::MINIMAP);
 }
 
 void Monitor::initImGui(
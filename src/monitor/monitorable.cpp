@@ -41,6 +41,11 @@ void Monitorable::monitorState(Monitor&, Frame::World&) const
   // Do nothing by default.
 }
 
+void Monitorable::monitorState(Monitor&, Frame::Minimap&) const
+{
+  // Do nothing by default.
+}
+
 void Monitorable::monitorState(Monitor&, Frame::SceneNode&) const
 {
   // Do nothing by default.
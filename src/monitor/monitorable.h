@@ -35,6 +35,8 @@ public:
   virtual void monitorState(
       Monitor& monitor, Frame::StateMachineState& frame_object) const;
   virtual void monitorState(Monitor& monitor, Frame::World& frame_object) const;
+  virtual void monitorState(
+      Monitor& monitor, Frame::Minimap& frame_object) const;
   virtual void monitorState(
       Monitor& monitor, Frame::SceneNode& frame_object) const;
 };
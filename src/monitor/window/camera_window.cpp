@@ -0,0 +1,69 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "camera_window.h"
+
+#include "../../gui/camera.h"
+#include "../monitorable.h"
+
+#include <imgui.h>
+
+#include <utility>
+
+namespace FastSimDesign {
+namespace SimMonitor {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+CameraWindow::CameraWindow(Monitor* monitor) noexcept
+  : Parent{monitor, "Camera Window", true}
+{
+  show();
+}
+
+std::optional<float> CameraWindow::takeZoomRequest() noexcept
+{
+  return std::exchange(m_zoom_request, std::nullopt);
+}
+
+void CameraWindow::updateMenuBar(sf::Time const&) {}
+
+void CameraWindow::updateContentArea(sf::Time const&)
+{
+  // Get model data.
+  Frame::World frame_world;
+  m_data_model->monitorState(*m_monitor, frame_world);
+
+  // Draw data.
+  float zoom = frame_world.camera_zoom;
+  if (ImGui::SliderFloat(
+          "Zoom",
+          &zoom,
+          Camera::Min_Zoom,
+          frame_world.camera_max_zoom,
+          "%.2f",
+          ImGuiSliderFlags_Logarithmic))
+    m_zoom_request = zoom;
+  if (ImGui::Button("Reset"))
+    m_zoom_request = 1.f;
+  ImGui::SameLine();
+  if (ImGui::Button("Whole Map"))
+    m_zoom_request = frame_world.camera_max_zoom;
+
+  ImGui::SeparatorText("Levels of Detail");
+  ImGui::Text("Entities as quads: %zu", frame_world.lod_quad_count);
+  ImGui::Text("Entities as points: %zu", frame_world.lod_point_count);
+}
+} // namespace SimMonitor
+} // namespace FastSimDesign
\ No newline at end of file
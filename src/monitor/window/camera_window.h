@@ -0,0 +1,49 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_CAMERA_WINDOW_H
+#define FAST_SIM_DESIGN_CAMERA_WINDOW_H
+
+#include "window.h"
+
+#include <optional>
+
+namespace FastSimDesign {
+namespace SimMonitor {
+/// Zoom of the world camera and the levels of detail it leads to. The zoom
+/// chosen here is taken by the world on its next update.
+class CameraWindow final : public Window
+{
+private:
+  using Parent = Window;
+
+public:
+  explicit CameraWindow(Monitor* monitor) noexcept;
+  CameraWindow(CameraWindow const&) = default;
+  CameraWindow(CameraWindow&&) = default;
+  CameraWindow& operator=(CameraWindow const&) = default;
+  CameraWindow& operator=(CameraWindow&&) = default;
+  virtual ~CameraWindow() = default;
+
+  // Zoom chosen since the last call, if any.
+  std::optional<float> takeZoomRequest() noexcept;
+
+private:
+  virtual void updateMenuBar(sf::Time const& dt) override;
+  virtual void updateContentArea(sf::Time const& dt) override;
+
+private:
+  std::optional<float> m_zoom_request{};
+};
+} // namespace SimMonitor
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -12,9 +12,12 @@
 
 #include "../modal/about_dialog.h"
 #include "../monitor.h"
+#include "camera_window.h"
 #include "log_window.h"
+#include "minimap_window.h"
 #include "scene_graph_window.h"
 #include "state_machine_window.h"
+#include "telemetry_window.h"
 
 #include <imgui_demo.cpp>
 #include <iostream>
@@ -78,6 +81,27 @@ void ControllerWindow::updateMenuBar(sf::Time const&)
                   .isVisible()))
         m_monitor->getWindow<SceneGraphWindow>(Window::ID::SCENE_GRAPH)
             .switchVisibility();
+      if (ImGui::MenuItem(
+              "Show Camera Window",
+              "Ctrl+K",
+              m_monitor->getWindow<CameraWindow>(Window::ID::CAMERA)
+                  .isVisible()))
+        m_monitor->getWindow<CameraWindow>(Window::ID::CAMERA)
+            .switchVisibility();
+      if (ImGui::MenuItem(
+              "Show Telemetry Window",
+              "Ctrl+T",
+              m_monitor->getWindow<TelemetryWindow>(Window::ID::TELEMETRY)
+                  .isVisible()))
+        m_monitor->getWindow<TelemetryWindow>(Window::ID::TELEMETRY)
+            .switchVisibility();
+      if (ImGui::MenuItem(
+              "Show Minimap Window",
+              "Ctrl+P",
+              m_monitor->getWindow<MinimapWindow>(Window::ID::MINIMAP)
+                  .isVisible()))
+        m_monitor->getWindow<MinimapWindow>(Window::ID::MINIMAP)
+            .switchVisibility();
       ImGui::EndMenu();
     }
 
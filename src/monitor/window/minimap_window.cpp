@@ -0,0 +1,65 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "minimap_window.h"
+
+#include "../monitorable.h"
+
+#include <imgui-SFML.h>
+#include <imgui.h>
+
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/System/Vector2.hpp>
+
+#include <algorithm>
+
+namespace FastSimDesign {
+namespace SimMonitor {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+MinimapWindow::MinimapWindow(Monitor* monitor) noexcept
+  : Parent{monitor, "Minimap Window", true}
+{
+}
+
+void MinimapWindow::updateMenuBar(sf::Time const&) {}
+
+void MinimapWindow::updateContentArea(sf::Time const&)
+{
+  // Get model data.
+  Frame::Minimap frame_minimap;
+  m_data_model->monitorState(*m_monitor, frame_minimap);
+  if (!frame_minimap.texture)
+  {
+    ImGui::TextUnformatted("No minimap available.");
+    return;
+  }
+
+  // Draw data, fitted to the content area with the aspect ratio of the map.
+  sf::Vector2u const size = frame_minimap.texture->getSize();
+  ImVec2 const available = ImGui::GetContentRegionAvail();
+  float const scale = std::max(
+      std::min(
+          available.x / static_cast<float>(size.x),
+          available.y / static_cast<float>(size.y)),
+      0.f);
+  ImGui::Image(
+      *frame_minimap.texture,
+      sf::Vector2f{
+          static_cast<float>(size.x) * scale,
+          static_cast<float>(size.y) * scale});
+}
+} // namespace SimMonitor
+} // namespace FastSimDesign
\ No newline at end of file
@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_MINIMAP_WINDOW_H
+#define FAST_SIM_DESIGN_MINIMAP_WINDOW_H
+
+#include "window.h"
+
+namespace FastSimDesign {
+namespace SimMonitor {
+/// Overview of the whole world with its agents and the current view. The
+/// minimap is only refreshed by the world while this window is visible.
+class MinimapWindow final : public Window
+{
+private:
+  using Parent = Window;
+
+public:
+  explicit MinimapWindow(Monitor* monitor) noexcept;
+  MinimapWindow(MinimapWindow const&) = default;
+  MinimapWindow(MinimapWindow&&) = default;
+  MinimapWindow& operator=(MinimapWindow const&) = default;
+  MinimapWindow& operator=(MinimapWindow&&) = default;
+  virtual ~MinimapWindow() = default;
+
+private:
+  virtual void updateMenuBar(sf::Time const& dt) override;
+  virtual void updateContentArea(sf::Time const& dt) override;
+};
+} // namespace SimMonitor
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -65,10 +65,12 @@ void SceneGraphWindow::drawTreeSceneNode(
   if (ImGui::TreeNodeEx(
           ImGuiUtil::labelize(frame_scene_node.category, id).c_str(),
           node_flags,
-          "%s:%s (%lld)",
+          "%s:%s (%lld) [%u:%u]",
           frame_scene_node.type.c_str(),
           frame_scene_node.category.c_str(),
-          id))
+          id,
+          frame_scene_node.handle_index,
+          frame_scene_node.handle_generation))
   {
     if (ImGui::IsItemClicked())
     {
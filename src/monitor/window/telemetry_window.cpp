@@ -0,0 +1,51 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "telemetry_window.h"
+
+#include "../monitorable.h"
+
+#include <imgui.h>
+
+namespace FastSimDesign {
+namespace SimMonitor {
+////////////////////////////////////////////////////////////
+/// Statics
+////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////
+/// Methods
+////////////////////////////////////////////////////////////
+TelemetryWindow::TelemetryWindow(Monitor* monitor) noexcept
+  : Parent{monitor, "Telemetry Window", true}
+{
+  show();
+}
+
+void TelemetryWindow::updateMenuBar(sf::Time const&) {}
+
+void TelemetryWindow::updateContentArea(sf::Time const&)
+{
+  // Get model data.
+  Frame::World frame_world;
+  m_data_model->monitorState(*m_monitor, frame_world);
+
+  // Draw data.
+  ImGui::SeparatorText("Entities");
+  ImGui::Text("Entities: %zu", frame_world.entity_count);
+  ImGui::Text("Archetypes: %zu", frame_world.archetype_count);
+
+  ImGui::SeparatorText("Gameplay Events");
+  ImGui::Text("Collisions: %zu", frame_world.collision_count);
+  ImGui::Text("Entities destroyed: %zu", frame_world.destroyed_count);
+  ImGui::Text("Pickups collected: %zu", frame_world.collected_pickup_count);
+}
+} // namespace SimMonitor
+} // namespace FastSimDesign
\ No newline at end of file
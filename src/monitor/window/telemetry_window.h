@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_TELEMETRY_WINDOW_H
+#define FAST_SIM_DESIGN_TELEMETRY_WINDOW_H
+
+#include "window.h"
+
+namespace FastSimDesign {
+namespace SimMonitor {
+/// Counters of the world: its ECS entities and archetypes, and the gameplay
+/// events consumed since the start.
+class TelemetryWindow final : public Window
+{
+private:
+  using Parent = Window;
+
+public:
+  explicit TelemetryWindow(Monitor* monitor) noexcept;
+  TelemetryWindow(TelemetryWindow const&) = default;
+  TelemetryWindow(TelemetryWindow&&) = default;
+  TelemetryWindow& operator=(TelemetryWindow const&) = default;
+  TelemetryWindow& operator=(TelemetryWindow&&) = default;
+  virtual ~TelemetryWindow() = default;
+
+private:
+  virtual void updateMenuBar(sf::Time const& dt) override;
+  virtual void updateContentArea(sf::Time const& dt) override;
+};
+} // namespace SimMonitor
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -35,6 +35,8 @@ public:
     STATE_MACHINE,
     SCENE_GRAPH,
     TELEMETRY,
+    CAMERA,
+    MINIMAP,
 
     ID_COUNT
   };
@@ -10,7 +10,7 @@
 
 #include "game_over_state.h"
 
-#include "../core/resource_identifiers.h"
+#include "../core/font_holder.h"
 #include "../entity/player.h"
 #include "../utils/sfml_util.h"
 
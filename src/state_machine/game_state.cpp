@@ -16,11 +16,17 @@
 #include <SFML/Graphics/Shader.hpp>
 #include <SFML/Window/Event.hpp>
 #include <SFML/Window/Keyboard.hpp>
+#include <imgui.h>
 
 namespace FastSimDesign {
 GameState::GameState(StateStack* stack, Context context) noexcept
   : Parent{stack, context, "GAME"}
-  , m_world{*context.monitor, *context.window, *context.fonts, *context.sounds}
+  , m_world{
+        *context.configuration,
+        *context.monitor,
+        *context.window,
+        *context.fonts,
+        *context.sounds}
   , m_player{context.player}
 {
   m_player->setMissionStatus(Player::MissionStatus::MISSION_RUNNING);
@@ -35,6 +41,12 @@ bool GameState::handleEvent(sf::Event const& event)
   CommandQueue& commands = m_world.getCommandQueue();
   m_player->handleEvent(event, commands);
 
+  // Mouse wheel zooms the camera, unless scrolling a monitor window.
+  if (event.type == sf::Event::MouseWheelScrolled &&
+      event.mouseWheelScroll.wheel == sf::Mouse::VerticalWheel &&
+      !ImGui::GetIO().WantCaptureMouse)
+    m_world.zoomCamera(event.mouseWheelScroll.delta);
+
   // Escape pressed, trigger the pause screen.
   if (event.type == sf::Event::KeyPressed &&
       event.key.code == sf::Keyboard::Escape)
@@ -10,7 +10,7 @@
 
 #include "loading_state.h"
 
-#include "../core/resource_identifiers.h"
+#include "../core/font_holder.h"
 #include "../utils/sfml_util.h"
 #include "state_identifiers.h"
 
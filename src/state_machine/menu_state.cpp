@@ -11,6 +11,7 @@
 #include "menu_state.h"
 
 #include "../core/music_player.h"
+#include "../core/texture_holder.h"
 #include "../gui/button.h"
 
 #include <SFML/Graphics/Font.hpp>
@@ -11,7 +11,7 @@
 #include "pause_state.h"
 
 #include "../core/music_player.h"
-#include "../core/resource_identifiers.h"
+#include "../core/font_holder.h"
 #include "../utils/sfml_util.h"
 
 #include <SFML/Graphics/RectangleShape.hpp>
@@ -10,6 +10,7 @@
 
 #include "settings_state.h"
 
+#include "../core/texture_holder.h"
 #include "../utils/sfml_util.h"
 
 #include <SFML/Graphics/RenderWindow.hpp>
@@ -17,6 +17,7 @@ namespace FastSimDesign {
 /// Context::Methods
 ////////////////////////////////////////////////////////////
 State::Context::Context(
+    Configuration const* configuration_,
     SimMonitor::Monitor* monitor_,
     sf::RenderWindow* window_,
     TextureHolder* textures_,
@@ -24,7 +25,8 @@ State::Context::Context(
     Player* player_,
     MusicPlayer* music_,
     SoundPlayer* sounds_) noexcept
-  : monitor{monitor_}
+  : configuration{configuration_}
+  , monitor{monitor_}
   , window{window_}
   , textures{textures_}
   , fonts{fonts_}
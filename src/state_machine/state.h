@@ -26,6 +26,7 @@ class Event;
 } // namespace sf
 
 namespace FastSimDesign {
+struct Configuration;
 class StateStack;
 class Player;
 class MusicPlayer;
@@ -36,6 +37,7 @@ public:
   struct Context
   {
     explicit Context(
+        Configuration const* configuration_,
         SimMonitor::Monitor* monitor_,
         sf::RenderWindow* window_,
         TextureHolder* textures_,
@@ -49,6 +51,7 @@ public:
     Context& operator=(Context&&) = default;
     virtual ~Context() = default;
 
+    Configuration const* configuration;
     SimMonitor::Monitor* monitor;
     sf::RenderWindow* window;
     TextureHolder* textures;
@@ -10,7 +10,8 @@
 
 #include "title_state.h"
 
-#include "../core/resource_identifiers.h"
+#include "../core/font_holder.h"
+#include "../core/texture_holder.h"
 #include "../utils/sfml_util.h"
 
 #include <SFML/Graphics/RenderWindow.hpp>
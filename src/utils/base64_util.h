@@ -0,0 +1,160 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_BASE64_UTIL_H
+#define FAST_SIM_DESIGN_BASE64_UTIL_H
+
+#include "simd_util.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace FastSimDesign {
+namespace Base64 {
+constexpr std::string_view Whitespaces = " \t\r\n";
+constexpr std::uint8_t Invalid_Value = 0xFF;
+
+// Value of each base64 digit, Invalid_Value for any other character.
+constexpr std::array<std::uint8_t, 256> Digit_Values = []() {
+  std::array<std::uint8_t, 256> values{};
+  values.fill(Invalid_Value);
+  constexpr std::string_view digits =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  for (std::size_t i = 0; i < digits.size(); ++i)
+    values[static_cast<unsigned char>(digits[i])] =
+        static_cast<std::uint8_t>(i);
+  return values;
+}();
+
+// Decode base64 `text` to `output` from `written` bytes, skipping whitespaces.
+// Return the number of bytes written, nothing if the text is not base64 or
+// does not fit.
+inline std::optional<std::size_t> decodeScalar(
+    std::string_view text,
+    std::span<std::uint8_t> output,
+    std::size_t written = 0) noexcept
+{
+  std::uint32_t bits = 0;
+  int bit_count = 0;
+  bool is_padded = false;
+  for (char character : text)
+  {
+    if (Whitespaces.find(character) != std::string_view::npos)
+      continue;
+    if (character == '=')
+    {
+      is_padded = true;
+      continue;
+    }
+
+    std::uint8_t value = Digit_Values[static_cast<unsigned char>(character)];
+    if (value == Invalid_Value || is_padded)
+      return std::nullopt;
+    bits = (bits << 6) | value;
+    bit_count += 6;
+    if (bit_count >= 8)
+    {
+      bit_count -= 8;
+      if (written == output.size())
+        return std::nullopt;
+      output[written++] = static_cast<std::uint8_t>(bits >> bit_count);
+    }
+  }
+  return written;
+}
+
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+// Decode blocks of 32 digits to 24 bytes, as long as the blocks hold only
+// digits and 32 bytes are left in `output`. Return the number of digits
+// decoded, a multiple of 32, the rest is left to the scalar path. From
+// "Faster Base64 Encoding and Decoding using AVX2 Instructions", W. Mula and
+// D. Lemire.
+FAST_SIM_DESIGN_TARGET_AVX2 inline std::size_t decodeAvx2(
+    std::string_view text, std::span<std::uint8_t> output) noexcept
+{
+  // Bits of the classes of a digit from its nibbles, a digit is valid when
+  // its low and high classes share no bit.
+  __m256i const low_classes = _mm256_setr_epi8(
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+      0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+      0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  __m256i const high_classes = _mm256_setr_epi8(
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+      0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+      0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  // Offset from a digit to its value, by high nibble ('/' gets its own).
+  __m256i const offsets = _mm256_setr_epi8(
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+      0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  __m256i const slash = _mm256_set1_epi8(0x2F);
+  __m256i const pack_bytes = _mm256_set1_epi32(0x01400140);
+  __m256i const pack_words = _mm256_set1_epi32(0x00011000);
+  __m256i const order = _mm256_setr_epi8(
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+      2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  __m256i const lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7);
+
+  std::size_t read = 0;
+  std::size_t written = 0;
+  while (read + 32 <= text.size() && written + 32 <= output.size())
+  {
+    __m256i digits = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const*>(text.data() + read));
+    __m256i const high_nibbles =
+        _mm256_and_si256(_mm256_srli_epi32(digits, 4), slash);
+    __m256i const low_nibbles = _mm256_and_si256(digits, slash);
+    __m256i const high = _mm256_shuffle_epi8(high_classes, high_nibbles);
+    __m256i const low = _mm256_shuffle_epi8(low_classes, low_nibbles);
+    if (!_mm256_testz_si256(low, high))
+      break;
+
+    __m256i const is_slash = _mm256_cmpeq_epi8(digits, slash);
+    digits = _mm256_add_epi8(
+        digits,
+        _mm256_shuffle_epi8(offsets, _mm256_add_epi8(is_slash, high_nibbles)));
+
+    // Four 6 bit values to three bytes per 32 bit lane, then packed.
+    __m256i bytes = _mm256_maddubs_epi16(digits, pack_bytes);
+    bytes = _mm256_madd_epi16(bytes, pack_words);
+    bytes = _mm256_shuffle_epi8(bytes, order);
+    bytes = _mm256_permutevar8x32_epi32(bytes, lanes);
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(output.data() + written), bytes);
+
+    read += 32;
+    written += 24;
+  }
+  return read;
+}
+#endif
+
+// Decode base64 `text` to `output`, with AVX2 when the CPU supports it, with
+// the same result as decodeScalar().
+inline std::optional<std::size_t> decode(
+    std::string_view text, std::span<std::uint8_t> output) noexcept
+{
+  std::size_t read = 0;
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+  if (Simd::isAvx2Supported())
+    read = decodeAvx2(text, output);
+#endif
+  return decodeScalar(text.substr(read), output, read / 4 * 3);
+}
+} // namespace Base64
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
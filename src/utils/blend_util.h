@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_BLEND_UTIL_H
+#define FAST_SIM_DESIGN_BLEND_UTIL_H
+
+#include "simd_util.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+namespace FastSimDesign {
+namespace PixelBlend {
+// Exact rounded division by 255 of `value` in [0, 255 * 255].
+inline std::uint32_t divide255(std::uint32_t value) noexcept
+{
+  value += 128;
+  return (value + (value >> 8)) >> 8;
+}
+
+// Color channels blend by the source alpha, the alpha channel by one:
+// dst = src * (a, a, a, 1) + dst * (1 - a).
+inline void alphaScalar(
+    std::uint8_t* destination,
+    std::uint8_t const* source,
+    std::size_t count) noexcept
+{
+  for (std::size_t i = 0; i < count * 4; i += 4)
+  {
+    std::uint32_t const alpha = source[i + 3];
+    for (std::size_t channel = 0; channel < 4; ++channel)
+    {
+      std::uint32_t const factor = channel == 3 ? 255 : alpha;
+      destination[i + channel] = static_cast<std::uint8_t>(divide255(
+          source[i + channel] * factor +
+          destination[i + channel] * (255 - alpha)));
+    }
+  }
+}
+
+// dst = saturate(src * (a, a, a, 1) + dst).
+inline void addScalar(
+    std::uint8_t* destination,
+    std::uint8_t const* source,
+    std::size_t count) noexcept
+{
+  for (std::size_t i = 0; i < count * 4; i += 4)
+  {
+    std::uint32_t const alpha = source[i + 3];
+    for (std::size_t channel = 0; channel < 4; ++channel)
+    {
+      std::uint32_t const factor = channel == 3 ? 255 : alpha;
+      std::uint32_t const sum =
+          divide255(source[i + channel] * factor) + destination[i + channel];
+      destination[i + channel] = static_cast<std::uint8_t>(std::min(sum, 255u));
+    }
+  }
+}
+
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+// Exact rounded division by 255 of sixteen 16-bit values.
+FAST_SIM_DESIGN_TARGET_AVX2 inline __m256i divide255Avx2(__m256i value)
+{
+  value = _mm256_add_epi16(value, _mm256_set1_epi16(128));
+  return _mm256_srli_epi16(
+      _mm256_add_epi16(value, _mm256_srli_epi16(value, 8)), 8);
+}
+
+// Source factors (a, a, a, 255) and destination factors (255 - a) of eight
+// pixels, as bytes.
+FAST_SIM_DESIGN_TARGET_AVX2 inline void computeFactorsAvx2(
+    __m256i source, __m256i& source_factors, __m256i& destination_factors)
+{
+  __m256i const broadcast_alpha = _mm256_setr_epi8(
+      3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15,
+      3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11, 15, 15, 15, 15);
+  __m256i const alpha_lanes = _mm256_set1_epi32(static_cast<int>(0xFF000000));
+  __m256i const alphas = _mm256_shuffle_epi8(source, broadcast_alpha);
+  source_factors = _mm256_or_si256(alphas, alpha_lanes);
+  destination_factors = _mm256_sub_epi8(_mm256_set1_epi8(-1), alphas);
+}
+
+FAST_SIM_DESIGN_TARGET_AVX2 inline void alphaAvx2(
+    std::uint8_t* destination,
+    std::uint8_t const* source,
+    std::size_t count) noexcept
+{
+  __m256i const zero = _mm256_setzero_si256();
+
+  // Eight pixels per iteration, each half widened to 16-bit channels.
+  std::size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256i const src =
+        _mm256_loadu_si256(reinterpret_cast<__m256i const*>(source + i * 4));
+    __m256i const dst = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const*>(destination + i * 4));
+    __m256i source_factors;
+    __m256i destination_factors;
+    computeFactorsAvx2(src, source_factors, destination_factors);
+
+    __m256i const low = divide255Avx2(_mm256_add_epi16(
+        _mm256_mullo_epi16(
+            _mm256_unpacklo_epi8(src, zero),
+            _mm256_unpacklo_epi8(source_factors, zero)),
+        _mm256_mullo_epi16(
+            _mm256_unpacklo_epi8(dst, zero),
+            _mm256_unpacklo_epi8(destination_factors, zero))));
+    __m256i const high = divide255Avx2(_mm256_add_epi16(
+        _mm256_mullo_epi16(
+            _mm256_unpackhi_epi8(src, zero),
+            _mm256_unpackhi_epi8(source_factors, zero)),
+        _mm256_mullo_epi16(
+            _mm256_unpackhi_epi8(dst, zero),
+            _mm256_unpackhi_epi8(destination_factors, zero))));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(destination + i * 4),
+        _mm256_packus_epi16(low, high));
+  }
+  alphaScalar(destination + i * 4, source + i * 4, count - i);
+}
+
+FAST_SIM_DESIGN_TARGET_AVX2 inline void addAvx2(
+    std::uint8_t* destination,
+    std::uint8_t const* source,
+    std::size_t count) noexcept
+{
+  __m256i const zero = _mm256_setzero_si256();
+
+  std::size_t i = 0;
+  for (; i + 8 <= count; i += 8)
+  {
+    __m256i const src =
+        _mm256_loadu_si256(reinterpret_cast<__m256i const*>(source + i * 4));
+    __m256i const dst = _mm256_loadu_si256(
+        reinterpret_cast<__m256i const*>(destination + i * 4));
+    __m256i source_factors;
+    __m256i destination_factors;
+    computeFactorsAvx2(src, source_factors, destination_factors);
+
+    __m256i const low = divide255Avx2(_mm256_mullo_epi16(
+        _mm256_unpacklo_epi8(src, zero),
+        _mm256_unpacklo_epi8(source_factors, zero)));
+    __m256i const high = divide255Avx2(_mm256_mullo_epi16(
+        _mm256_unpackhi_epi8(src, zero),
+        _mm256_unpackhi_epi8(source_factors, zero)));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i*>(destination + i * 4),
+        _mm256_adds_epu8(dst, _mm256_packus_epi16(low, high)));
+  }
+  addScalar(destination + i * 4, source + i * 4, count - i);
+}
+#endif
+
+// Blend `count` RGBA pixels of `source` over `destination`, with AVX2 when
+// the CPU supports it, with the same result as alphaScalar().
+inline void alpha(
+    std::uint8_t* destination,
+    std::uint8_t const* source,
+    std::size_t count) noexcept
+{
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+  if (Simd::isAvx2Supported())
+  {
+    alphaAvx2(destination, source, count);
+    return;
+  }
+#endif
+  alphaScalar(destination, source, count);
+}
+
+// Same as alpha() for additive blending.
+inline void add(
+    std::uint8_t* destination,
+    std::uint8_t const* source,
+    std::size_t count) noexcept
+{
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+  if (Simd::isAvx2Supported())
+  {
+    addAvx2(destination, source, count);
+    return;
+  }
+#endif
+  addScalar(destination, source, count);
+}
+} // namespace PixelBlend
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
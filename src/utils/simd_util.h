@@ -0,0 +1,37 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef FAST_SIM_DESIGN_SIMD_UTIL_H
+#define FAST_SIM_DESIGN_SIMD_UTIL_H
+
+// AVX2 kernels are compiled with a target attribute and selected at runtime,
+// so that the binary still runs on CPUs without it.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FAST_SIM_DESIGN_SIMD_AVX2
+#define FAST_SIM_DESIGN_TARGET_AVX2 __attribute__((target("avx2")))
+#include <immintrin.h>
+#endif
+
+namespace FastSimDesign {
+namespace Simd {
+inline bool isAvx2Supported() noexcept
+{
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+  static bool const supported = __builtin_cpu_supports("avx2");
+  return supported;
+#else
+  return false;
+#endif
+}
+} // namespace Simd
+} // namespace FastSimDesign
+#endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "../src/utils/base64_util.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace FastSimDesign;
+
+namespace {
+std::string encode(std::vector<std::uint8_t> const& bytes)
+{
+  constexpr std::string_view digits =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string text{};
+  for (std::size_t i = 0; i < bytes.size(); i += 3)
+  {
+    std::uint32_t bits = bytes[i] << 16;
+    if (i + 1 < bytes.size())
+      bits |= bytes[i + 1] << 8;
+    if (i + 2 < bytes.size())
+      bits |= bytes[i + 2];
+    text += digits[(bits >> 18) & 0x3F];
+    text += digits[(bits >> 12) & 0x3F];
+    text += i + 1 < bytes.size() ? digits[(bits >> 6) & 0x3F] : '=';
+    text += i + 2 < bytes.size() ? digits[bits & 0x3F] : '=';
+  }
+  return text;
+}
+
+std::vector<std::uint8_t> makeBytes(std::mt19937& random, std::size_t size)
+{
+  std::uniform_int_distribution<int> byte{0, 255};
+  std::vector<std::uint8_t> bytes(size);
+  for (std::uint8_t& value : bytes)
+    value = static_cast<std::uint8_t>(byte(random));
+  return bytes;
+}
+
+// Both decoders on `text`, with the result of the scalar one first.
+std::pair<std::optional<std::vector<std::uint8_t>>,
+          std::optional<std::vector<std::uint8_t>>>
+decodeBoth(std::string const& text, std::size_t capacity)
+{
+  std::vector<std::uint8_t> scalar(capacity);
+  std::vector<std::uint8_t> dispatched(capacity);
+  std::optional<std::size_t> scalar_size = Base64::decodeScalar(text, scalar);
+  std::optional<std::size_t> size = Base64::decode(text, dispatched);
+  std::optional<std::vector<std::uint8_t>> scalar_bytes{};
+  std::optional<std::vector<std::uint8_t>> bytes{};
+  if (scalar_size)
+    scalar_bytes.emplace(scalar.begin(), scalar.begin() + *scalar_size);
+  if (size)
+    bytes.emplace(dispatched.begin(), dispatched.begin() + *size);
+  return {scalar_bytes, bytes};
+}
+} // namespace
+
+TEST(Base64Test, decodeScalarReadsPaddingTails)
+{
+  for (std::size_t size = 0; size < 8; ++size)
+  {
+    std::mt19937 random{static_cast<unsigned>(size)};
+    std::vector<std::uint8_t> bytes = makeBytes(random, size);
+    std::vector<std::uint8_t> output(size);
+    std::optional<std::size_t> written =
+        Base64::decodeScalar(encode(bytes), output);
+    ASSERT_TRUE(written.has_value());
+    EXPECT_EQ(*written, size);
+    EXPECT_EQ(output, bytes);
+  }
+}
+
+TEST(Base64Test, decodeScalarRejectsInvalidText)
+{
+  std::vector<std::uint8_t> output(16);
+  EXPECT_FALSE(Base64::decodeScalar("QUJD*EVG", output).has_value());
+  EXPECT_FALSE(Base64::decodeScalar("QQ==QUJD", output).has_value());
+  std::vector<std::uint8_t> small(2);
+  EXPECT_FALSE(Base64::decodeScalar("QUJD", small).has_value());
+}
+
+TEST(Base64Test, decodeMatchesScalarOnRandomText)
+{
+  if (!Simd::isAvx2Supported())
+    GTEST_SKIP() << "AVX2 is not supported by this CPU.";
+
+  std::mt19937 random{42};
+  std::uniform_int_distribution<std::size_t> length{0, 600};
+  for (int round = 0; round < 500; ++round)
+  {
+    std::vector<std::uint8_t> bytes = makeBytes(random, length(random));
+    std::string const text = encode(bytes);
+    auto [scalar, dispatched] = decodeBoth(text, bytes.size());
+    ASSERT_TRUE(scalar.has_value());
+    EXPECT_EQ(*scalar, bytes);
+    EXPECT_EQ(dispatched, scalar) << "for " << bytes.size() << " bytes";
+  }
+}
+
+TEST(Base64Test, decodeMatchesScalarWithWhitespaces)
+{
+  if (!Simd::isAvx2Supported())
+    GTEST_SKIP() << "AVX2 is not supported by this CPU.";
+
+  // As written by Tiled, indented and cut in lines, or with a stray blank.
+  std::mt19937 random{7};
+  std::uniform_int_distribution<std::size_t> length{1, 600};
+  std::uniform_int_distribution<std::size_t> line{1, 80};
+  for (int round = 0; round < 500; ++round)
+  {
+    std::vector<std::uint8_t> bytes = makeBytes(random, length(random));
+    std::string const encoded = encode(bytes);
+    std::string text = "\n   ";
+    std::size_t const line_length = line(random);
+    for (std::size_t i = 0; i < encoded.size(); ++i)
+    {
+      text += encoded[i];
+      if ((i + 1) % line_length == 0)
+        text += round % 2 == 0 ? "\r\n\t" : " ";
+    }
+    text += "\n  ";
+
+    auto [scalar, dispatched] = decodeBoth(text, bytes.size());
+    ASSERT_TRUE(scalar.has_value());
+    EXPECT_EQ(*scalar, bytes);
+    EXPECT_EQ(dispatched, scalar) << "for " << bytes.size() << " bytes";
+  }
+}
+
+TEST(Base64Test, decodeMatchesScalarOnInvalidText)
+{
+  if (!Simd::isAvx2Supported())
+    GTEST_SKIP() << "AVX2 is not supported by this CPU.";
+
+  // An invalid digit anywhere, in a vector block or in the scalar tail.
+  std::mt19937 random{3};
+  std::vector<std::uint8_t> bytes = makeBytes(random, 300);
+  std::string const encoded = encode(bytes);
+  for (std::size_t i = 0; i < encoded.size(); i += 7)
+  {
+    std::string text = encoded;
+    text[i] = i % 2 == 0 ? '*' : '=';
+    auto [scalar, dispatched] = decodeBoth(text, bytes.size());
+    EXPECT_EQ(dispatched, scalar) << "with a bad digit at " << i;
+  }
+
+  // An output too small.
+  auto [scalar, dispatched] = decodeBoth(encoded, bytes.size() - 1);
+  EXPECT_FALSE(scalar.has_value());
+  EXPECT_FALSE(dispatched.has_value());
+}
\ No newline at end of file
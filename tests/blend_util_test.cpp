@@ -0,0 +1,126 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "../src/utils/blend_util.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace FastSimDesign;
+
+namespace {
+// RGBA pixels, their alphas often fully opaque or fully transparent as in
+// sprites.
+std::vector<std::uint8_t> makePixels(std::mt19937& random, std::size_t count)
+{
+  std::uniform_int_distribution<int> byte{0, 255};
+  std::vector<std::uint8_t> pixels(count * 4);
+  for (std::size_t i = 0; i < pixels.size(); ++i)
+  {
+    int value = byte(random);
+    if (i % 4 == 3 && value < 64)
+      value = value < 32 ? 0 : 255;
+    pixels[i] = static_cast<std::uint8_t>(value);
+  }
+  return pixels;
+}
+
+// Lengths around the eight pixels of a vector block, and longer spans.
+std::vector<std::size_t> makeCounts()
+{
+  std::vector<std::size_t> counts{};
+  for (std::size_t count = 0; count <= 33; ++count)
+    counts.push_back(count);
+  counts.insert(counts.end(), {255, 256, 257, 1021});
+  return counts;
+}
+} // namespace
+
+TEST(PixelBlendTest, alphaScalarKeepsOrReplacesPixels)
+{
+  std::vector<std::uint8_t> destination{10, 20, 30, 40, 10, 20, 30, 40};
+  std::vector<std::uint8_t> const source{
+      200, 100, 50, 0, 200, 100, 50, 255};
+  PixelBlend::alphaScalar(destination.data(), source.data(), 2);
+  // Transparent source: kept.
+  EXPECT_EQ(destination[0], 10);
+  EXPECT_EQ(destination[3], 40);
+  // Opaque source: replaced.
+  EXPECT_EQ(destination[4], 200);
+  EXPECT_EQ(destination[7], 255);
+}
+
+TEST(PixelBlendTest, addScalarSaturates)
+{
+  std::vector<std::uint8_t> destination{250, 0, 100, 200};
+  std::vector<std::uint8_t> const source{100, 100, 100, 255};
+  PixelBlend::addScalar(destination.data(), source.data(), 1);
+  EXPECT_EQ(destination, (std::vector<std::uint8_t>{255, 100, 200, 255}));
+}
+
+TEST(PixelBlendTest, alphaMatchesScalar)
+{
+  if (!Simd::isAvx2Supported())
+    GTEST_SKIP() << "AVX2 is not supported by this CPU.";
+
+  std::mt19937 random{17};
+  for (std::size_t count : makeCounts())
+  {
+    std::vector<std::uint8_t> const source = makePixels(random, count);
+    std::vector<std::uint8_t> expected = makePixels(random, count);
+    std::vector<std::uint8_t> blended = expected;
+    PixelBlend::alphaScalar(expected.data(), source.data(), count);
+    PixelBlend::alpha(blended.data(), source.data(), count);
+    EXPECT_EQ(blended, expected) << "for " << count << " pixels";
+  }
+}
+
+TEST(PixelBlendTest, addMatchesScalar)
+{
+  if (!Simd::isAvx2Supported())
+    GTEST_SKIP() << "AVX2 is not supported by this CPU.";
+
+  std::mt19937 random{23};
+  for (std::size_t count : makeCounts())
+  {
+    std::vector<std::uint8_t> const source = makePixels(random, count);
+    std::vector<std::uint8_t> expected = makePixels(random, count);
+    std::vector<std::uint8_t> blended = expected;
+    PixelBlend::addScalar(expected.data(), source.data(), count);
+    PixelBlend::add(blended.data(), source.data(), count);
+    EXPECT_EQ(blended, expected) << "for " << count << " pixels";
+  }
+}
+
+TEST(PixelBlendTest, alphaMatchesScalarOnSpanOffsets)
+{
+  if (!Simd::isAvx2Supported())
+    GTEST_SKIP() << "AVX2 is not supported by this CPU.";
+
+  // Spans of a row start anywhere, the loads are unaligned.
+  std::mt19937 random{29};
+  std::vector<std::uint8_t> const source = makePixels(random, 64);
+  std::vector<std::uint8_t> const row = makePixels(random, 64);
+  for (std::size_t first = 0; first < 9; ++first)
+  {
+    std::size_t const count = 64 - first - 3;
+    std::vector<std::uint8_t> expected = row;
+    std::vector<std::uint8_t> blended = row;
+    PixelBlend::alphaScalar(
+        expected.data() + first * 4, source.data() + first * 4, count);
+    PixelBlend::alpha(
+        blended.data() + first * 4, source.data() + first * 4, count);
+    EXPECT_EQ(blended, expected) << "from pixel " << first;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "../src/gui/frame_capture.h"
+
+#include <gtest/gtest.h>
+#include <zlib.h>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace FastSimDesign;
+
+namespace {
+sf::Image makeFrame(std::uint8_t shade)
+{
+  sf::Image frame{};
+  frame.create(5, 3, sf::Color{shade, 60, 90});
+  frame.setPixel(4, 2, sf::Color{255, 0, 0, 128});
+  return frame;
+}
+
+std::vector<std::uint8_t> readFile(std::filesystem::path const& path)
+{
+  std::ifstream file{path, std::ios::binary};
+  return std::vector<std::uint8_t>{
+      std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+std::uint32_t readUint32(std::vector<std::uint8_t> const& bytes, std::size_t at)
+{
+  return static_cast<std::uint32_t>(bytes[at]) |
+         static_cast<std::uint32_t>(bytes[at + 1]) << 8 |
+         static_cast<std::uint32_t>(bytes[at + 2]) << 16 |
+         static_cast<std::uint32_t>(bytes[at + 3]) << 24;
+}
+} // namespace
+
+/// Captures frames already in memory, as the headless world does, into a
+/// temporary directory.
+class FrameCaptureTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_directory = std::filesystem::temp_directory_path() /
+                  "fast_sim_design_frame_capture_test";
+    std::filesystem::remove_all(m_directory);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(m_directory); }
+
+  FrameCaptureSettings makeSettings(FrameCaptureSettings::Format format) const
+  {
+    FrameCaptureSettings settings{};
+    settings.directory = m_directory;
+    settings.format = format;
+    settings.overflow = FrameCaptureSettings::Overflow::BLOCK;
+    return settings;
+  }
+
+protected:
+  std::filesystem::path m_directory{};
+};
+
+TEST_F(FrameCaptureTest, writesNumberedPngFrames)
+{
+  FrameCapture capture{makeSettings(FrameCaptureSettings::Format::PNG)};
+  for (std::uint8_t shade = 0; shade < 3; ++shade)
+    capture.capture(makeFrame(shade));
+  capture.flush();
+
+  FrameCapture::Statistics const statistics = capture.getStatistics();
+  EXPECT_EQ(statistics.captured_count, 3u);
+  EXPECT_EQ(statistics.written_count, 3u);
+  EXPECT_EQ(statistics.dropped_count, 0u);
+  EXPECT_EQ(statistics.failed_count, 0u);
+  for (std::string const name :
+       {"frame_000000.png", "frame_000001.png", "frame_000002.png"})
+  {
+    sf::Image written{};
+    ASSERT_TRUE(written.loadFromFile((m_directory / name).string())) << name;
+    EXPECT_EQ(written.getSize(), makeFrame(0).getSize()) << name;
+  }
+}
+
+TEST_F(FrameCaptureTest, writesRawZlibFrames)
+{
+  sf::Image const frame = makeFrame(30);
+  {
+    FrameCapture capture{makeSettings(FrameCaptureSettings::Format::RAW_ZLIB)};
+    capture.capture(frame);
+  }
+
+  std::vector<std::uint8_t> const bytes =
+      readFile(m_directory / "frame_000000.rgba.z");
+  ASSERT_GT(bytes.size(), 12u);
+  EXPECT_EQ(std::string(bytes.begin(), bytes.begin() + 4), "FSDR");
+  EXPECT_EQ(readUint32(bytes, 4), frame.getSize().x);
+  EXPECT_EQ(readUint32(bytes, 8), frame.getSize().y);
+
+  std::vector<std::uint8_t> pixels(
+      static_cast<std::size_t>(frame.getSize().x) * frame.getSize().y * 4);
+  uLongf pixels_size = static_cast<uLongf>(pixels.size());
+  ASSERT_EQ(
+      uncompress(
+          pixels.data(),
+          &pixels_size,
+          bytes.data() + 12,
+          static_cast<uLong>(bytes.size() - 12)),
+      Z_OK);
+  ASSERT_EQ(pixels_size, pixels.size());
+  EXPECT_TRUE(std::equal(
+      pixels.begin(), pixels.end(), frame.getPixelsPtr()));
+}
\ No newline at end of file
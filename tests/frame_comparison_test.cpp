@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "../src/core/resource_exception.h"
+#include "../src/gui/frame_comparison.h"
+
+#include <gtest/gtest.h>
+
+#include <SFML/Graphics/Color.hpp>
+#include <SFML/Graphics/Image.hpp>
+
+#include <filesystem>
+
+using namespace FastSimDesign;
+
+namespace {
+sf::Image makeFrame()
+{
+  sf::Image frame{};
+  frame.create(4, 3, sf::Color{40, 80, 120});
+  frame.setPixel(1, 1, sf::Color{200, 100, 50, 128});
+  return frame;
+}
+} // namespace
+
+TEST(FrameComparisonTest, identicalFramesMatch)
+{
+  sf::Image const frame = makeFrame();
+  FrameDifference const result = compareFrames(frame, makeFrame());
+  EXPECT_TRUE(result.matches());
+  EXPECT_EQ(result.pixel_count, 12u);
+  EXPECT_EQ(result.different_pixel_count, 0u);
+  EXPECT_EQ(result.max_channel_difference, 0u);
+}
+
+TEST(FrameComparisonTest, differencesWithinToleranceMatch)
+{
+  sf::Image frame = makeFrame();
+  frame.setPixel(2, 0, sf::Color{43, 78, 120});
+
+  FrameDifference const within = compareFrames(frame, makeFrame(), 3);
+  EXPECT_TRUE(within.matches());
+  EXPECT_EQ(within.max_channel_difference, 3u);
+
+  FrameDifference const beyond = compareFrames(frame, makeFrame(), 2);
+  EXPECT_FALSE(beyond.matches());
+  EXPECT_EQ(beyond.different_pixel_count, 1u);
+}
+
+TEST(FrameComparisonTest, differentFramesAreReported)
+{
+  sf::Image frame = makeFrame();
+  frame.setPixel(0, 0, sf::Color::White);
+  frame.setPixel(3, 2, sf::Color{40, 80, 120, 0});
+
+  sf::Image difference{};
+  FrameDifference const result =
+      compareFrames(frame, makeFrame(), 0, &difference);
+  EXPECT_FALSE(result.matches());
+  EXPECT_EQ(result.different_pixel_count, 2u);
+  EXPECT_EQ(result.max_channel_difference, 255u);
+
+  ASSERT_EQ(difference.getSize(), makeFrame().getSize());
+  EXPECT_EQ(difference.getPixel(0, 0), sf::Color::Red);
+  EXPECT_EQ(difference.getPixel(3, 2), sf::Color::Red);
+  EXPECT_EQ(difference.getPixel(1, 0), (sf::Color{10, 20, 30}));
+}
+
+TEST(FrameComparisonTest, framesOfDifferentSizesDifferEverywhere)
+{
+  sf::Image frame{};
+  frame.create(2, 3, sf::Color{40, 80, 120});
+  FrameDifference const result = compareFrames(frame, makeFrame());
+  EXPECT_FALSE(result.matches());
+  EXPECT_EQ(result.different_pixel_count, result.pixel_count);
+}
+
+/// Records golden frames in a temporary directory.
+class GoldenFrameTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_directory = std::filesystem::temp_directory_path() /
+                  "fast_sim_design_golden_frame_test";
+    std::filesystem::remove_all(m_directory);
+    std::filesystem::create_directories(m_directory);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(m_directory); }
+
+protected:
+  std::filesystem::path m_directory{};
+};
+
+TEST_F(GoldenFrameTest, recordedFrameMatchesOnCompare)
+{
+  std::filesystem::path const path = m_directory / "frame.png";
+  FrameDifference const recorded =
+      compareToGoldenFrame(makeFrame(), path, GoldenFrameMode::RECORD);
+  EXPECT_TRUE(recorded.is_recorded);
+  ASSERT_TRUE(std::filesystem::exists(path));
+
+  FrameDifference const compared =
+      compareToGoldenFrame(makeFrame(), path, GoldenFrameMode::COMPARE);
+  EXPECT_FALSE(compared.is_recorded);
+  EXPECT_TRUE(compared.matches());
+
+  sf::Image changed = makeFrame();
+  changed.setPixel(0, 2, sf::Color::Black);
+  EXPECT_FALSE(
+      compareToGoldenFrame(changed, path, GoldenFrameMode::COMPARE).matches());
+}
+
+TEST_F(GoldenFrameTest, missingGoldenFrameThrows)
+{
+  EXPECT_THROW(
+      compareToGoldenFrame(makeFrame(), m_directory / "missing.png"),
+      ResourceException);
+}
\ No newline at end of file
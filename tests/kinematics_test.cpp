@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "../src/ecs/kinematics.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace FastSimDesign;
+using namespace FastSimDesign::ECS;
+
+namespace {
+std::vector<float> makeStream(std::mt19937& random, std::size_t size)
+{
+  std::uniform_real_distribution<float> value{-500.f, 500.f};
+  std::vector<float> stream(size);
+  for (float& element : stream)
+    element = value(random);
+  return stream;
+}
+} // namespace
+
+TEST(KinematicsTest, integrateMovesByVelocity)
+{
+  std::vector<Position> positions{{1.f, 2.f}, {-3.f, 4.f}};
+  std::vector<Velocity> const velocities{{10.f, 0.f}, {0.f, -20.f}};
+  Kinematics::integrate(positions.data(), velocities.data(), 2, 0.5f);
+  EXPECT_FLOAT_EQ(positions[0].x, 6.f);
+  EXPECT_FLOAT_EQ(positions[0].y, 2.f);
+  EXPECT_FLOAT_EQ(positions[1].x, -3.f);
+  EXPECT_FLOAT_EQ(positions[1].y, -6.f);
+}
+
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+TEST(KinematicsTest, integrateAvx2MatchesScalar)
+{
+  if (!Simd::isAvx2Supported())
+    GTEST_SKIP() << "AVX2 is not supported by this CPU.";
+
+  // Stream sizes around the eight floats of a register, with tails.
+  std::mt19937 random{5};
+  for (std::size_t size = 0; size <= 67; ++size)
+  {
+    std::vector<float> expected = makeStream(random, size);
+    std::vector<float> const velocities = makeStream(random, size);
+    std::vector<float> integrated = expected;
+    Kinematics::integrateScalar(
+        expected.data(), velocities.data(), size, 1.f / 60.f);
+    Kinematics::integrateAvx2(
+        integrated.data(), velocities.data(), size, 1.f / 60.f);
+    EXPECT_EQ(integrated, expected) << "for " << size << " floats";
+  }
+}
+#endif
+
+TEST(KinematicsTest, integrateMatchesScalarOnEntities)
+{
+  std::mt19937 random{9};
+  for (std::size_t count = 0; count <= 33; ++count)
+  {
+    std::vector<float> const start = makeStream(random, count * 2);
+    std::vector<float> const velocities = makeStream(random, count * 2);
+    std::vector<float> expected = start;
+    Kinematics::integrateScalar(
+        expected.data(), velocities.data(), count * 2, 0.02f);
+
+    std::vector<Position> positions(count);
+    std::vector<Velocity> entity_velocities(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      positions[i] = Position{start[2 * i], start[2 * i + 1]};
+      entity_velocities[i] =
+          Velocity{velocities[2 * i], velocities[2 * i + 1]};
+    }
+    Kinematics::integrate(
+        positions.data(), entity_velocities.data(), count, 0.02f);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(positions[i].x, expected[2 * i]) << "entity " << i;
+      EXPECT_EQ(positions[i].y, expected[2 * i + 1]) << "entity " << i;
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "../src/entity/particle_kernels.h"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace FastSimDesign;
+
+namespace {
+std::vector<float> makeColumn(
+    std::mt19937& random, std::size_t size, float min, float max)
+{
+  std::uniform_real_distribution<float> value{min, max};
+  std::vector<float> column(size);
+  for (float& element : column)
+    element = value(random);
+  return column;
+}
+
+// Columns of a run, with particles inside, across and outside of the view,
+// and lifetimes from expired to longer than the maximum.
+struct Particles
+{
+  explicit Particles(std::mt19937& random, std::size_t count)
+    : x{makeColumn(random, count, -100.f, 900.f)}
+    , y{makeColumn(random, count, -100.f, 700.f)}
+    , scales{makeColumn(random, count, 0.1f, 3.f)}
+    , lifetimes{makeColumn(random, count, -0.5f, 2.5f)}
+  {
+  }
+
+  ParticleKernels::AlphaRun makeRun(std::vector<std::uint8_t>& alphas) const
+  {
+    return ParticleKernels::AlphaRun{
+        x.data(),
+        y.data(),
+        scales.data(),
+        lifetimes.data(),
+        alphas.data(),
+        255.f / 2.f,
+        sf::Vector2f{8.f, 6.f},
+        sf::FloatRect{0.f, 0.f, 800.f, 600.f}};
+  }
+
+  std::vector<float> x;
+  std::vector<float> y;
+  std::vector<float> scales;
+  std::vector<float> lifetimes;
+};
+} // namespace
+
+TEST(ParticleKernelsTest, computeAlphasScalarCullsAndClamps)
+{
+  std::vector<float> const x{400.f, -50.f, 400.f, 400.f};
+  std::vector<float> const y{300.f, 300.f, 300.f, 300.f};
+  std::vector<float> const scales{1.f, 1.f, 1.f, 1.f};
+  std::vector<float> const lifetimes{1.f, 1.f, 5.f, -1.f};
+  std::vector<std::uint8_t> alphas(4, 7);
+  ParticleKernels::AlphaRun const run{
+      x.data(),
+      y.data(),
+      scales.data(),
+      lifetimes.data(),
+      alphas.data(),
+      255.f / 2.f,
+      sf::Vector2f{8.f, 6.f},
+      sf::FloatRect{0.f, 0.f, 800.f, 600.f}};
+  ParticleKernels::computeAlphasScalar(run, 0, 4);
+  EXPECT_EQ(alphas, (std::vector<std::uint8_t>{127, 0, 255, 0}));
+}
+
+#ifdef FAST_SIM_DESIGN_SIMD_AVX2
+TEST(ParticleKernelsTest, decayAvx2MatchesScalar)
+{
+  if (!Simd::isAvx2Supported())
+    GTEST_SKIP() << "AVX2 is not supported by this CPU.";
+
+  // Sizes around the eight floats of a register, with tails.
+  std::mt19937 random{13};
+  for (std::size_t count = 0; count <= 67; ++count)
+  {
+    std::vector<float> expected = makeColumn(random, count, -1.f, 3.f);
+    std::vector<float> decayed = expected;
+    ParticleKernels::decayScalar(expected.data(), count, 1.f / 60.f);
+    ParticleKernels::decayAvx2(decayed.data(), count, 1.f / 60.f);
+    EXPECT_EQ(decayed, expected) << "for " << count << " particles";
+  }
+}
+
+TEST(ParticleKernelsTest, computeAlphasAvx2MatchesScalar)
+{
+  if (!Simd::isAvx2Supported())
+    GTEST_SKIP() << "AVX2 is not supported by this CPU.";
+
+  std::mt19937 random{19};
+  for (std::size_t count = 0; count <= 67; ++count)
+  {
+    Particles const particles{random, count};
+    std::vector<std::uint8_t> expected(count, 1);
+    std::vector<std::uint8_t> computed(count, 2);
+    ParticleKernels::computeAlphasScalar(
+        particles.makeRun(expected), 0, count);
+    ParticleKernels::computeAlphasAvx2(particles.makeRun(computed), count);
+    EXPECT_EQ(computed, expected) << "for " << count << " particles";
+  }
+}
+#endif
+
+TEST(ParticleKernelsTest, computeAlphasMatchesScalar)
+{
+  std::mt19937 random{31};
+  for (std::size_t count : {1u, 7u, 8u, 9u, 255u, 1000u})
+  {
+    Particles const particles{random, count};
+    std::vector<std::uint8_t> expected(count, 1);
+    std::vector<std::uint8_t> computed(count, 2);
+    ParticleKernels::computeAlphasScalar(
+        particles.makeRun(expected), 0, count);
+    ParticleKernels::computeAlphas(particles.makeRun(computed), count);
+    EXPECT_EQ(computed, expected) << "for " << count << " particles";
+  }
+}
\ No newline at end of file
@@ -0,0 +1,189 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "../src/core/worker_pool.h"
+#include "../src/gui/tile_map_cache.h"
+#include "../src/gui/tile_map_loader.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace FastSimDesign;
+
+namespace {
+std::string readFile(std::filesystem::path const& path)
+{
+  std::ifstream file{path, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file}, {}};
+}
+
+void writeFile(std::filesystem::path const& path, std::string const& content)
+{
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file.write(content.data(), static_cast<std::streamsize>(content.size()));
+}
+
+void expectSameMap(TileMap const& map, TileMap const& expected)
+{
+  EXPECT_EQ(map.size, expected.size);
+  EXPECT_EQ(map.tile_size, expected.tile_size);
+  ASSERT_EQ(map.tilesets.size(), expected.tilesets.size());
+  for (std::size_t i = 0; i < map.tilesets.size(); ++i)
+  {
+    EXPECT_EQ(map.tilesets[i].name, expected.tilesets[i].name);
+    EXPECT_EQ(map.tilesets[i].first_gid, expected.tilesets[i].first_gid);
+    EXPECT_EQ(map.tilesets[i].tile_count, expected.tilesets[i].tile_count);
+    EXPECT_EQ(
+        map.tilesets[i].image.lexically_normal(),
+        expected.tilesets[i].image.lexically_normal());
+  }
+  ASSERT_EQ(map.layers.size(), expected.layers.size());
+  for (std::size_t i = 0; i < map.layers.size(); ++i)
+  {
+    EXPECT_EQ(map.layers[i].name, expected.layers[i].name);
+    EXPECT_EQ(map.layers[i].size, expected.layers[i].size);
+    std::vector<std::uint32_t> const gids{
+        map.layers[i].getGids().begin(), map.layers[i].getGids().end()};
+    std::vector<std::uint32_t> const expected_gids{
+        expected.layers[i].getGids().begin(),
+        expected.layers[i].getGids().end()};
+    EXPECT_EQ(gids, expected_gids) << "in layer '" << map.layers[i].name << "'";
+  }
+}
+} // namespace
+
+/// Works on a copy of a test map in a temporary directory, its cache being
+/// written next to it.
+class TileMapCacheTest : public testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    m_directory = std::filesystem::temp_directory_path() /
+                  "fast_sim_design_tile_map_cache_test";
+    std::filesystem::remove_all(m_directory);
+    std::filesystem::create_directories(m_directory);
+    m_source = m_directory / "encodings.tmx";
+    m_cache = m_directory / "encodings.bin";
+    std::filesystem::copy_file("assets/maps/encodings.tmx", m_source);
+  }
+
+  void TearDown() override { std::filesystem::remove_all(m_directory); }
+
+  TileMap loadSource() const { return TileMapLoader{}.load(m_source); }
+
+  // Overwrite `count` bytes of the cache from `offset`, keeping its size.
+  void scribbleCache(std::size_t offset, std::size_t count) const
+  {
+    std::string content = readFile(m_cache);
+    ASSERT_LE(offset + count, content.size());
+    for (std::size_t i = offset; i < offset + count; ++i)
+      content[i] = static_cast<char>(0xA5);
+    writeFile(m_cache, content);
+  }
+
+protected:
+  std::filesystem::path m_directory{};
+  std::filesystem::path m_source{};
+  std::filesystem::path m_cache{};
+};
+
+TEST_F(TileMapCacheTest, loadRoundTripsThroughCache)
+{
+  TileMap const expected = loadSource();
+
+  TileMapCache compiled{};
+  compiled.load(m_source, m_cache);
+  expectSameMap(compiled.getMap(), expected);
+  ASSERT_TRUE(std::filesystem::exists(m_cache));
+
+  TileMapCache mapped{};
+  mapped.load(m_source, m_cache);
+  EXPECT_TRUE(mapped.isLoadedFromCache());
+  expectSameMap(mapped.getMap(), expected);
+}
+
+TEST_F(TileMapCacheTest, loadOnWorkersRoundTripsThroughCache)
+{
+  TileMap const expected = loadSource();
+  WorkerPool workers{4};
+
+  TileMapCache cache{};
+  cache.load(m_source, m_cache, &workers);
+  expectSameMap(cache.getMap(), expected);
+  cache.load(m_source, m_cache, &workers);
+  EXPECT_TRUE(cache.isLoadedFromCache());
+  expectSameMap(cache.getMap(), expected);
+}
+
+TEST_F(TileMapCacheTest, loadRebuildsAfterSameSizeEdit)
+{
+  TileMapCache cache{};
+  cache.load(m_source, m_cache);
+
+  // Same size and same write time, only the content tells the edit.
+  std::filesystem::file_time_type const write_time =
+      std::filesystem::last_write_time(m_source);
+  std::string content = readFile(m_source);
+  std::size_t const first_id = content.find("\n27,53,");
+  ASSERT_NE(first_id, std::string::npos);
+  content[first_id + 2] = '8';
+  writeFile(m_source, content);
+  std::filesystem::last_write_time(m_source, write_time);
+
+  TileMap const expected = loadSource();
+  ASSERT_EQ(expected.layers[0].getGids()[0], 28u);
+  cache.load(m_source, m_cache);
+  expectSameMap(cache.getMap(), expected);
+
+  // The rebuilt cache is used next.
+  TileMapCache mapped{};
+  mapped.load(m_source, m_cache);
+  EXPECT_TRUE(mapped.isLoadedFromCache());
+  expectSameMap(mapped.getMap(), expected);
+}
+
+TEST_F(TileMapCacheTest, loadRebuildsTruncatedCache)
+{
+  TileMap const expected = loadSource();
+  TileMapCache cache{};
+  cache.load(m_source, m_cache);
+
+  std::string const content = readFile(m_cache);
+  writeFile(m_cache, content.substr(0, content.size() / 2));
+  cache.load(m_source, m_cache);
+  expectSameMap(cache.getMap(), expected);
+  EXPECT_EQ(readFile(m_cache), content);
+}
+
+TEST_F(TileMapCacheTest, loadRebuildsCacheWithBadHeader)
+{
+  TileMap const expected = loadSource();
+  TileMapCache cache{};
+  cache.load(m_source, m_cache);
+  std::string const content = readFile(m_cache);
+
+  // Magic then version.
+  scribbleCache(0, 8);
+  cache.load(m_source, m_cache);
+  expectSameMap(cache.getMap(), expected);
+  EXPECT_EQ(readFile(m_cache), content);
+
+  scribbleCache(8, 4);
+  cache.load(m_source, m_cache);
+  expectSameMap(cache.getMap(), expected);
+  EXPECT_EQ(readFile(m_cache), content);
+}
\ No newline at end of file
@@ -0,0 +1,77 @@
+////////////////////////////////////////////////////////////
+///
+/// Copyright 2024-present, Joseph Garnier
+/// All rights reserved.
+///
+/// This source code is licensed under the license found in the
+/// LICENSE file in the root directory of this source tree.
+///
+////////////////////////////////////////////////////////////
+
+#include "../src/core/resource_exception.h"
+#include "../src/core/worker_pool.h"
+#include "../src/gui/tile_map_loader.h"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace FastSimDesign;
+
+namespace {
+// The same ids in each layer, as CSV, XML, base64, base64 with zlib and
+// base64 with gzip.
+constexpr char const* Encodings_Map_Path = "assets/maps/encodings.tmx";
+
+void expectSameGids(TileMap const& map)
+{
+  ASSERT_EQ(map.layers.size(), 5u);
+  std::vector<std::uint32_t> const expected{
+      map.layers[0].getGids().begin(), map.layers[0].getGids().end()};
+  ASSERT_EQ(expected.size(), 12u * 9u);
+  for (TileLayer const& layer : map.layers)
+  {
+    std::vector<std::uint32_t> const gids{
+        layer.getGids().begin(), layer.getGids().end()};
+    EXPECT_EQ(gids, expected) << "in layer '" << layer.name << "'";
+  }
+}
+} // namespace
+
+TEST(TileMapLoaderTest, loadReadsCsvLayer)
+{
+  TileMap const map = TileMapLoader{}.load(Encodings_Map_Path);
+  ASSERT_EQ(map.tilesets.size(), 1u);
+  EXPECT_EQ(map.tilesets[0].tile_count, 60u);
+  ASSERT_FALSE(map.layers.empty());
+
+  TileLayer const& layer = map.layers[0];
+  EXPECT_EQ(layer.name, "csv");
+  EXPECT_EQ(layer.size, (sf::Vector2u{12, 9}));
+  ASSERT_EQ(layer.getGids().size(), 12u * 9u);
+  EXPECT_EQ(layer.getGids()[0], 27u);
+  EXPECT_EQ(layer.getGids()[14], 0u);
+  // Flip bits are kept.
+  EXPECT_EQ(layer.getGids()[16], TileLayer::Flipped_Vertically | 2u);
+  EXPECT_EQ(
+      layer.getGids()[17],
+      TileLayer::Flipped_Horizontally | TileLayer::Flipped_Vertically | 37u);
+}
+
+TEST(TileMapLoaderTest, loadDecodesAllEncodingsToSameGids)
+{
+  expectSameGids(TileMapLoader{}.load(Encodings_Map_Path));
+}
+
+TEST(TileMapLoaderTest, loadDecodesAllEncodingsToSameGidsOnWorkers)
+{
+  WorkerPool workers{4};
+  expectSameGids(TileMapLoader{&workers}.load(Encodings_Map_Path));
+}
+
+TEST(TileMapLoaderTest, loadThrowsOnMissingMap)
+{
+  EXPECT_THROW(
+      TileMapLoader{}.load("assets/maps/missing.tmx"), ResourceException);
+}
\ No newline at end of file